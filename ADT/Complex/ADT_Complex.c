@@ -4,8 +4,8 @@
  * Filename      : ADT_Complex.c
  * Description   : Abstract Data Type for complex numbers.
  * Version       : 01.00
- * Revision      : 14
- * Last modified : 01/17/2021
+ * Revision      : 19
+ * Last modified : 10/18/2026
  * -----------------------------------------------------------------------------
  */
 
@@ -39,6 +39,7 @@ t_ComplexHandler Cmplx_Hdlr =
   complex_exp,                       // Natural exponential
   complex_sqrt,                      // Square root
   complex_nthroot,                   // Nth complex root
+  complex_allroots,                  // All nth roots
   complex_log,                       // Natural logarithm
   complex_logn,                      // Base-n logarithm
   complex_sine,                      // Sin(Z)
@@ -68,6 +69,21 @@ t_ComplexHandler Cmplx_Hdlr =
   complex_delete                     // Delete complex
 };
 
+// Arena chunk
+typedef struct complex_chunk
+{
+  struct complex_chunk* next;   // Previous chunk
+  size_t                size;   // Capacity (complex numbers)
+  size_t                used;   // Complex numbers served
+  t_complex             data[]; // Storage
+}
+t_complexChunk;
+
+// Arena state of each thread
+_Thread_local t_complexChunk*     complex_chunks = NULL;
+_Thread_local uint32_t            complex_depth  = 0;
+_Thread_local t_complexArenaStats complex_stats  = {0, 0, 0, 0};
+
 //----------------------------------------------------------------------------//
 //                              Private functions                             //
 //----------------------------------------------------------------------------//
@@ -81,7 +97,7 @@ void complex_modulus(Complex Z)
 {
   if(Z != NULL)
   {
-    Z->Mod = sqrt( pow(Z->Real, 2) + pow(Z->Imag, 2) );
+    Z->Mod = hypot(Z->Real, Z->Imag);
   }
 }
 
@@ -111,23 +127,129 @@ void complex_argument(Complex Z)
 }
 
 /**
-@brief Custom signum function. Returns the sign of introduced value
-@param: val: Numerical value
-@retval (-1) if val < 0, (0) if val == 0, (1) if val > 0
+@brief  Creates a complex number from a by-value result
+@param  z: Value (polar components are recomputed)
+@retval Pointer to new complex number, NULL on memory error
+*/
+Complex complex_box(t_complex z)
+{
+  return Cmplx_Hdlr.init(z.Real, z.Imag);
+}
+
+/**
+@brief  Integer power Z^n by binary exponentiation on Cartesian components
+@param  Z: Pointer to complex (non-null if n < 0)
+        n: Integer exponent
+@retval Complex power
+*/
+Complex complex_intpower(Complex Z, int32_t n)
+{
+  double br = Z->Real, bi = Z->Imag;   // Base (repeated squares)
+  double pr = 1, pi = 0;               // Accumulated power
+  double t = 0, d = 0;
+  uint32_t e = (n < 0) ? (uint32_t)(-(int64_t)(n)) : (uint32_t)(n);
+  
+  // Negative exponent: Z^n = (1/Z)^|n|. The base is inverted first with
+  // Smith's scaling, so no |Z^|n||^2 term can overflow or underflow early
+  if(n < 0)
+  {
+    if( fabs(br) >= fabs(bi) )
+    {
+      t  = bi / br;
+      d  = br + bi * t;
+      br = 1 / d;
+      bi = -t / d;
+    }
+    else
+    {
+      t  = br / bi;
+      d  = br * t + bi;
+      br = t / d;
+      bi = -1 / d;
+    }
+  }
+  
+  while(e > 0)
+  {
+    if(e & 1)
+    {
+      t  = pr * br - pi * bi;
+      pi = pr * bi + pi * br;
+      pr = t;
+    }
+    
+    e >>= 1;
+    
+    if(e > 0)
+    {
+      t  = br * br - bi * bi;
+      bi = 2 * br * bi;
+      br = t;
+    }
+  }
+  
+  return Cmplx_Hdlr.init(pr, pi);
+}
+
+/**
+@brief  Bump-allocates a complex number from the active arena
+@param  none
+@retval Pointer to complex, NULL if a new chunk could not be allocated
 */
-int8_t sgn(double val)
+Complex complex_arena_alloc(void)
 {
-  if(val < 0)
+  t_complexChunk* C = complex_chunks;
+  size_t size = 0;
+  
+  if(C == NULL || C->used == C->size)
   {
-    return -1;
+    // New chunk, twice the previous one
+    size = (C == NULL) ? COMPLEX_ARENA_CHUNK : 2 * C->size;
+    C = (t_complexChunk*)malloc( sizeof(t_complexChunk) + 
+                                 size * sizeof(t_complex) );
+    
+    if(C == NULL)
+    {
+      return NULL;
+    }
+    
+    C->next = complex_chunks;
+    C->size = size;
+    C->used = 0;
+    complex_chunks = C;
+    
+    complex_stats.chunks++;
+    complex_stats.reserved += sizeof(t_complexChunk) + size * sizeof(t_complex);
   }
-  else if(val > 0)
+  
+  complex_stats.objects++;
+  complex_stats.bytes += sizeof(t_complex);
+  
+  return &C->data[C->used++];
+}
+
+/**
+@brief  Verifies if a complex number belongs to the active arena
+@param  Z: Pointer to complex
+@retval TRUE if Z was served by the arena, FALSE otherwise
+*/
+uint8_t complex_arena_owns(Complex Z)
+{
+  t_complexChunk* C = NULL;
+  
+  // Chunks double in size, so the list is short
+  for(C = complex_chunks; C != NULL; C = C->next)
   {
-    return 1;
+    if( (uintptr_t)Z >= (uintptr_t)C->data && 
+        (uintptr_t)Z <  (uintptr_t)(C->data + C->used) )
+    {
+      return TRUE;
+    }
   }
   
-  return 0;
+  return FALSE;
 }
+
 //----------------------------------------------------------------------------//
 //                              Public functions                              //
 //----------------------------------------------------------------------------//
@@ -140,7 +262,11 @@ int8_t sgn(double val)
 */
 Complex complex_create(double Real, double Imag)
 {
-  Complex Z = (Complex)malloc( sizeof(t_complex) ); // Memory allocation
+  Complex Z = NULL;
+  
+  // Memory allocation (arena or heap)
+  Z = (complex_depth > 0) ? complex_arena_alloc() : 
+                            (Complex)malloc( sizeof(t_complex) );
   
   if(Z != NULL)
   {
@@ -395,26 +521,9 @@ Complex complex_division(Complex Z1, Complex Z2)
 */
 Complex complex_reciprocal(Complex Z)
 {
-  Complex Z_inv = NULL;
-  double Z_inv_real = 0, Z_inv_imag = 0;
-  
-  if(Z != NULL)
-  {
-    // Verifies if Z is a null complex
-    if( !Cmplx_Hdlr.isNull(Z) )
-    {
-      // Real part
-      Z_inv_real = (Z->Real) / pow(Z->Mod, 2);
-      
-      // Imaginary part
-      Z_inv_imag = (Z->Imag) / pow(Z->Mod, 2);
-      
-      // Initialize complex
-      Z_inv = Cmplx_Hdlr.init(Z_inv_real, Z_inv_imag);
-    }
-  }
-  
-  return Z_inv;
+  // Principal branch of the by-value template (null Z has no inverse)
+  return (Z != NULL && !Cmplx_Hdlr.isNull(Z)) ?
+         complex_box( cval_inv(*Z) ) : NULL;
 }
 
 /**
@@ -422,6 +531,8 @@ Complex complex_reciprocal(Complex Z)
 @param  Z: Pointer to complex
         n: Real exponential
 @retval Complex power
+@note Integer exponents (|n| <= INT_POWER_MAX) are computed by binary
+      exponentiation on Cartesian components, with no trigonometric calls
 */
 Complex complex_power(Complex Z, double n)
 {
@@ -430,6 +541,12 @@ Complex complex_power(Complex Z, double n)
   
   if(Z != NULL)
   {
+    // Integer exponent: binary exponentiation (no 0^-n, kept as polar case)
+    if( n == floor(n) && fabs(n) <= INT_POWER_MAX && (n >= 0 || Z->Mod != 0) )
+    {
+      return complex_intpower(Z, (int32_t)(n));
+    }
+    
     // Real part
     Z_pow_real = pow(Z->Mod, n) * cos(n * Z->Arg);
     
@@ -475,22 +592,8 @@ Complex complex_exp(Complex Z)
 */
 Complex complex_sqrt(Complex Z)
 {
-  Complex Z_root = NULL;
-  double Z_root_real = 0, Z_root_imag = 0;
-  
-  if(Z != NULL)
-  {
-    // Real part
-    Z_root_real = sqrt( (Z->Real + Z->Mod)/2 );
-    
-    // Imaginary part
-    Z_root_imag = sgn(Z->Imag) * sqrt( (-Z->Real + Z->Mod)/2 );
-    
-    // Initialize complex
-    Z_root = Cmplx_Hdlr.init(Z_root_real, Z_root_imag);
-  }
-  
-  return Z_root;
+  // Principal branch of the by-value template
+  return (Z != NULL) ? complex_box( cval_sqrt(*Z) ) : NULL;
 }
 
 /**
@@ -521,6 +624,51 @@ Complex complex_nthroot(Complex Z, uint8_t n)
   return Z_root;
 }
 
+/**
+@brief  Calculates all the Nth roots of a complex number
+@param  Z: Pointer to complex
+        n: Root index
+        R: Output buffer (n contiguous complex values, R[k] = kth root)
+@retval TRUE if roots were calculated, FALSE otherwise
+@note One trigonometric evaluation for the principal root, the remaining roots
+      are obtained by rotation with exp(2*pi*i/n)
+*/
+uint8_t complex_allroots(Complex Z, uint8_t n, Complex R)
+{
+  double n_i = (double)(n);
+  double rho = 0, wr = 0, wi = 0, t = 0;
+  uint8_t k = 0;
+  
+  if(Z != NULL && R != NULL && n != 0)
+  {
+    // Principal root (De Moivre's Theorem)
+    rho = pow(Z->Mod, 1/n_i);
+    R[0].Real = rho * cos( (Z->Arg) / n_i );
+    R[0].Imag = rho * sin( (Z->Arg) / n_i );
+    
+    // Rotation by a primitive nth root of unity
+    wr = cos(TWO_PI / n_i);
+    wi = sin(TWO_PI / n_i);
+    
+    for(k = 1; k < n; k++)
+    {
+      t = R[k - 1].Real * wr - R[k - 1].Imag * wi;
+      R[k].Imag = R[k - 1].Real * wi + R[k - 1].Imag * wr;
+      R[k].Real = t;
+    }
+    
+    for(k = 0; k < n; k++)
+    {
+      complex_modulus(&R[k]);
+      complex_argument(&R[k]);
+    }
+    
+    return TRUE;
+  }
+  
+  return FALSE;
+}
+
 /**
 @brief  Calculates the natural logarithm of a complex number
 @param  Z: Pointer to complex
@@ -832,780 +980,210 @@ Complex complex_cotangent(Complex Z)
 */
 Complex complex_arcsine(Complex Z)
 {
-  Complex Z_num = NULL;         // Numerator
-  Complex Z_den = NULL;         // Denominator
-  Complex Z_aux_sum = NULL;     // Summand
-  Complex Z_aux_sqrtarg = NULL; // Square root argument
-  Complex Z_aux_sqrt = NULL;    // Square root
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_asin = NULL;        // Arcsine
+  // Principal branch of the by-value template
+  return (Z != NULL) ? complex_box( cval_asin(*Z) ) : NULL;
+}
+
+/**
+@brief  Calculates the complex arccosine of Z
+@param  Z: Pointer to complex
+@retval Complex arccosine
+*/
+Complex complex_arccosine(Complex Z)
+{
+  // Principal branch of the by-value template
+  return (Z != NULL) ? complex_box( cval_acos(*Z) ) : NULL;
+}
+
+/**
+@brief  Calculates the complex arctangent of Z
+@param  Z: Pointer to complex
+@retval Complex arctangent
+*/
+Complex complex_arctangent(Complex Z)
+{
+  // Principal branch of the by-value template
+  return (Z != NULL) ? complex_box( cval_atan(*Z) ) : NULL;
+}
+
+/**
+@brief  Calculates the complex arccosecant of Z
+@param  Z: Pointer to complex
+@retval Complex arccosecant
+*/
+Complex complex_arccosecant(Complex Z)
+{
+  // Principal branch of the by-value template (null Z has no inverse)
+  return (Z != NULL && !Cmplx_Hdlr.isNull(Z)) ?
+         complex_box( cval_acsc(*Z) ) : NULL;
+}
+
+/**
+@brief  Calculates the complex arcsecant of Z
+@param  Z: Pointer to complex
+@retval Complex arcsecant
+*/
+Complex complex_arcsecant(Complex Z)
+{
+  // Principal branch of the by-value template (null Z has no inverse)
+  return (Z != NULL && !Cmplx_Hdlr.isNull(Z)) ?
+         complex_box( cval_asec(*Z) ) : NULL;
+}
+
+/**
+@brief  Calculates the complex arccotangent of Z
+@param  Z: Pointer to complex
+@retval Complex arccotangent
+*/
+Complex complex_arccotangent(Complex Z)
+{
+  // Principal branch of the by-value template (null Z has no inverse)
+  return (Z != NULL && !Cmplx_Hdlr.isNull(Z)) ?
+         complex_box( cval_acot(*Z) ) : NULL;
+}
+
+/**
+@brief  Calculates the complex hyperbolic sine of Z
+@param  Z: Pointer to complex
+@retval Complex hyperbolic sine
+*/
+Complex complex_hyperbolic_sine(Complex Z)
+{
+  Complex Z_num = NULL;    // Numerator
+  Complex Z_sinh = NULL;   // Hyperbolic sine
   
   if(Z != NULL)
   {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( 1 - pow(Z->Mod, 2) * cos(2 * Z->Arg) ), 
-                                     ( - pow(Z->Mod, 2) * sin(2 * Z->Arg)   ) );
+    // Calculates numerator
+    Z_num = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) , 
+                             sin(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) );
     
-    if(Z_aux_sqrtarg == NULL)
+    if(Z_num == NULL)
     {
       return NULL;
     }
     
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
-    
-    if(Z_aux_sqrt == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      
-      return NULL;
-    }
+    // Calculates complex hyperbolic sine
+    Z_sinh = Cmplx_Hdlr.scalar(Z_num, 0.5);
     
-    // Allocates memory for sum element
-    Z_aux_sum = Cmplx_Hdlr.init(-Z->Imag, Z->Real);
+    // Frees allocated memory for auxiliary variable
+    Cmplx_Hdlr.del(Z_num);
+  }
+  
+  return Z_sinh;
+}
+
+/**
+@brief  Calculates the complex hyperbolic cosine of Z
+@param  Z: Pointer to complex
+@retval Complex hyperbolic cosine
+*/
+Complex complex_hyperbolic_cosine(Complex Z)
+{
+  Complex Z_num = NULL;    // Numerator
+  Complex Z_cosh = NULL;   // Hyperbolic cosine
+  
+  if(Z != NULL)
+  {
+    // Calculates numerator
+    Z_num = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) , 
+                             sin(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) );
     
-    if(Z_aux_sum == NULL)
+    if(Z_num == NULL)
     {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
       return NULL;
     }
     
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.sum(Z_aux_sum, Z_aux_sqrt);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      
-      return NULL;
-    }
+    // Calculates complex hyperbolic cosine
+    Z_cosh = Cmplx_Hdlr.scalar(Z_num, 0.5);
     
+    // Frees allocated memory for auxiliary variable
+    Cmplx_Hdlr.del(Z_num);
+  }
+  
+  return Z_cosh;
+}
+
+/**
+@brief  Calculates the complex hyperbolic tangent of Z
+@param  Z: Pointer to complex
+@retval Complex hyperbolic tangent
+*/
+Complex complex_hyperbolic_tangent(Complex Z)
+{
+  Complex Z_num = NULL;       // Numerator
+  Complex Z_den = NULL;       // Denominator
+  Complex Z_tanh = NULL;      // Hyperbolic tangent
+  
+  if(Z != NULL)
+  {
     // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
+    Z_num = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) , 
+                             sin(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) );
     
     if(Z_num == NULL)
     {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
       return NULL;
     }
     
-    // Allocates memory for denominator
-    Z_den = Cmplx_Hdlr.init(0, 1);
+    // Calculates denominator
+    Z_den = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) , 
+                             sin(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) );
     
     if(Z_den == NULL)
     {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_logarg);
+      // Frees allocated memory for numerator
       Cmplx_Hdlr.del(Z_num);
       
       return NULL;
     }
     
-    // Calculates complex arcsine
-    Z_asin = Cmplx_Hdlr.division(Z_num, Z_den);
+    // Calculates complex hyperbolic tangent
+    Z_tanh = Cmplx_Hdlr.division(Z_num, Z_den);
     
     // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_sum);
-    Cmplx_Hdlr.del(Z_aux_logarg);
     Cmplx_Hdlr.del(Z_num);
     Cmplx_Hdlr.del(Z_den);
   }
   
-  return Z_asin;
+  return Z_tanh;
 }
 
 /**
-@brief  Calculates the complex arccosine of Z
+@brief  Calculates the complex hyperbolic cosecant of Z
 @param  Z: Pointer to complex
-@retval Complex arccosine
+@retval Complex hyperbolic cosecant
 */
-Complex complex_arccosine(Complex Z)
+Complex complex_hyperbolic_cosecant(Complex Z)
 {
-  Complex Z_num = NULL;         // Numerator
-  Complex Z_den = NULL;         // Denominator
-  Complex Z_aux_sum = NULL;     // Summand
-  Complex Z_aux_sqrtarg = NULL; // Square root argument
-  Complex Z_aux_sqrt = NULL;    // Square root
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_acos = NULL;        // Arccosine
+  Complex Z_num = NULL;        // Numerator
+  Complex Z_den = NULL;        // Denominator
+  Complex Z_csch = NULL;       // Hyperbolic cosecant
   
   if(Z != NULL)
   {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( 1 - pow(Z->Mod, 2) * cos(2 * Z->Arg) ), 
-                                     ( - pow(Z->Mod, 2) * sin(2 * Z->Arg)   ) );
+    // Calculates numerator
+    Z_num = Cmplx_Hdlr.init(2, 0);
     
-    if(Z_aux_sqrtarg == NULL)
+    if(Z_num == NULL)
     {
       return NULL;
     }
     
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
+    // Calculates denominator
+    Z_den = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) , 
+                             sin(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) );
     
-    if(Z_aux_sqrt == NULL)
+    if(Z_den == NULL)
     {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
+      // Frees allocated memory for numerator
+      Cmplx_Hdlr.del(Z_num);
       
       return NULL;
     }
     
-    // Allocates memory for sum element
-    Z_aux_sum = Cmplx_Hdlr.init(-Z->Imag, Z->Real);
-    
-    if(Z_aux_sum == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.sum(Z_aux_sum, Z_aux_sqrt);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    if(Z_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for denominator
-    Z_den = Cmplx_Hdlr.init(0, 1);
-    
-    if(Z_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      Cmplx_Hdlr.del(Z_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex arccosine
-    Z_acos = Cmplx_Hdlr.division(Z_num, Z_den);
-    Cmplx_Hdlr.update(Z_acos, PI/2 - Z_acos->Real, RE);
-    Cmplx_Hdlr.update(Z_acos, -Z_acos->Imag, IM);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-    Cmplx_Hdlr.del(Z_num);
-    Cmplx_Hdlr.del(Z_den);
-  }
-  
-  return Z_acos;
-}
-
-/**
-@brief  Calculates the complex arctangent of Z
-@param  Z: Pointer to complex
-@retval Complex arctangent
-*/
-Complex complex_arctangent(Complex Z)
-{
-  Complex Z_num = NULL;         // Numerator
-  Complex Z_den = NULL;         // Denominator
-  Complex Z_aux_num = NULL;     // Numerator of logarithm argument
-  Complex Z_aux_den = NULL;     // Denominator of logarithm argument
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_atan = NULL;        // Arctangent
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.init(1 - Z->Imag, Z->Real);
-    
-    if(Z_aux_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates denominator of logarithm argument
-    Z_aux_den = Cmplx_Hdlr.init(1 + Z->Imag, -Z->Real);
-    
-    if(Z_aux_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z_aux_den);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    if(Z_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for denominator
-    Z_den = Cmplx_Hdlr.init(0, 2);
-    
-    if(Z_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      Cmplx_Hdlr.del(Z_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex arctangent
-    Z_atan = Cmplx_Hdlr.division(Z_num, Z_den);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_den);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-    Cmplx_Hdlr.del(Z_num);
-    Cmplx_Hdlr.del(Z_den);
-  }
-  
-  return Z_atan;
-}
-
-/**
-@brief  Calculates the complex arccosecant of Z
-@param  Z: Pointer to complex
-@retval Complex arccosecant
-*/
-Complex complex_arccosecant(Complex Z)
-{
-  Complex Z_num = NULL;         // Numerator
-  Complex Z_den = NULL;         // Denominator
-  Complex Z_aux_sum = NULL;     // Summand
-  Complex Z_aux_sqrtarg = NULL; // Square root argument
-  Complex Z_aux_sqrt = NULL;    // Square root
-  Complex Z_aux_num = NULL;     // Numerator of logarithm argument
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_acsc = NULL;        // Arccosecant
-
-  if(Z != NULL)
-  {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( pow(Z->Mod, 2) * cos(2 * Z->Arg) - 1 ), 
-                                     ( pow(Z->Mod, 2) * sin(2 * Z->Arg)     ) );
-    
-    if(Z_aux_sqrtarg == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
-    
-    if(Z_aux_sqrt == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for sum element
-    Z_aux_sum = Cmplx_Hdlr.init(0, 1);
-    
-    if(Z_aux_sum == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.sum(Z_aux_sum, Z_aux_sqrt);
-    
-    if(Z_aux_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    if(Z_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for denominator
-    Z_den = Cmplx_Hdlr.init(0, 1);
-    
-    if(Z_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      Cmplx_Hdlr.del(Z_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex arccosecant
-    Z_acsc = Cmplx_Hdlr.division(Z_num, Z_den);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_sum);
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-    Cmplx_Hdlr.del(Z_num);
-    Cmplx_Hdlr.del(Z_den);
-  }
-   
-  return Z_acsc;
-}
-
-/**
-@brief  Calculates the complex arcsecant of Z
-@param  Z: Pointer to complex
-@retval Complex arcsecant
-*/
-Complex complex_arcsecant(Complex Z)
-{
-  Complex Z_num = NULL;         // Numerator
-  Complex Z_den = NULL;         // Denominator
-  Complex Z_aux_sum = NULL;     // Summand
-  Complex Z_aux_sqrtarg = NULL; // Square root argument
-  Complex Z_aux_sqrt = NULL;    // Square root
-  Complex Z_aux_num = NULL;     // Numerator of logarithm argument
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_asec = NULL;        // Arcsecant
-
-  if(Z != NULL)
-  {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( pow(Z->Mod, 2) * cos(2 * Z->Arg) - 1 ), 
-                                     ( pow(Z->Mod, 2) * sin(2 * Z->Arg)     ) );
-    
-    if(Z_aux_sqrtarg == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
-    
-    if(Z_aux_sqrt == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for sum element
-    Z_aux_sum = Cmplx_Hdlr.init(0, 1);
-    
-    if(Z_aux_sum == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.sum(Z_aux_sum, Z_aux_sqrt);
-    
-    if(Z_aux_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    if(Z_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for denominator
-    Z_den = Cmplx_Hdlr.init(0, 1);
-    
-    if(Z_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      Cmplx_Hdlr.del(Z_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex arcsecant
-    Z_asec = Cmplx_Hdlr.division(Z_num, Z_den);
-    Cmplx_Hdlr.update(Z_asec, PI/2 - Z_asec->Real, RE);
-    Cmplx_Hdlr.update(Z_asec, -Z_asec->Imag, IM);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_sum);
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-    Cmplx_Hdlr.del(Z_num);
-    Cmplx_Hdlr.del(Z_den);
-  }
-   
-  return Z_asec;
-}
-
-/**
-@brief  Calculates the complex arccotangent of Z
-@param  Z: Pointer to complex
-@retval Complex arccotangent
-*/
-Complex complex_arccotangent(Complex Z)
-{
-  Complex Z_num = NULL;         // Numerator
-  Complex Z_den = NULL;         // Denominator
-  Complex Z_aux_num = NULL;     // Numerator of logarithm argument
-  Complex Z_aux_den = NULL;     // Denominator of logarithm argument
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_acot = NULL;        // Arccotangent
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.init(Z->Real, Z->Imag + 1);
-    
-    if(Z_aux_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates denominator of logarithm argument
-    Z_aux_den = Cmplx_Hdlr.init(Z->Real, Z->Imag - 1);
-    
-    if(Z_aux_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z_aux_den);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    if(Z_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for denominator
-    Z_den = Cmplx_Hdlr.init(0, 2);
-    
-    if(Z_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      Cmplx_Hdlr.del(Z_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex arccotangent
-    Z_acot = Cmplx_Hdlr.division(Z_num, Z_den);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_den);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-    Cmplx_Hdlr.del(Z_num);
-    Cmplx_Hdlr.del(Z_den);
-  }
-  
-  return Z_acot;
-}
-
-/**
-@brief  Calculates the complex hyperbolic sine of Z
-@param  Z: Pointer to complex
-@retval Complex hyperbolic sine
-*/
-Complex complex_hyperbolic_sine(Complex Z)
-{
-  Complex Z_num = NULL;    // Numerator
-  Complex Z_sinh = NULL;   // Hyperbolic sine
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) , 
-                             sin(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) );
-    
-    if(Z_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic sine
-    Z_sinh = Cmplx_Hdlr.scalar(Z_num, 0.5);
-    
-    // Frees allocated memory for auxiliary variable
-    Cmplx_Hdlr.del(Z_num);
-  }
-  
-  return Z_sinh;
-}
-
-/**
-@brief  Calculates the complex hyperbolic cosine of Z
-@param  Z: Pointer to complex
-@retval Complex hyperbolic cosine
-*/
-Complex complex_hyperbolic_cosine(Complex Z)
-{
-  Complex Z_num = NULL;    // Numerator
-  Complex Z_cosh = NULL;   // Hyperbolic cosine
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) , 
-                             sin(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) );
-    
-    if(Z_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic cosine
-    Z_cosh = Cmplx_Hdlr.scalar(Z_num, 0.5);
-    
-    // Frees allocated memory for auxiliary variable
-    Cmplx_Hdlr.del(Z_num);
-  }
-  
-  return Z_cosh;
-}
-
-/**
-@brief  Calculates the complex hyperbolic tangent of Z
-@param  Z: Pointer to complex
-@retval Complex hyperbolic tangent
-*/
-Complex complex_hyperbolic_tangent(Complex Z)
-{
-  Complex Z_num = NULL;       // Numerator
-  Complex Z_den = NULL;       // Denominator
-  Complex Z_tanh = NULL;      // Hyperbolic tangent
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) , 
-                             sin(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) );
-    
-    if(Z_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates denominator
-    Z_den = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) , 
-                             sin(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) );
-    
-    if(Z_den == NULL)
-    {
-      // Frees allocated memory for numerator
-      Cmplx_Hdlr.del(Z_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic tangent
-    Z_tanh = Cmplx_Hdlr.division(Z_num, Z_den);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_num);
-    Cmplx_Hdlr.del(Z_den);
-  }
-  
-  return Z_tanh;
-}
-
-/**
-@brief  Calculates the complex hyperbolic cosecant of Z
-@param  Z: Pointer to complex
-@retval Complex hyperbolic cosecant
-*/
-Complex complex_hyperbolic_cosecant(Complex Z)
-{
-  Complex Z_num = NULL;        // Numerator
-  Complex Z_den = NULL;        // Denominator
-  Complex Z_csch = NULL;       // Hyperbolic cosecant
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.init(2, 0);
-    
-    if(Z_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates denominator
-    Z_den = Cmplx_Hdlr.init( cos(Z->Imag) * ( exp(Z->Real) - exp(-Z->Real) ) , 
-                             sin(Z->Imag) * ( exp(Z->Real) + exp(-Z->Real) ) );
-    
-    if(Z_den == NULL)
-    {
-      // Frees allocated memory for numerator
-      Cmplx_Hdlr.del(Z_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic cosecant
-    Z_csch = Cmplx_Hdlr.division(Z_num, Z_den);
+    // Calculates complex hyperbolic cosecant
+    Z_csch = Cmplx_Hdlr.division(Z_num, Z_den);
     
     // Frees allocated memory for auxiliary variables
     Cmplx_Hdlr.del(Z_num);
@@ -1711,55 +1289,8 @@ Complex complex_hyperbolic_cotangent(Complex Z)
 */
 Complex complex_hyperbolic_arcsine(Complex Z)
 {
-  Complex Z_aux_sqrtarg = NULL;  // Square root argument
-  Complex Z_aux_sqrt = NULL;     // Square root
-  Complex Z_aux_logarg = NULL;   // Logarithm argument
-  Complex Z_asinh = NULL;        // Hyperbolic arcsine
-  
-  if(Z != NULL)
-  {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( pow(Z->Mod, 2) * cos(2 * Z->Arg) + 1 ), 
-                                     ( pow(Z->Mod, 2) * sin(2 * Z->Arg)     ) );
-    
-    if(Z_aux_sqrtarg == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
-    
-    if(Z_aux_sqrt == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.sum(Z, Z_aux_sqrt);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic arcsine
-    Z_asinh = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-  }
-  
-  return Z_asinh;
+  // Principal branch of the by-value template
+  return (Z != NULL) ? complex_box( cval_asinh(*Z) ) : NULL;
 }
 
 /**
@@ -1769,55 +1300,8 @@ Complex complex_hyperbolic_arcsine(Complex Z)
 */
 Complex complex_hyperbolic_arccosine(Complex Z)
 {
-  Complex Z_aux_sqrtarg = NULL;  // Square root argument
-  Complex Z_aux_sqrt = NULL;     // Square root
-  Complex Z_aux_logarg = NULL;   // Logarithm argument
-  Complex Z_acosh = NULL;        // Hyperbolic arccosine
-  
-  if(Z != NULL)
-  {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( pow(Z->Mod, 2) * cos(2 * Z->Arg) - 1 ), 
-                                     ( pow(Z->Mod, 2) * sin(2 * Z->Arg)     ) );
-    
-    if(Z_aux_sqrtarg == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
-    
-    if(Z_aux_sqrt == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.sum(Z, Z_aux_sqrt);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic arccosine
-    Z_acosh = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-  }
-  
-  return Z_acosh;
+  // Principal branch of the by-value template
+  return (Z != NULL) ? complex_box( cval_acosh(*Z) ) : NULL;
 }
 
 /**
@@ -1827,69 +1311,8 @@ Complex complex_hyperbolic_arccosine(Complex Z)
 */
 Complex complex_hyperbolic_arctangent(Complex Z)
 {
-  Complex Z_num = NULL;          // Numerator
-  Complex Z_aux_num = NULL;      // Numerator of logarithm argument
-  Complex Z_aux_den = NULL;      // Denominator of logarithm argument
-  Complex Z_aux_logarg = NULL;   // Logarithm argument
-  Complex Z_atanh = NULL;        // Hyperbolic arctangent
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.init(1 + Z->Real, Z->Imag);
-    
-    if(Z_aux_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates denominator of logarithm argument
-    Z_aux_den = Cmplx_Hdlr.init(1 - Z->Real, -Z->Imag);
-    
-    if(Z_aux_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z_aux_den);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    if(Z_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic arctangent
-    Z_atanh = Cmplx_Hdlr.scalar(Z_num, 0.5);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_den);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-    Cmplx_Hdlr.del(Z_num);
-  }
-  
-  return Z_atanh;
+  // Principal branch of the by-value template
+  return (Z != NULL) ? complex_box( cval_atanh(*Z) ) : NULL;
 }
 
 /**
@@ -1899,86 +1322,9 @@ Complex complex_hyperbolic_arctangent(Complex Z)
 */
 Complex complex_hyperbolic_arccosecant(Complex Z)
 {
-  Complex Z_aux_sum = NULL;     // Summand
-  Complex Z_aux_sqrtarg = NULL; // Square root argument
-  Complex Z_aux_sqrt = NULL;    // Square root
-  Complex Z_aux_num = NULL;     // Numerator of logarithm argument
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_acsch = NULL;       // Hyperbolic arccosecant
-
-  if(Z != NULL)
-  {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( 1 + pow(Z->Mod, 2) * cos(2 * Z->Arg) ), 
-                                     ( pow(Z->Mod, 2) * sin(2 * Z->Arg)     ) );
-    
-    if(Z_aux_sqrtarg == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
-    
-    if(Z_aux_sqrt == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for sum element
-    Z_aux_sum = Cmplx_Hdlr.init(1, 0);
-    
-    if(Z_aux_sum == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.sum(Z_aux_sum, Z_aux_sqrt);
-    
-    if(Z_aux_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic arccosecant
-    Z_acsch = Cmplx_Hdlr.log(Z_aux_logarg);
-
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_sum);
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-  }
-   
-  return Z_acsch;
+  // Principal branch of the by-value template (null Z has no inverse)
+  return (Z != NULL && !Cmplx_Hdlr.isNull(Z)) ?
+         complex_box( cval_acsch(*Z) ) : NULL;
 }
 
 /**
@@ -1988,86 +1334,9 @@ Complex complex_hyperbolic_arccosecant(Complex Z)
 */
 Complex complex_hyperbolic_arcsecant(Complex Z)
 {
-  Complex Z_aux_sum = NULL;     // Summand
-  Complex Z_aux_sqrtarg = NULL; // Square root argument
-  Complex Z_aux_sqrt = NULL;    // Square root
-  Complex Z_aux_num = NULL;     // Numerator of logarithm argument
-  Complex Z_aux_logarg = NULL;  // Logarithm argument
-  Complex Z_asech = NULL;       // Hyperbolic arcsecant
-
-  if(Z != NULL)
-  {
-    // Calculates square root argument
-    Z_aux_sqrtarg = Cmplx_Hdlr.init( ( 1 - pow(Z->Mod, 2) * cos(2 * Z->Arg) ), 
-                                     ( -pow(Z->Mod, 2) * sin(2 * Z->Arg)    ) );
-    
-    if(Z_aux_sqrtarg == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates square root of logarithm argument
-    Z_aux_sqrt = Cmplx_Hdlr.sqrt(Z_aux_sqrtarg);
-    
-    if(Z_aux_sqrt == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      
-      return NULL;
-    }
-    
-    // Allocates memory for sum element
-    Z_aux_sum = Cmplx_Hdlr.init(1, 0);
-    
-    if(Z_aux_sum == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.sum(Z_aux_sum, Z_aux_sqrt);
-    
-    if(Z_aux_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_sqrtarg);
-      Cmplx_Hdlr.del(Z_aux_sqrt);
-      Cmplx_Hdlr.del(Z_aux_sum);
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic arcsecant
-    Z_asech = Cmplx_Hdlr.log(Z_aux_logarg);
-
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_sqrtarg);
-    Cmplx_Hdlr.del(Z_aux_sqrt);
-    Cmplx_Hdlr.del(Z_aux_sum);
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-  }
-   
-  return Z_asech;
+  // Principal branch of the by-value template (null Z has no inverse)
+  return (Z != NULL && !Cmplx_Hdlr.isNull(Z)) ?
+         complex_box( cval_asech(*Z) ) : NULL;
 }
 
 /**
@@ -2077,69 +1346,9 @@ Complex complex_hyperbolic_arcsecant(Complex Z)
 */
 Complex complex_hyperbolic_arccotangent(Complex Z)
 {
-  Complex Z_num = NULL;          // Numerator
-  Complex Z_aux_num = NULL;      // Numerator of logarithm argument
-  Complex Z_aux_den = NULL;      // Denominator of logarithm argument
-  Complex Z_aux_logarg = NULL;   // Logarithm argument
-  Complex Z_acoth = NULL;        // Hyperbolic arccotangent
-  
-  if(Z != NULL)
-  {
-    // Calculates numerator of logarithm argument
-    Z_aux_num = Cmplx_Hdlr.init(Z->Real + 1, Z->Imag);
-    
-    if(Z_aux_num == NULL)
-    {
-      return NULL;
-    }
-    
-    // Calculates denominator of logarithm argument
-    Z_aux_den = Cmplx_Hdlr.init(Z->Real - 1, Z->Imag);
-    
-    if(Z_aux_den == NULL)
-    {
-      // Frees allocated memory for auxiliary variable
-      Cmplx_Hdlr.del(Z_aux_num);
-      
-      return NULL;
-    }
-    
-    // Calculates logarithm argument
-    Z_aux_logarg = Cmplx_Hdlr.division(Z_aux_num, Z_aux_den);
-    
-    if(Z_aux_logarg == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      
-      return NULL;
-    }
-    
-    // Calculates numerator
-    Z_num = Cmplx_Hdlr.log(Z_aux_logarg);
-    
-    if(Z_num == NULL)
-    {
-      // Frees allocated memory for auxiliary variables
-      Cmplx_Hdlr.del(Z_aux_num);
-      Cmplx_Hdlr.del(Z_aux_den);
-      Cmplx_Hdlr.del(Z_aux_logarg);
-      
-      return NULL;
-    }
-    
-    // Calculates complex hyperbolic arccotangent
-    Z_acoth = Cmplx_Hdlr.scalar(Z_num, 0.5);
-    
-    // Frees allocated memory for auxiliary variables
-    Cmplx_Hdlr.del(Z_aux_num);
-    Cmplx_Hdlr.del(Z_aux_den);
-    Cmplx_Hdlr.del(Z_aux_logarg);
-    Cmplx_Hdlr.del(Z_num);
-  }
-  
-  return Z_acoth;
+  // Principal branch of the by-value template (null Z has no inverse)
+  return (Z != NULL && !Cmplx_Hdlr.isNull(Z)) ?
+         complex_box( cval_acoth(*Z) ) : NULL;
 }
 
 /**
@@ -2152,8 +1361,12 @@ uint8_t complex_delete(Complex Z)
   // Validates indicated vector
   if(Z != NULL)
   {
-    // Frees allocated memory
-    free(Z);
+    // Arena numbers are released by complex_arena_end
+    if(complex_depth == 0 || !complex_arena_owns(Z))
+    {
+      // Frees allocated memory
+      free(Z);
+    }
     
     return TRUE;
   }
@@ -2214,3 +1427,76 @@ uint8_t complex_print(Complex Z, PRINT_FORMAT format)
   return TRUE;
 }
 
+
+/**
+@brief  Starts arena mode in the calling thread
+@param  none
+@retval none
+*/
+void complex_arena_begin(void)
+{
+  complex_depth++;
+}
+
+/**
+@brief  Ends arena mode and releases every complex created inside it
+@param  none
+@retval TRUE if an arena was active, FALSE otherwise
+*/
+uint8_t complex_arena_end(void)
+{
+  t_complexChunk* C = NULL;
+  
+  if(complex_depth == 0)
+  {
+    return FALSE;
+  }
+  
+  // Outermost level releases all chunks at once
+  if(--complex_depth == 0)
+  {
+    while(complex_chunks != NULL)
+    {
+      C = complex_chunks;
+      complex_chunks = C->next;
+      free(C);
+    }
+    
+    complex_stats.reserved = 0;
+  }
+  
+  return TRUE;
+}
+
+/**
+@brief  Gets arena statistics of the calling thread
+@param  S: Pointer to statistics structure
+@retval TRUE if statistics were copied, FALSE otherwise
+*/
+uint8_t complex_arena_stats(t_complexArenaStats* S)
+{
+  if(S == NULL)
+  {
+    return FALSE;
+  }
+  
+  *S = complex_stats;
+  
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------//
+//                              Instantiations                                //
+//----------------------------------------------------------------------------//
+
+// Double precision by-value API (cval_*): same template as the float / long
+// double variants, so every precision shares one set of branch cuts
+#define CT_REAL double
+#define CT_S
+#define CT_PI   3.14159265358979323846
+#define CT_VALUE_ONLY
+#include"ADT_ComplexTemplate.inc"
+#undef CT_REAL
+#undef CT_S
+#undef CT_PI
+#undef CT_VALUE_ONLY
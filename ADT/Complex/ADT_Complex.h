@@ -4,8 +4,8 @@
  * Filename      : ADT_Complex.h
  * Description   : Abstract Data Type for complex numbers.
  * Version       : 01.00
- * Revision      : 10
- * Last modified : 01/12/2021
+ * Revision      : 13
+ * Last modified : 10/18/2026
  * -----------------------------------------------------------------------------
  */
 
@@ -32,6 +32,26 @@
 // Pi
 #define PI (double)(3.141592653)
 
+// 2*Pi (full precision, used by root tables)
+#define TWO_PI (double)(6.28318530717958647692)
+
+// Max. |n| for which complex_power uses binary exponentiation
+#define INT_POWER_MAX (double)(1048576)
+
+// Complex numbers in the first arena chunk (next chunks double in size)
+#define COMPLEX_ARENA_CHUNK (size_t)(1024)
+
+// Precision-generic template names (ADT_ComplexTemplate.h / .inc): CT_S is
+// the precision suffix (f, l, q or empty for double)
+#define CT_CAT_(a, b, c) a##b##c
+#define CT_CAT(a, b, c)  CT_CAT_(a, b, c)
+#define CT_T             CT_CAT(t_complex, CT_S, )
+#define CT_P             CT_CAT(Complex, CT_S, )
+#define CT_HT            CT_CAT(t_ComplexHandler, CT_S, )
+#define CT_H             CT_CAT(Cmplx, CT_S, _Hdlr)
+#define CT_FN(name)      CT_CAT(complex, CT_S, _##name)
+#define CT_VAL(name)     CT_CAT(cval, CT_S, _##name)
+
 //----------------------------------------------------------------------------//
 //                            General definitions                             //
 //----------------------------------------------------------------------------//
@@ -92,6 +112,7 @@ typedef struct complex_handler
   Complex  (*exp)(Complex Z);                             // Natural exponential
   Complex  (*sqrt)(Complex Z);                            // Square root
   Complex  (*nthroot)(Complex Z, uint8_t n);              // Nth complex root
+  uint8_t  (*allroots)(Complex Z, uint8_t n, Complex R);  // All nth roots
   Complex  (*log)(Complex Z);                             // Natural logarithm
   Complex  (*logn)(Complex Z, uint8_t n);                 // Base-n logarithm
   Complex  (*sin)(Complex Z);                             // Sin(Z)
@@ -124,6 +145,16 @@ t_ComplexHandler;
 
 extern t_ComplexHandler Cmplx_Hdlr;
 
+// Arena statistics (per thread, cumulative)
+typedef struct complex_arena_stats
+{
+  uint64_t objects;    // Complex numbers served from arenas
+  uint64_t bytes;      // Bytes served from arenas
+  uint64_t chunks;     // Chunks allocated
+  uint64_t reserved;   // Bytes currently reserved by the active arena
+}
+t_complexArenaStats;
+
 //----------------------------------------------------------------------------//
 //                              Public functions                              //
 //----------------------------------------------------------------------------//
@@ -238,6 +269,8 @@ extern Complex complex_reciprocal(Complex Z);
 @param  Z: Pointer to complex
         n: Real exponential
 @retval Complex power
+@note Integer exponents (|n| <= INT_POWER_MAX) are computed by binary
+      exponentiation on Cartesian components, with no trigonometric calls
 */
 extern Complex complex_power(Complex Z, double n);
 
@@ -262,6 +295,17 @@ extern Complex complex_sqrt(Complex Z);
 */
 extern Complex complex_nthroot(Complex Z, uint8_t n);
 
+/**
+@brief  Calculates all the Nth roots of a complex number
+@param  Z: Pointer to complex
+        n: Root index
+        R: Output buffer (n contiguous complex values, R[k] = kth root)
+@retval TRUE if roots were calculated, FALSE otherwise
+@note One trigonometric evaluation for the principal root, the remaining roots
+      are obtained by rotation with exp(2*pi*i/n)
+*/
+extern uint8_t complex_allroots(Complex Z, uint8_t n, Complex R);
+
 /**
 @brief  Calculates the natural logarithm of a complex number
 @param  Z: Pointer to complex
@@ -445,6 +489,22 @@ extern Complex complex_hyperbolic_arcsecant(Complex Z);
 */
 extern Complex complex_hyperbolic_arccotangent(Complex Z);
 
+/**
+@brief  Calculates the complex number modulus
+@param  Z: Complex number
+@retval none
+@note Needed by modules writing Real / Imag fields of t_complex buffers directly
+*/
+extern void complex_modulus(Complex Z);
+
+/**
+@brief  Calculates the complex number argument
+@param  Z: Complex number
+@retval none
+@note Modulus must be updated first. Argument is calculated in radians
+*/
+extern void complex_argument(Complex Z);
+
 /**
 @brief  Deletes complex and frees allocated memory
 @param  Z: Pointer to complex
@@ -464,5 +524,41 @@ extern uint8_t complex_delete(Complex Z);
 */
 extern uint8_t complex_print(Complex Z, PRINT_FORMAT format);
 
+/**
+@brief  Starts arena mode in the calling thread
+@param  none
+@retval none
+@note   While active, complex_create (and every handler operation) takes its
+        memory from a thread-local bump region and complex_delete on those
+        numbers is a no-op. Calls may be nested; memory is released by the
+        outermost complex_arena_end
+*/
+extern void complex_arena_begin(void);
+
+/**
+@brief  Ends arena mode and releases every complex created inside it
+@param  none
+@retval TRUE if an arena was active, FALSE otherwise
+@note   Numbers created in the arena must not be used after this call
+*/
+extern uint8_t complex_arena_end(void);
+
+/**
+@brief  Gets arena statistics of the calling thread
+@param  S: Pointer to statistics structure
+@retval TRUE if statistics were copied, FALSE otherwise
+*/
+extern uint8_t complex_arena_stats(t_complexArenaStats* S);
+
+// By-value API (cval_*), generated from the same template as the float and
+// long double variants of ADT_ComplexGeneric.h
+#define CT_REAL double
+#define CT_S
+#define CT_VALUE_ONLY
+#include"ADT_ComplexTemplate.h"
+#undef CT_REAL
+#undef CT_S
+#undef CT_VALUE_ONLY
+
 #endif
 
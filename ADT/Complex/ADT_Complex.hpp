@@ -0,0 +1,468 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_Complex.hpp
+ * Description   : C++ wrapper for complex ADT (header-only, C++14).
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _COMPLEX_HPP_
+#define _COMPLEX_HPP_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<complex>
+#include<type_traits>
+
+extern "C"
+{
+#include"ADT_ComplexGeneric.h"
+}
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+namespace adt
+{
+
+template<typename T> class complex;
+
+// Plain value of an evaluated expression node
+template<typename T>
+struct value
+{
+  T re;
+  T im;
+};
+
+// C types and functions for each precision
+template<typename T> struct c_traits;
+
+template<>
+struct c_traits<double>
+{
+  typedef t_complex type;
+  typedef Complex   handle;
+  static type make(double re, double im) { return cval_make(re, im); }
+  static const t_ComplexHandler& hdlr() { return Cmplx_Hdlr; }
+  static type polar(type z) { return cval_polar(z); }
+  static type exp(type z)  { return cval_exp(z); }
+  static type log(type z)  { return cval_log(z); }
+  static type sqrt(type z) { return cval_sqrt(z); }
+  static type pow(type z, double n) { return cval_pow(z, n); }
+  static type sin(type z)  { return cval_sin(z); }
+  static type cos(type z)  { return cval_cos(z); }
+  static type tan(type z)  { return cval_tan(z); }
+  static type sinh(type z) { return cval_sinh(z); }
+  static type cosh(type z) { return cval_cosh(z); }
+  static type tanh(type z) { return cval_tanh(z); }
+};
+
+template<>
+struct c_traits<float>
+{
+  typedef t_complexf type;
+  typedef Complexf   handle;
+  static type make(float re, float im) { return cvalf_make(re, im); }
+  static const t_ComplexHandlerf& hdlr() { return Cmplxf_Hdlr; }
+  static type polar(type z) { return cvalf_polar(z); }
+  static type exp(type z)  { return cvalf_exp(z); }
+  static type log(type z)  { return cvalf_log(z); }
+  static type sqrt(type z) { return cvalf_sqrt(z); }
+  static type pow(type z, float n) { return cvalf_pow(z, n); }
+  static type sin(type z)  { return cvalf_sin(z); }
+  static type cos(type z)  { return cvalf_cos(z); }
+  static type tan(type z)  { return cvalf_tan(z); }
+  static type sinh(type z) { return cvalf_sinh(z); }
+  static type cosh(type z) { return cvalf_cosh(z); }
+  static type tanh(type z) { return cvalf_tanh(z); }
+};
+
+template<>
+struct c_traits<long double>
+{
+  typedef t_complexl type;
+  typedef Complexl   handle;
+  static type make(long double re, long double im) { return cvall_make(re, im); }
+  static const t_ComplexHandlerl& hdlr() { return Cmplxl_Hdlr; }
+  static type polar(type z) { return cvall_polar(z); }
+  static type exp(type z)  { return cvall_exp(z); }
+  static type log(type z)  { return cvall_log(z); }
+  static type sqrt(type z) { return cvall_sqrt(z); }
+  static type pow(type z, long double n) { return cvall_pow(z, n); }
+  static type sin(type z)  { return cvall_sin(z); }
+  static type cos(type z)  { return cvall_cos(z); }
+  static type tan(type z)  { return cvall_tan(z); }
+  static type sinh(type z) { return cvall_sinh(z); }
+  static type cosh(type z) { return cvall_cosh(z); }
+  static type tanh(type z) { return cvall_tanh(z); }
+};
+
+//----------------------------------------------------------------------------//
+//                            Expression templates                            //
+//----------------------------------------------------------------------------//
+
+// Base of every expression: E is the node type, T the precision. A node is
+// evaluated once through eval(), so nested expressions never recompute a
+// subtree and never materialize a complex object. Nodes hold their operands
+// by value, leaves included (a complex is two reals): an expression kept
+// with auto stays valid after the temporaries it was built from are gone
+template<typename E, typename T>
+struct expr
+{
+  typedef T real_type;
+
+  constexpr const E& self() const { return static_cast<const E&>(*this); }
+  constexpr value<T> eval() const { return self().eval(); }
+};
+
+// Scalar operand: T is taken from the expression only, so any arithmetic type
+// converts (z * 2, zf * 2.0)
+template<typename T>
+struct scalar
+{
+  typedef T type;
+};
+
+// Binary nodes
+template<typename L, typename R, typename T>
+struct add_expr : expr<add_expr<L, R, T>, T>
+{
+  const L l;
+  const R r;
+
+  constexpr add_expr(const L& a, const R& b) : l(a), r(b) {}
+
+  constexpr value<T> eval() const
+  {
+    value<T> a = l.eval(), b = r.eval();
+
+    return value<T>{ a.re + b.re, a.im + b.im };
+  }
+};
+
+template<typename L, typename R, typename T>
+struct sub_expr : expr<sub_expr<L, R, T>, T>
+{
+  const L l;
+  const R r;
+
+  constexpr sub_expr(const L& a, const R& b) : l(a), r(b) {}
+
+  constexpr value<T> eval() const
+  {
+    value<T> a = l.eval(), b = r.eval();
+
+    return value<T>{ a.re - b.re, a.im - b.im };
+  }
+};
+
+template<typename L, typename R, typename T>
+struct mul_expr : expr<mul_expr<L, R, T>, T>
+{
+  const L l;
+  const R r;
+
+  constexpr mul_expr(const L& a, const R& b) : l(a), r(b) {}
+
+  constexpr value<T> eval() const
+  {
+    value<T> a = l.eval(), b = r.eval();
+
+    return value<T>{ a.re * b.re - a.im * b.im, a.re * b.im + a.im * b.re };
+  }
+};
+
+template<typename L, typename R, typename T>
+struct div_expr : expr<div_expr<L, R, T>, T>
+{
+  const L l;
+  const R r;
+
+  constexpr div_expr(const L& a, const R& b) : l(a), r(b) {}
+
+  constexpr value<T> eval() const
+  {
+    value<T> a = l.eval(), b = r.eval();
+    T m = b.re * b.re + b.im * b.im;
+
+    return value<T>{ (a.re * b.re + a.im * b.im) / m,
+                     (a.im * b.re - a.re * b.im) / m };
+  }
+};
+
+// Unary nodes
+template<typename E, typename T>
+struct scale_expr : expr<scale_expr<E, T>, T>
+{
+  const E e;
+  T k;
+
+  constexpr scale_expr(const E& a, T s) : e(a), k(s) {}
+
+  constexpr value<T> eval() const
+  {
+    value<T> a = e.eval();
+
+    return value<T>{ k * a.re, k * a.im };
+  }
+};
+
+template<typename E, typename T>
+struct conj_expr : expr<conj_expr<E, T>, T>
+{
+  const E e;
+
+  constexpr explicit conj_expr(const E& a) : e(a) {}
+
+  constexpr value<T> eval() const
+  {
+    value<T> a = e.eval();
+
+    return value<T>{ a.re, -a.im };
+  }
+};
+
+template<typename E, typename T>
+struct neg_expr : expr<neg_expr<E, T>, T>
+{
+  const E e;
+
+  constexpr explicit neg_expr(const E& a) : e(a) {}
+
+  constexpr value<T> eval() const
+  {
+    value<T> a = e.eval();
+
+    return value<T>{ -a.re, -a.im };
+  }
+};
+
+//----------------------------------------------------------------------------//
+//                                Complex class                               //
+//----------------------------------------------------------------------------//
+
+template<typename T>
+class complex : public expr<complex<T>, T>
+{
+  static_assert(std::is_floating_point<T>::value,
+                "adt::complex<T> requires float, double or long double");
+
+public:
+  typedef typename c_traits<T>::type   c_type;
+  typedef typename c_traits<T>::handle c_handle;
+
+  // Construction
+  constexpr complex(T re = T(0), T im = T(0)) : re_(re), im_(im) {}
+
+  // Evaluates a whole expression in a single pass
+  template<typename E>
+  constexpr complex(const expr<E, T>& e) : complex(e.eval()) {}
+
+  constexpr complex(const value<T>& v) : re_(v.re), im_(v.im) {}
+
+  template<typename E>
+  constexpr complex& operator=(const expr<E, T>& e)
+  {
+    value<T> v = e.eval();
+    re_ = v.re;
+    im_ = v.im;
+
+    return *this;
+  }
+
+  // Interop with std::complex
+  constexpr complex(const std::complex<T>& z) : re_(z.real()), im_(z.imag()) {}
+  operator std::complex<T>() const { return std::complex<T>(re_, im_); }
+
+  // Interop with the C ADT: c() with polar components, cval() Cartesian only
+  // (by-value arithmetic), handle() allocated
+  constexpr complex(const c_type& z) : re_(z.Real), im_(z.Imag) {}
+  c_type c() const { return c_traits<T>::polar( cval() ); }
+  c_type cval() const { return c_traits<T>::make(re_, im_); }
+  c_handle handle() const { return c_traits<T>::hdlr().init(re_, im_); }
+
+  // Access
+  constexpr T real() const { return re_; }
+  constexpr T imag() const { return im_; }
+  constexpr value<T> eval() const { return value<T>{ re_, im_ }; }
+
+  // Compound assignment
+  template<typename E>
+  constexpr complex& operator+=(const expr<E, T>& e)
+  {
+    value<T> v = e.eval();
+    re_ += v.re;
+    im_ += v.im;
+
+    return *this;
+  }
+
+  template<typename E>
+  constexpr complex& operator-=(const expr<E, T>& e)
+  {
+    value<T> v = e.eval();
+    re_ -= v.re;
+    im_ -= v.im;
+
+    return *this;
+  }
+
+  template<typename E>
+  constexpr complex& operator*=(const expr<E, T>& e)
+  {
+    value<T> v = e.eval();
+    T t = re_ * v.re - im_ * v.im;
+    im_ = re_ * v.im + im_ * v.re;
+    re_ = t;
+
+    return *this;
+  }
+
+  constexpr complex& operator*=(T k)
+  {
+    re_ *= k;
+    im_ *= k;
+
+    return *this;
+  }
+
+private:
+  T re_;
+  T im_;
+};
+
+//----------------------------------------------------------------------------//
+//                                 Operators                                  //
+//----------------------------------------------------------------------------//
+
+template<typename L, typename R, typename T>
+constexpr add_expr<L, R, T> operator+(const expr<L, T>& a, const expr<R, T>& b)
+{
+  return add_expr<L, R, T>(a.self(), b.self());
+}
+
+template<typename L, typename R, typename T>
+constexpr sub_expr<L, R, T> operator-(const expr<L, T>& a, const expr<R, T>& b)
+{
+  return sub_expr<L, R, T>(a.self(), b.self());
+}
+
+template<typename L, typename R, typename T>
+constexpr mul_expr<L, R, T> operator*(const expr<L, T>& a, const expr<R, T>& b)
+{
+  return mul_expr<L, R, T>(a.self(), b.self());
+}
+
+template<typename L, typename R, typename T>
+constexpr div_expr<L, R, T> operator/(const expr<L, T>& a, const expr<R, T>& b)
+{
+  return div_expr<L, R, T>(a.self(), b.self());
+}
+
+template<typename E, typename T>
+constexpr scale_expr<E, T> operator*(const expr<E, T>& a,
+                                     typename scalar<T>::type k)
+{
+  return scale_expr<E, T>(a.self(), k);
+}
+
+template<typename E, typename T>
+constexpr scale_expr<E, T> operator*(typename scalar<T>::type k,
+                                     const expr<E, T>& a)
+{
+  return scale_expr<E, T>(a.self(), k);
+}
+
+template<typename E, typename T>
+constexpr scale_expr<E, T> operator/(const expr<E, T>& a,
+                                     typename scalar<T>::type k)
+{
+  return scale_expr<E, T>(a.self(), T(1) / k);
+}
+
+template<typename E, typename T>
+constexpr neg_expr<E, T> operator-(const expr<E, T>& a)
+{
+  return neg_expr<E, T>(a.self());
+}
+
+template<typename E, typename T>
+constexpr conj_expr<E, T> conj(const expr<E, T>& a)
+{
+  return conj_expr<E, T>(a.self());
+}
+
+template<typename L, typename R, typename T>
+constexpr bool operator==(const expr<L, T>& a, const expr<R, T>& b)
+{
+  value<T> u = a.eval(), v = b.eval();
+
+  return u.re == v.re && u.im == v.im;
+}
+
+template<typename L, typename R, typename T>
+constexpr bool operator!=(const expr<L, T>& a, const expr<R, T>& b)
+{
+  return !(a == b);
+}
+
+//----------------------------------------------------------------------------//
+//                         Functions (C ADT backend)                          //
+//----------------------------------------------------------------------------//
+
+template<typename E, typename T>
+constexpr T norm(const expr<E, T>& a)
+{
+  value<T> v = a.eval();
+
+  return v.re * v.re + v.im * v.im;
+}
+
+template<typename E, typename T>
+T abs(const expr<E, T>& a)
+{
+  return complex<T>(a).c().Mod;
+}
+
+template<typename E, typename T>
+T arg(const expr<E, T>& a)
+{
+  return complex<T>(a).c().Arg;
+}
+
+// Transcendental functions forward to the by-value C API of the same precision
+#define ADT_COMPLEX_FUNCTION(fn)                                              \
+  template<typename E, typename T>                                            \
+  complex<T> fn(const expr<E, T>& a)                                          \
+  {                                                                           \
+    return complex<T>( c_traits<T>::fn( complex<T>(a).cval() ) );            \
+  }
+
+ADT_COMPLEX_FUNCTION(exp)
+ADT_COMPLEX_FUNCTION(log)
+ADT_COMPLEX_FUNCTION(sqrt)
+ADT_COMPLEX_FUNCTION(sin)
+ADT_COMPLEX_FUNCTION(cos)
+ADT_COMPLEX_FUNCTION(tan)
+ADT_COMPLEX_FUNCTION(sinh)
+ADT_COMPLEX_FUNCTION(cosh)
+ADT_COMPLEX_FUNCTION(tanh)
+
+#undef ADT_COMPLEX_FUNCTION
+
+template<typename E, typename T>
+complex<T> pow(const expr<E, T>& a, typename scalar<T>::type n)
+{
+  return complex<T>( c_traits<T>::pow(complex<T>(a).cval(), n) );
+}
+
+} // namespace adt
+
+#endif
@@ -0,0 +1,51 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_ComplexGeneric.c
+ * Description   : Single and extended precision complex numbers. Library file.
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_ComplexGeneric.h"
+
+//----------------------------------------------------------------------------//
+//                              Instantiations                                //
+//----------------------------------------------------------------------------//
+
+// Single precision
+#define CT_REAL float
+#define CT_S    f
+#define CT_PI   3.14159265358979323846f
+#include"ADT_ComplexTemplate.inc"
+#undef CT_REAL
+#undef CT_S
+#undef CT_PI
+
+// Extended precision
+#define CT_REAL long double
+#define CT_S    l
+#define CT_PI   3.14159265358979323846264338327950288L
+#include"ADT_ComplexTemplate.inc"
+#undef CT_REAL
+#undef CT_S
+#undef CT_PI
+
+// Quadruple precision
+#ifdef COMPLEX_QUAD
+#define CT_REAL __float128
+#define CT_S    q
+#define CT_PI   M_PIq
+#include"ADT_ComplexTemplate.inc"
+#undef CT_REAL
+#undef CT_S
+#undef CT_PI
+#endif
+
+// Double precision by-value API: instantiated by ADT_Complex.c
@@ -0,0 +1,55 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_ComplexGeneric.h
+ * Description   : Single and extended precision complex numbers. Header file.
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _COMPLEX_GENERIC_H_
+#define _COMPLEX_GENERIC_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Complex.h"
+
+#ifdef COMPLEX_QUAD
+#include<quadmath.h>
+#endif
+
+//----------------------------------------------------------------------------//
+//                              Instantiations                                //
+//----------------------------------------------------------------------------//
+
+// Single precision: t_complexf, Complexf, Cmplxf_Hdlr, complexf_*, cvalf_*
+#define CT_REAL float
+#define CT_S    f
+#include"ADT_ComplexTemplate.h"
+#undef CT_REAL
+#undef CT_S
+
+// Extended precision: t_complexl, Complexl, Cmplxl_Hdlr, complexl_*, cvall_*
+#define CT_REAL long double
+#define CT_S    l
+#include"ADT_ComplexTemplate.h"
+#undef CT_REAL
+#undef CT_S
+
+// Quadruple precision (GCC, link with -lquadmath): t_complexq, Cmplxq_Hdlr...
+#ifdef COMPLEX_QUAD
+#define CT_REAL __float128
+#define CT_S    q
+#include"ADT_ComplexTemplate.h"
+#undef CT_REAL
+#undef CT_S
+#endif
+
+// Double precision (t_complex, Cmplx_Hdlr, cval_*) is declared by
+// ADT_Complex.h
+
+#endif
@@ -0,0 +1,188 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_ComplexTemplate.h
+ * Description   : Precision-generic complex ADT. Declaration template.
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+// No include guard: instantiated once per precision by ADT_ComplexGeneric.h
+// (float, long double, quad) and ADT_Complex.h (double by-value API) with
+// CT_REAL (floating type) and CT_S (name suffix) defined.
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+#ifndef CT_VALUE_ONLY
+
+typedef struct
+{
+  CT_REAL Real;   // Real part
+  CT_REAL Imag;   // Imaginary part
+  CT_REAL Mod;    // Modulus
+  CT_REAL Arg;    // Argument
+}
+CT_T;
+
+typedef CT_T* CT_P;
+
+// Complex number handler
+typedef struct
+{
+  CT_P     (*init)(CT_REAL Real, CT_REAL Imag);           // Create complex
+  uint8_t  (*isNull)(CT_P Z);                             // Is a null complex?
+  uint8_t  (*areEqual)(CT_P Z1, CT_P Z2);                 // Z1 == Z2?
+  CT_REAL  (*modulus)(CT_P Z);                            // Get modulus
+  CT_REAL  (*argument)(CT_P Z, ANGLE_UNIT arg);           // Get argument
+  uint8_t  (*update)(CT_P Z, CT_REAL val, COMPONENT c);   // Update element
+  CT_P     (*conjugate)(CT_P Z);                          // Conjugate
+  CT_P     (*sum)(CT_P Z1, CT_P Z2);                      // Sum
+  CT_P     (*sub)(CT_P Z1, CT_P Z2);                      // Subtraction
+  CT_P     (*product)(CT_P Z1, CT_P Z2);                  // Complex product
+  CT_P     (*scalar)(CT_P Z, CT_REAL k);                  // Scalar product
+  CT_P     (*division)(CT_P Z1, CT_P Z2);                 // Division
+  CT_P     (*inv)(CT_P Z);                                // Reciprocal
+  CT_P     (*pow)(CT_P Z, CT_REAL n);                     // Real power
+  CT_P     (*exp)(CT_P Z);                                // Natural exponential
+  CT_P     (*sqrt)(CT_P Z);                               // Square root
+  CT_P     (*nthroot)(CT_P Z, uint8_t n);                 // Nth complex root
+  uint8_t  (*allroots)(CT_P Z, uint8_t n, CT_P R);        // All nth roots
+  CT_P     (*log)(CT_P Z);                                // Natural logarithm
+  CT_P     (*logn)(CT_P Z, uint8_t n);                    // Base-n logarithm
+  CT_P     (*sin)(CT_P Z);                                // Sin(Z)
+  CT_P     (*cos)(CT_P Z);                                // Cos(Z)
+  CT_P     (*tan)(CT_P Z);                                // Tan(Z)
+  CT_P     (*csc)(CT_P Z);                                // Csc(Z)
+  CT_P     (*sec)(CT_P Z);                                // Sec(Z)
+  CT_P     (*cot)(CT_P Z);                                // Cot(Z)
+  CT_P     (*asin)(CT_P Z);                               // Asin(Z)
+  CT_P     (*acos)(CT_P Z);                               // Acos(Z)
+  CT_P     (*atan)(CT_P Z);                               // Atan(Z)
+  CT_P     (*acsc)(CT_P Z);                               // Acsc(Z)
+  CT_P     (*asec)(CT_P Z);                               // Asec(Z)
+  CT_P     (*acot)(CT_P Z);                               // Acot(Z)
+  CT_P     (*sinh)(CT_P Z);                               // Sinh(Z)
+  CT_P     (*cosh)(CT_P Z);                               // Cosh(Z)
+  CT_P     (*tanh)(CT_P Z);                               // Tanh(Z)
+  CT_P     (*csch)(CT_P Z);                               // Csch(Z)
+  CT_P     (*sech)(CT_P Z);                               // Sech(Z)
+  CT_P     (*coth)(CT_P Z);                               // Coth(Z)
+  CT_P     (*asinh)(CT_P Z);                              // Asinh(Z)
+  CT_P     (*acosh)(CT_P Z);                              // Acosh(Z)
+  CT_P     (*atanh)(CT_P Z);                              // Atanh(Z)
+  CT_P     (*acsch)(CT_P Z);                              // Acsch(Z)
+  CT_P     (*asech)(CT_P Z);                              // Asech(Z)
+  CT_P     (*acoth)(CT_P Z);                              // Acoth(Z)
+  uint8_t  (*del)(CT_P Z);                                // Delete complex
+}
+CT_HT;
+
+extern CT_HT CT_H;
+
+//----------------------------------------------------------------------------//
+//                         Public functions (pointers)                        //
+//----------------------------------------------------------------------------//
+
+// Same contract as the double precision functions in ADT_Complex.h: results
+// are allocated, NULL is returned on invalid input or allocation error
+extern CT_P    CT_FN(create)(CT_REAL Real, CT_REAL Imag);
+extern uint8_t CT_FN(isNull)(CT_P Z);
+extern uint8_t CT_FN(areEqual)(CT_P Z1, CT_P Z2);
+extern CT_REAL CT_FN(getModulus)(CT_P Z);
+extern CT_REAL CT_FN(getArgument)(CT_P Z, ANGLE_UNIT arg);
+extern uint8_t CT_FN(update)(CT_P Z, CT_REAL val, COMPONENT c);
+extern CT_P    CT_FN(conjugate)(CT_P Z);
+extern CT_P    CT_FN(sum)(CT_P Z1, CT_P Z2);
+extern CT_P    CT_FN(subtraction)(CT_P Z1, CT_P Z2);
+extern CT_P    CT_FN(product)(CT_P Z1, CT_P Z2);
+extern CT_P    CT_FN(scalar)(CT_P Z, CT_REAL k);
+extern CT_P    CT_FN(division)(CT_P Z1, CT_P Z2);
+extern CT_P    CT_FN(reciprocal)(CT_P Z);
+extern CT_P    CT_FN(power)(CT_P Z, CT_REAL n);
+extern CT_P    CT_FN(exp)(CT_P Z);
+extern CT_P    CT_FN(sqrt)(CT_P Z);
+extern CT_P    CT_FN(nthroot)(CT_P Z, uint8_t n);
+extern uint8_t CT_FN(allroots)(CT_P Z, uint8_t n, CT_P R);
+extern CT_P    CT_FN(log)(CT_P Z);
+extern CT_P    CT_FN(logn)(CT_P Z, uint8_t n);
+extern CT_P    CT_FN(sine)(CT_P Z);
+extern CT_P    CT_FN(cosine)(CT_P Z);
+extern CT_P    CT_FN(tangent)(CT_P Z);
+extern CT_P    CT_FN(cosecant)(CT_P Z);
+extern CT_P    CT_FN(secant)(CT_P Z);
+extern CT_P    CT_FN(cotangent)(CT_P Z);
+extern CT_P    CT_FN(arcsine)(CT_P Z);
+extern CT_P    CT_FN(arccosine)(CT_P Z);
+extern CT_P    CT_FN(arctangent)(CT_P Z);
+extern CT_P    CT_FN(arccosecant)(CT_P Z);
+extern CT_P    CT_FN(arcsecant)(CT_P Z);
+extern CT_P    CT_FN(arccotangent)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_sine)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_cosine)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_tangent)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_cosecant)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_secant)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_cotangent)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_arcsine)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_arccosine)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_arctangent)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_arccosecant)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_arcsecant)(CT_P Z);
+extern CT_P    CT_FN(hyperbolic_arccotangent)(CT_P Z);
+extern uint8_t CT_FN(delete)(CT_P Z);
+extern uint8_t CT_FN(print)(CT_P Z, PRINT_FORMAT format);
+
+#endif
+
+//----------------------------------------------------------------------------//
+//                         Public functions (by value)                        //
+//----------------------------------------------------------------------------//
+
+// Allocation-free API: operands and results are passed by value. Domain
+// errors follow IEEE 754 (inf / nan) instead of returning NULL. Results carry
+// Cartesian components only (Mod / Arg are NaN): CT_VAL(polar) fills them
+extern CT_T    CT_VAL(make)(CT_REAL Real, CT_REAL Imag);
+extern CT_T    CT_VAL(polar)(CT_T z);
+extern uint8_t CT_VAL(isNull)(CT_T z);
+extern uint8_t CT_VAL(areEqual)(CT_T z1, CT_T z2);
+extern CT_T    CT_VAL(conj)(CT_T z);
+extern CT_T    CT_VAL(sum)(CT_T z1, CT_T z2);
+extern CT_T    CT_VAL(sub)(CT_T z1, CT_T z2);
+extern CT_T    CT_VAL(product)(CT_T z1, CT_T z2);
+extern CT_T    CT_VAL(scalar)(CT_T z, CT_REAL k);
+extern CT_T    CT_VAL(division)(CT_T z1, CT_T z2);
+extern CT_T    CT_VAL(inv)(CT_T z);
+extern CT_T    CT_VAL(pow)(CT_T z, CT_REAL n);
+extern CT_T    CT_VAL(exp)(CT_T z);
+extern CT_T    CT_VAL(sqrt)(CT_T z);
+extern CT_T    CT_VAL(nthroot)(CT_T z, uint8_t n);
+extern CT_T    CT_VAL(log)(CT_T z);
+extern CT_T    CT_VAL(logn)(CT_T z, uint8_t n);
+extern CT_T    CT_VAL(sin)(CT_T z);
+extern CT_T    CT_VAL(cos)(CT_T z);
+extern CT_T    CT_VAL(tan)(CT_T z);
+extern CT_T    CT_VAL(csc)(CT_T z);
+extern CT_T    CT_VAL(sec)(CT_T z);
+extern CT_T    CT_VAL(cot)(CT_T z);
+extern CT_T    CT_VAL(asin)(CT_T z);
+extern CT_T    CT_VAL(acos)(CT_T z);
+extern CT_T    CT_VAL(atan)(CT_T z);
+extern CT_T    CT_VAL(acsc)(CT_T z);
+extern CT_T    CT_VAL(asec)(CT_T z);
+extern CT_T    CT_VAL(acot)(CT_T z);
+extern CT_T    CT_VAL(sinh)(CT_T z);
+extern CT_T    CT_VAL(cosh)(CT_T z);
+extern CT_T    CT_VAL(tanh)(CT_T z);
+extern CT_T    CT_VAL(csch)(CT_T z);
+extern CT_T    CT_VAL(sech)(CT_T z);
+extern CT_T    CT_VAL(coth)(CT_T z);
+extern CT_T    CT_VAL(asinh)(CT_T z);
+extern CT_T    CT_VAL(acosh)(CT_T z);
+extern CT_T    CT_VAL(atanh)(CT_T z);
+extern CT_T    CT_VAL(acsch)(CT_T z);
+extern CT_T    CT_VAL(asech)(CT_T z);
+extern CT_T    CT_VAL(acoth)(CT_T z);
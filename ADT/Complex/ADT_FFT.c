@@ -0,0 +1,777 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_FFT.c
+ * Description   : Fast Fourier Transform over complex buffers. Library file.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_FFT.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// FFT handler
+t_FFTHandler FFT_Hdlr =
+{
+  fft_plan_create,         // Complex plan
+  fft_plan_create_real,    // Real plan
+  fft_forward,             // Forward FFT
+  fft_inverse,             // Inverse FFT
+  fft_execute_split,       // Split FFT
+  fft_real_forward,        // Real FFT
+  fft_real_inverse,        // Real IFFT
+  fft_plan_delete          // Delete plan
+};
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Splits transform size into radix stages. Radix-4 stages are preferred,
+        then radix-2, 3, 5 and generic odd primes
+@param  P: Plan
+@retval TRUE if size was factorized, FALSE otherwise
+*/
+uint8_t fft_factorize(FFTPlan P)
+{
+  size_t n = P->N;   // Remaining size
+  size_t r = 0;      // Current radix
+
+  P->nFactors = 0;
+
+  while(n > 1)
+  {
+    if(n % 4 == 0)
+    {
+      r = 4;
+    }
+    else if(n % 2 == 0)
+    {
+      r = 2;
+    }
+    else
+    {
+      // Smallest odd prime factor
+      for(r = 3; r * r <= n && n % r != 0; r += 2);
+
+      if(n % r != 0)
+      {
+        r = n;
+      }
+    }
+
+    if(P->nFactors == FFT_MAX_FACTORS)
+    {
+      return FALSE;
+    }
+
+    P->factors[P->nFactors++] = r;
+    n /= r;
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Deletes Bluestein stage data
+@param  C: Pointer to stage data
+@retval none
+*/
+void fft_chirp_delete(t_fftChirp* C)
+{
+  if(C != NULL)
+  {
+    free(C->bRe);
+    free(C->bIm);
+    free(C->vRe[0]);
+    free(C->vIm[0]);
+    free(C->vRe[1]);
+    free(C->vIm[1]);
+    free(C->uRe);
+    free(C->uIm);
+
+    if(C->conv != NULL)
+    {
+      fft_plan_delete(C->conv);
+    }
+
+    free(C);
+  }
+}
+
+/**
+@brief  Creates Bluestein data for a prime radix r: with the chirp
+        b_n = exp(i*d*pi*n^2/r), a length-r DFT of sign d is
+        X_k = b_k * sum_j (a_j b_j) conj(b_(k-j)), a cyclic convolution of
+        power-of-two size M >= 2r - 1
+@param  r: Prime radix
+@retval Pointer to stage data, NULL on memory error
+*/
+t_fftChirp* fft_chirp_create(size_t r)
+{
+  t_fftChirp* C = NULL;   // New stage data
+  size_t M = 1;           // Convolution size
+  size_t n = 0, d = 0;    // Iterators
+
+  while(M < 2 * r - 1)
+  {
+    M *= 2;
+  }
+
+  C = (t_fftChirp*)calloc( 1, sizeof(t_fftChirp) );
+
+  if(C == NULL)
+  {
+    return NULL;
+  }
+
+  C->r = r;
+  C->bRe = (double*)malloc( r * sizeof(double) );
+  C->bIm = (double*)malloc( r * sizeof(double) );
+  C->uRe = (double*)malloc( M * sizeof(double) );
+  C->uIm = (double*)malloc( M * sizeof(double) );
+  C->conv = fft_plan_create(M);
+
+  for(d = 0; d < 2; d++)
+  {
+    C->vRe[d] = (double*)calloc( M, sizeof(double) );
+    C->vIm[d] = (double*)calloc( M, sizeof(double) );
+  }
+
+  if(C->bRe == NULL || C->bIm == NULL || C->uRe == NULL || C->uIm == NULL ||
+     C->conv == NULL || C->vRe[0] == NULL || C->vIm[0] == NULL ||
+     C->vRe[1] == NULL || C->vIm[1] == NULL)
+  {
+    fft_chirp_delete(C);
+
+    return NULL;
+  }
+
+  // Angle pi*n^2/r reduced modulo 2*pi before scaling (exact for n < r)
+  for(n = 0; n < r; n++)
+  {
+    double a = TWO_PI * (double)( (n * n) % (2 * r) ) / (double)(2 * r);
+
+    C->bRe[n] = cos(a);
+    C->bIm[n] = sin(a);
+  }
+
+  // conj(b_n) of sign d, wrapped to negative lags, and its spectrum
+  for(d = 0; d < 2; d++)
+  {
+    double sign = (d == 0) ? -1.0 : 1.0;
+
+    for(n = 0; n < r; n++)
+    {
+      C->vRe[d][n] = C->bRe[n];
+      C->vIm[d][n] = -sign * C->bIm[n];
+
+      if(n > 0)
+      {
+        C->vRe[d][M - n] = C->vRe[d][n];
+        C->vIm[d][M - n] = C->vIm[d][n];
+      }
+    }
+
+    fft_execute_split(C->conv, C->vRe[d], C->vIm[d], FFT_FORWARD);
+  }
+
+  return C;
+}
+
+/**
+@brief  Runs one Stockham autosort stage: x (length N) -> y (length N)
+@param  P:   Plan
+        r:   Stage radix
+        s:   Stride (product of previous radices)
+        C:   Bluestein data of the stage (NULL for a direct butterfly)
+        xr, xi: Input buffer
+        yr, yi: Output buffer
+        dir: Sign of twiddle imaginary parts (-1 forward, +1 inverse)
+@retval none
+@note Twiddle W_n^(pk), n = N/s, is read from the size-N table at index p*k*s
+*/
+void fft_stage(FFTPlan P, size_t r, size_t s, t_fftChirp* C,
+               const double* xr, const double* xi,
+               double* yr, double* yi, double dir)
+{
+  size_t N = P->N;            // Transform size
+  size_t m = N / (s * r);     // Butterflies per stride
+  size_t NR = N / r;          // Table step for W_r
+  const double* twRe = P->twRe;
+  const double* twIm = P->twIm;
+  size_t p = 0, q = 0;        // Iterators
+
+  if(r == 2)
+  {
+    #pragma omp parallel for collapse(2) if(N >= FFT_PARALLEL_MIN)
+    for(p = 0; p < m; p++)
+    {
+      for(q = 0; q < s; q++)
+      {
+        size_t i0 = q + s * p, i1 = i0 + s * m;
+        size_t o0 = q + s * 2 * p;
+        double wr = twRe[p * s], wi = dir * twIm[p * s];
+        double dr = xr[i0] - xr[i1], di = xi[i0] - xi[i1];
+
+        // y0 = a0 + a1, y1 = (a0 - a1) * W
+        yr[o0] = xr[i0] + xr[i1];
+        yi[o0] = xi[i0] + xi[i1];
+        yr[o0 + s] = dr * wr - di * wi;
+        yi[o0 + s] = dr * wi + di * wr;
+      }
+    }
+  }
+  else if(r == 4)
+  {
+    #pragma omp parallel for collapse(2) if(N >= FFT_PARALLEL_MIN)
+    for(p = 0; p < m; p++)
+    {
+      for(q = 0; q < s; q++)
+      {
+        size_t i0 = q + s * p, sm = s * m;
+        size_t o0 = q + s * 4 * p;
+        size_t t1 = p * s, t2 = 2 * t1, t3 = 3 * t1;
+        double b0r = xr[i0] + xr[i0 + 2 * sm], b0i = xi[i0] + xi[i0 + 2 * sm];
+        double b1r = xr[i0] - xr[i0 + 2 * sm], b1i = xi[i0] - xi[i0 + 2 * sm];
+        double b2r = xr[i0 + sm] + xr[i0 + 3 * sm];
+        double b2i = xi[i0 + sm] + xi[i0 + 3 * sm];
+        double dr = xr[i0 + sm] - xr[i0 + 3 * sm];
+        double di = xi[i0 + sm] - xi[i0 + 3 * sm];
+
+        // b3 = (a1 - a3) * W_4 (-i forward, +i inverse)
+        double b3r = -dir * di, b3i = dir * dr;
+        double cr = 0, ci = 0, wr = 0, wi = 0;
+
+        yr[o0] = b0r + b2r;
+        yi[o0] = b0i + b2i;
+
+        cr = b1r + b3r; ci = b1i + b3i;
+        wr = twRe[t1];  wi = dir * twIm[t1];
+        yr[o0 + s] = cr * wr - ci * wi;
+        yi[o0 + s] = cr * wi + ci * wr;
+
+        cr = b0r - b2r; ci = b0i - b2i;
+        wr = twRe[t2];  wi = dir * twIm[t2];
+        yr[o0 + 2 * s] = cr * wr - ci * wi;
+        yi[o0 + 2 * s] = cr * wi + ci * wr;
+
+        cr = b1r - b3r; ci = b1i - b3i;
+        wr = twRe[t3];  wi = dir * twIm[t3];
+        yr[o0 + 3 * s] = cr * wr - ci * wi;
+        yi[o0 + 3 * s] = cr * wi + ci * wr;
+      }
+    }
+  }
+  else if(C != NULL)
+  {
+    // Large prime radix: O(M log M) chirp-z per butterfly. Butterflies share
+    // the convolution buffer, so they run in sequence; the size-M
+    // transforms are threaded when M is large enough
+    size_t M = C->conv->N;
+    const double* vr = C->vRe[dir > 0];
+    const double* vi = C->vIm[dir > 0];
+    double* ur = C->uRe;
+    double* ui = C->uIm;
+
+    for(p = 0; p < m; p++)
+    {
+      for(q = 0; q < s; q++)
+      {
+        size_t j = 0, k = 0;
+
+        // u_j = a_j b_j, zero padded
+        for(j = 0; j < r; j++)
+        {
+          size_t i = q + s * (p + j * m);
+          double br = C->bRe[j], bi = dir * C->bIm[j];
+
+          ur[j] = xr[i] * br - xi[i] * bi;
+          ui[j] = xr[i] * bi + xi[i] * br;
+        }
+
+        for(j = r; j < M; j++)
+        {
+          ur[j] = 0;
+          ui[j] = 0;
+        }
+
+        fft_execute_split(C->conv, ur, ui, FFT_FORWARD);
+
+        for(j = 0; j < M; j++)
+        {
+          double cr = ur[j] * vr[j] - ui[j] * vi[j];
+
+          ui[j] = ur[j] * vi[j] + ui[j] * vr[j];
+          ur[j] = cr;
+        }
+
+        fft_execute_split(C->conv, ur, ui, FFT_INVERSE);
+
+        // X_k = b_k (u * conj b)_k, then stage twiddle
+        for(k = 0; k < r; k++)
+        {
+          double br = C->bRe[k], bi = dir * C->bIm[k];
+          double sr = ur[k] * br - ui[k] * bi;
+          double si = ur[k] * bi + ui[k] * br;
+          double wr = twRe[p * k * s], wi = dir * twIm[p * k * s];
+
+          yr[q + s * (r * p + k)] = sr * wr - si * wi;
+          yi[q + s * (r * p + k)] = sr * wi + si * wr;
+        }
+      }
+    }
+  }
+  else
+  {
+    // Generic radix: O(r^2) DFT per butterfly (3, 5 and odd primes)
+    #pragma omp parallel for collapse(2) if(N >= FFT_PARALLEL_MIN)
+    for(p = 0; p < m; p++)
+    {
+      for(q = 0; q < s; q++)
+      {
+        size_t j = 0, k = 0;
+
+        for(k = 0; k < r; k++)
+        {
+          double sr = 0, si = 0, wr = 0, wi = 0;
+
+          for(j = 0; j < r; j++)
+          {
+            size_t i = q + s * (p + j * m);
+            size_t t = ( (j * k) % r ) * NR;
+
+            wr = twRe[t];
+            wi = dir * twIm[t];
+            sr += xr[i] * wr - xi[i] * wi;
+            si += xr[i] * wi + xi[i] * wr;
+          }
+
+          wr = twRe[p * k * s];
+          wi = dir * twIm[p * k * s];
+          yr[q + s * (r * p + k)] = sr * wr - si * wi;
+          yi[q + s * (r * p + k)] = sr * wi + si * wr;
+        }
+      }
+    }
+  }
+}
+
+/**
+@brief  Runs all stages of a complex plan in place over split buffers
+@param  P:   Complex plan
+        re:  Real parts (N values)
+        im:  Imaginary parts (N values)
+        dir: Transform direction
+@retval none
+*/
+void fft_run(FFTPlan P, double* re, double* im, FFT_DIRECTION dir)
+{
+  double* xr = re;           // Stage input
+  double* xi = im;
+  double* yr = P->tmpRe;     // Stage output
+  double* yi = P->tmpIm;
+  double* aux = NULL;
+  double sign = (dir == FFT_FORWARD) ? -1.0 : 1.0;
+  double scale = 1.0 / (double)(P->N);
+  size_t s = 1;              // Stride
+  size_t i = 0;              // Iterator
+  uint8_t k = 0;
+
+  for(k = 0; k < P->nFactors; k++)
+  {
+    fft_stage(P, P->factors[k], s, P->chirp[k], xr, xi, yr, yi, sign);
+    s *= P->factors[k];
+
+    // Swaps ping-pong buffers
+    aux = xr; xr = yr; yr = aux;
+    aux = xi; xi = yi; yi = aux;
+  }
+
+  // Result ends in auxiliary buffer after an odd number of stages
+  if(xr != re)
+  {
+    for(i = 0; i < P->N; i++)
+    {
+      re[i] = xr[i];
+      im[i] = xi[i];
+    }
+  }
+
+  if(dir == FFT_INVERSE)
+  {
+    for(i = 0; i < P->N; i++)
+    {
+      re[i] *= scale;
+      im[i] *= scale;
+    }
+  }
+}
+
+/**
+@brief  Copies split buffer into t_complex buffer updating polar components
+@param  re, im: Split buffer
+        Y: Output buffer
+        n: Number of values
+@retval none
+*/
+void fft_scatter(const double* re, const double* im, Complex Y, size_t n)
+{
+  size_t i = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    Y[i].Real = re[i];
+    Y[i].Imag = im[i];
+
+    complex_modulus(&Y[i]);
+    complex_argument(&Y[i]);
+  }
+}
+
+/**
+@brief  Transforms a t_complex buffer through the plan work buffer
+@param  P:   Complex plan
+        X:   Input buffer
+        Y:   Output buffer
+        dir: Transform direction
+@retval TRUE if transform was computed, FALSE otherwise
+*/
+uint8_t fft_execute(FFTPlan P, Complex X, Complex Y, FFT_DIRECTION dir)
+{
+  size_t i = 0;
+
+  if(P == NULL || P->real || X == NULL || Y == NULL)
+  {
+    return FALSE;
+  }
+
+  for(i = 0; i < P->N; i++)
+  {
+    P->bufRe[i] = X[i].Real;
+    P->bufIm[i] = X[i].Imag;
+  }
+
+  fft_run(P, P->bufRe, P->bufIm, dir);
+  fft_scatter(P->bufRe, P->bufIm, Y, P->N);
+
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Creates a plan for complex transforms of size N. Twiddle factors come
+        from the shared twiddle cache; work buffers are reused by every call
+@param  N: Transform size (any N > 0; radix-4/2 stages, then 3, 5 and
+           generic prime stages)
+@retval Pointer to new plan, NULL on error
+@note   Prime factors of at least FFT_BLUESTEIN_MIN run as chirp-z
+        convolutions, so every size stays O(N log N). A plan owns its work
+        buffers: it must not be executed by two threads at once (create one
+        plan per thread; twiddle tables are shared safely)
+*/
+FFTPlan fft_plan_create(size_t N)
+{
+  FFTPlan P = NULL;   // New plan
+  uint8_t k = 0;      // Iterator
+
+  if(N == 0)
+  {
+    return NULL;
+  }
+
+  // Members are NULL by default so that deletion is always safe
+  P = (FFTPlan)calloc( 1, sizeof(t_fftPlan) );
+
+  if(P == NULL)
+  {
+    return NULL;
+  }
+
+  P->N = N;
+  P->real = FALSE;
+
+  P->tw    = Tw_Hdlr.acquire(N);
+  P->bufRe = (double*)malloc( N * sizeof(double) );
+  P->bufIm = (double*)malloc( N * sizeof(double) );
+  P->tmpRe = (double*)malloc( N * sizeof(double) );
+  P->tmpIm = (double*)malloc( N * sizeof(double) );
+
+  if(P->tw == NULL || P->bufRe == NULL ||
+     P->bufIm == NULL || P->tmpRe == NULL || P->tmpIm == NULL ||
+     !fft_factorize(P) )
+  {
+    fft_plan_delete(P);
+
+    return NULL;
+  }
+
+  P->twRe = P->tw->re;
+  P->twIm = P->tw->im;
+
+  // Large prime stages
+  for(k = 0; k < P->nFactors; k++)
+  {
+    if(P->factors[k] >= FFT_BLUESTEIN_MIN)
+    {
+      P->chirp[k] = fft_chirp_create(P->factors[k]);
+
+      if(P->chirp[k] == NULL)
+      {
+        fft_plan_delete(P);
+
+        return NULL;
+      }
+    }
+  }
+
+  return P;
+}
+
+/**
+@brief  Creates a plan for real-input transforms of size N
+@param  N: Transform size (even, N >= 2)
+@retval Pointer to new plan, NULL on error
+@note The plan runs a half-size complex transform and an O(N) split step
+*/
+FFTPlan fft_plan_create_real(size_t N)
+{
+  FFTPlan P = NULL;   // New plan
+
+  if(N < 2 || N % 2 != 0)
+  {
+    return NULL;
+  }
+
+  P = (FFTPlan)calloc( 1, sizeof(t_fftPlan) );
+
+  if(P == NULL)
+  {
+    return NULL;
+  }
+
+  P->N = N;
+  P->real = TRUE;
+
+  // Split step twiddles W_N^k, k < N/2 (first half of the size-N table)
+  P->tw = Tw_Hdlr.acquire(N);
+  P->half = fft_plan_create(N / 2);
+
+  if(P->tw == NULL || P->half == NULL)
+  {
+    fft_plan_delete(P);
+
+    return NULL;
+  }
+
+  P->twRe = P->tw->re;
+  P->twIm = P->tw->im;
+
+  return P;
+}
+
+/**
+@brief  Forward transform of N complex values
+@param  P: Complex plan
+        X: Input buffer (N contiguous complex values)
+        Y: Output buffer (N contiguous complex values, may be equal to X)
+@retval TRUE if transform was computed, FALSE otherwise
+*/
+uint8_t fft_forward(FFTPlan P, Complex X, Complex Y)
+{
+  return fft_execute(P, X, Y, FFT_FORWARD);
+}
+
+/**
+@brief  Inverse transform of N complex values (scaled by 1/N)
+@param  P: Complex plan
+        X: Input buffer (N contiguous complex values)
+        Y: Output buffer (N contiguous complex values, may be equal to X)
+@retval TRUE if transform was computed, FALSE otherwise
+*/
+uint8_t fft_inverse(FFTPlan P, Complex X, Complex Y)
+{
+  return fft_execute(P, X, Y, FFT_INVERSE);
+}
+
+/**
+@brief  In-place transform on split (real / imaginary arrays) storage
+@param  P:   Complex plan
+        re:  Real parts (N values)
+        im:  Imaginary parts (N values)
+        dir: Transform direction
+@retval TRUE if transform was computed, FALSE otherwise
+@note Fastest entry point: no conversion from / to t_complex is performed
+*/
+uint8_t fft_execute_split(FFTPlan P, double* re, double* im,
+                          FFT_DIRECTION dir)
+{
+  if(P == NULL || P->real || re == NULL || im == NULL)
+  {
+    return FALSE;
+  }
+
+  fft_run(P, re, im, dir);
+
+  return TRUE;
+}
+
+/**
+@brief  Forward transform of N real values
+@param  P: Real plan
+        x: Input samples (N values)
+        X: Output spectrum (N/2 + 1 complex values, X[k] for k = 0..N/2)
+@retval TRUE if transform was computed, FALSE otherwise
+@note Remaining bins follow from symmetry: X[N - k] = conj(X[k])
+*/
+uint8_t fft_real_forward(FFTPlan P, const double* x, Complex X)
+{
+  FFTPlan H = NULL;     // Half-size plan
+  size_t M = 0, k = 0;  // Half size, iterator
+  double* zr = NULL;
+  double* zi = NULL;
+
+  if(P == NULL || !P->real || x == NULL || X == NULL)
+  {
+    return FALSE;
+  }
+
+  H = P->half;
+  M = H->N;
+  zr = H->bufRe;
+  zi = H->bufIm;
+
+  // Packs even / odd samples as z[k] = x[2k] + i x[2k+1]
+  for(k = 0; k < M; k++)
+  {
+    zr[k] = x[2 * k];
+    zi[k] = x[2 * k + 1];
+  }
+
+  fft_run(H, zr, zi, FFT_FORWARD);
+
+  // X[k] = E[k] + W^k O[k]; E = (Z[k] + conj Z[M-k])/2, O = (Z[k] - conj Z[M-k])/2i
+  X[0].Real = zr[0] + zi[0];
+  X[0].Imag = 0;
+  X[M].Real = zr[0] - zi[0];
+  X[M].Imag = 0;
+
+  for(k = 1; k < M; k++)
+  {
+    double er = 0.5 * (zr[k] + zr[M - k]), ei = 0.5 * (zi[k] - zi[M - k]);
+    double odr = 0.5 * (zi[k] + zi[M - k]), odi = -0.5 * (zr[k] - zr[M - k]);
+    double wr = P->twRe[k], wi = -P->twIm[k];
+
+    X[k].Real = er + odr * wr - odi * wi;
+    X[k].Imag = ei + odr * wi + odi * wr;
+  }
+
+  for(k = 0; k <= M; k++)
+  {
+    complex_modulus(&X[k]);
+    complex_argument(&X[k]);
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Inverse transform of a Hermitian spectrum (scaled by 1/N)
+@param  P: Real plan
+        X: Input spectrum (N/2 + 1 complex values)
+        x: Output samples (N values)
+@retval TRUE if transform was computed, FALSE otherwise
+*/
+uint8_t fft_real_inverse(FFTPlan P, Complex X, double* x)
+{
+  FFTPlan H = NULL;     // Half-size plan
+  size_t M = 0, k = 0;  // Half size, iterator
+  double* zr = NULL;
+  double* zi = NULL;
+
+  if(P == NULL || !P->real || X == NULL || x == NULL)
+  {
+    return FALSE;
+  }
+
+  H = P->half;
+  M = H->N;
+  zr = H->bufRe;
+  zi = H->bufIm;
+
+  // E = (X[k] + conj X[M-k])/2, O = (X[k] - conj X[M-k]) W^-k / 2, Z = E + iO
+  for(k = 0; k < M; k++)
+  {
+    double er = 0.5 * (X[k].Real + X[M - k].Real);
+    double ei = 0.5 * (X[k].Imag - X[M - k].Imag);
+    double dr = 0.5 * (X[k].Real - X[M - k].Real);
+    double di = 0.5 * (X[k].Imag + X[M - k].Imag);
+    double wr = P->twRe[k], wi = P->twIm[k];
+    double odr = dr * wr - di * wi, odi = dr * wi + di * wr;
+
+    zr[k] = er - odi;
+    zi[k] = ei + odr;
+  }
+
+  fft_run(H, zr, zi, FFT_INVERSE);
+
+  for(k = 0; k < M; k++)
+  {
+    x[2 * k] = zr[k];
+    x[2 * k + 1] = zi[k];
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Deletes plan and frees allocated memory
+@param  P: Pointer to plan
+@retval TRUE if plan was deleted with no error, FALSE otherwise
+*/
+uint8_t fft_plan_delete(FFTPlan P)
+{
+  uint8_t k = 0;   // Iterator
+
+  if(P != NULL)
+  {
+    if(P->tw != NULL)
+    {
+      Tw_Hdlr.release(P->tw);
+    }
+
+    free(P->bufRe);
+    free(P->bufIm);
+    free(P->tmpRe);
+    free(P->tmpIm);
+
+    if(P->half != NULL)
+    {
+      fft_plan_delete(P->half);
+    }
+
+    for(k = 0; k < P->nFactors; k++)
+    {
+      fft_chirp_delete(P->chirp[k]);
+    }
+
+    free(P);
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
@@ -0,0 +1,183 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_FFT.h
+ * Description   : Fast Fourier Transform over complex buffers. Header file.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _FFT_H_
+#define _FFT_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Twiddle.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Max. number of radix stages in a plan
+#define FFT_MAX_FACTORS (uint8_t)(64)
+
+// Min. transform size for multi-threaded execution (OpenMP builds)
+#define FFT_PARALLEL_MIN (size_t)(16384)
+
+// Min. prime radix run through Bluestein's chirp-z convolution instead of the
+// O(r^2) direct butterfly (measured crossover: r = 13..17)
+#define FFT_BLUESTEIN_MIN (size_t)(17)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Transform direction
+typedef enum
+{
+  FFT_FORWARD = 0,   // Forward transform, exp(-2*pi*i*k*n/N)
+  FFT_INVERSE        // Inverse transform, exp(+2*pi*i*k*n/N), scaled by 1/N
+}
+FFT_DIRECTION;
+
+// Bluestein stage: length-r DFT as a power-of-two cyclic convolution
+typedef struct fft_chirp
+{
+  size_t  r;                          // Prime radix
+  double* bRe;                        // Chirp cos / sin(pi*n^2/r), n < r
+  double* bIm;
+  double* vRe[2];                     // Spectra of the conjugate chirp
+  double* vIm[2];                     // (forward, inverse)
+  double* uRe;                        // Convolution buffer (M values)
+  double* uIm;
+  struct fft_plan* conv;              // Size-M complex plan, M >= 2r - 1
+}
+t_fftChirp;
+
+// Transform plan
+typedef struct fft_plan
+{
+  size_t  N;                          // Transform size
+  uint8_t real;                       // Real-input plan?
+  uint8_t nFactors;                   // Number of radix stages
+  size_t  factors[FFT_MAX_FACTORS];   // Radix of each stage
+  Twiddle tw;                         // Shared table exp(2*pi*i*k/N)
+  const double* twRe;                 // Twiddle factors (real part)
+  const double* twIm;                 // Twiddle factors (imaginary part)
+  double* bufRe;                      // Work buffer (real part)
+  double* bufIm;                      // Work buffer (imaginary part)
+  double* tmpRe;                      // Auxiliary buffer (real part)
+  double* tmpIm;                      // Auxiliary buffer (imaginary part)
+  struct fft_plan* half;              // Half-size complex plan (real input)
+  t_fftChirp* chirp[FFT_MAX_FACTORS]; // Bluestein data of each stage (NULL
+                                      // for direct butterflies)
+}
+t_fftPlan;
+
+typedef t_fftPlan* FFTPlan;
+
+// FFT handler
+typedef struct fft_handler
+{
+  FFTPlan (*init)(size_t N);                                  // Complex plan
+  FFTPlan (*initReal)(size_t N);                              // Real plan
+  uint8_t (*forward)(FFTPlan P, Complex X, Complex Y);        // Forward FFT
+  uint8_t (*inverse)(FFTPlan P, Complex X, Complex Y);        // Inverse FFT
+  uint8_t (*split)(FFTPlan P, double* re, double* im,
+                   FFT_DIRECTION dir);                        // Split FFT
+  uint8_t (*rForward)(FFTPlan P, const double* x, Complex X); // Real FFT
+  uint8_t (*rInverse)(FFTPlan P, Complex X, double* x);       // Real IFFT
+  uint8_t (*del)(FFTPlan P);                                  // Delete plan
+}
+t_FFTHandler;
+
+extern t_FFTHandler FFT_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Creates a plan for complex transforms of size N. Twiddle factors come
+        from the shared twiddle cache; work buffers are reused by every call
+@param  N: Transform size (any N > 0; radix-4/2 stages, then 3, 5 and
+           generic prime stages)
+@retval Pointer to new plan, NULL on error
+@note   Prime factors of at least FFT_BLUESTEIN_MIN run as chirp-z
+        convolutions, so every size stays O(N log N). A plan owns its work
+        buffers: it must not be executed by two threads at once (create one
+        plan per thread; twiddle tables are shared safely)
+*/
+extern FFTPlan fft_plan_create(size_t N);
+
+/**
+@brief  Creates a plan for real-input transforms of size N
+@param  N: Transform size (even, N >= 2)
+@retval Pointer to new plan, NULL on error
+@note The plan runs a half-size complex transform and an O(N) split step.
+      As for complex plans, one plan must not be executed by two threads at
+      once
+*/
+extern FFTPlan fft_plan_create_real(size_t N);
+
+/**
+@brief  Forward transform of N complex values
+@param  P: Complex plan
+        X: Input buffer (N contiguous complex values)
+        Y: Output buffer (N contiguous complex values, may be equal to X)
+@retval TRUE if transform was computed, FALSE otherwise
+*/
+extern uint8_t fft_forward(FFTPlan P, Complex X, Complex Y);
+
+/**
+@brief  Inverse transform of N complex values (scaled by 1/N)
+@param  P: Complex plan
+        X: Input buffer (N contiguous complex values)
+        Y: Output buffer (N contiguous complex values, may be equal to X)
+@retval TRUE if transform was computed, FALSE otherwise
+*/
+extern uint8_t fft_inverse(FFTPlan P, Complex X, Complex Y);
+
+/**
+@brief  In-place transform on split (real / imaginary arrays) storage
+@param  P:   Complex plan
+        re:  Real parts (N values)
+        im:  Imaginary parts (N values)
+        dir: Transform direction
+@retval TRUE if transform was computed, FALSE otherwise
+@note Fastest entry point: no conversion from / to t_complex is performed
+*/
+extern uint8_t fft_execute_split(FFTPlan P, double* re, double* im,
+                                 FFT_DIRECTION dir);
+
+/**
+@brief  Forward transform of N real values
+@param  P: Real plan
+        x: Input samples (N values)
+        X: Output spectrum (N/2 + 1 complex values, X[k] for k = 0..N/2)
+@retval TRUE if transform was computed, FALSE otherwise
+@note Remaining bins follow from symmetry: X[N - k] = conj(X[k])
+*/
+extern uint8_t fft_real_forward(FFTPlan P, const double* x, Complex X);
+
+/**
+@brief  Inverse transform of a Hermitian spectrum (scaled by 1/N)
+@param  P: Real plan
+        X: Input spectrum (N/2 + 1 complex values)
+        x: Output samples (N values)
+@retval TRUE if transform was computed, FALSE otherwise
+*/
+extern uint8_t fft_real_inverse(FFTPlan P, Complex X, double* x);
+
+/**
+@brief  Deletes plan and frees allocated memory
+@param  P: Pointer to plan
+@retval TRUE if plan was deleted with no error, FALSE otherwise
+*/
+extern uint8_t fft_plan_delete(FFTPlan P);
+
+#endif
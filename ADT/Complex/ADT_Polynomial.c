@@ -0,0 +1,532 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_Polynomial.c
+ * Description   : Complex polynomials: evaluation and root finding. Library.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Polynomial.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Polynomial handler
+t_PolynomialHandler Poly_Hdlr =
+{
+  poly_create,        // Create
+  poly_update,        // Update c[k]
+  poly_config,        // Controls
+  poly_eval,          // p(Z)
+  poly_eval_batch,    // p(z[])
+  poly_deriv_batch,   // p'(z[])
+  poly_roots,         // All roots
+  poly_delete         // Delete
+};
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Computes g = p'(z) / p(z) at one point. For |z| > 1 the reversed
+        polynomial is used so that z^n never overflows (degree 1000 and up)
+@param  P:      Polynomial
+        zr, zi: Point
+        gr, gi: Logarithmic derivative
+@retval TRUE if p(z) != 0, FALSE if z is an exact root
+*/
+uint8_t poly_logderiv(Polynomial P, double zr, double zi, double* gr,
+                      double* gi)
+{
+  size_t n = P->degree, k = 0;
+  double pr = 0, pi = 0, dr = 0, di = 0, yr = 0, yi = 0, t = 0, m = 0;
+  double hr = 0, hi = 0;
+
+  if(zr * zr + zi * zi <= 1.0)
+  {
+    // Horner for p and p'
+    pr = P->cRe[n]; pi = P->cIm[n];
+
+    for(k = n; k-- > 0;)
+    {
+      t  = dr * zr - di * zi + pr;
+      di = dr * zi + di * zr + pi;
+      dr = t;
+      t  = pr * zr - pi * zi + P->cRe[k];
+      pi = pr * zi + pi * zr + P->cIm[k];
+      pr = t;
+    }
+
+    m = pr * pr + pi * pi;
+
+    if(m == 0)
+    {
+      return FALSE;
+    }
+
+    *gr = (dr * pr + di * pi) / m;
+    *gi = (di * pr - dr * pi) / m;
+
+    return TRUE;
+  }
+
+  // y = 1/z, q(y) = y^n p(1/y) (reversed coefficients)
+  m = zr * zr + zi * zi;
+  yr = zr / m;
+  yi = -zi / m;
+  pr = P->cRe[0]; pi = P->cIm[0];
+
+  for(k = 1; k <= n; k++)
+  {
+    t  = dr * yr - di * yi + pr;
+    di = dr * yi + di * yr + pi;
+    dr = t;
+    t  = pr * yr - pi * yi + P->cRe[k];
+    pi = pr * yi + pi * yr + P->cIm[k];
+    pr = t;
+  }
+
+  m = pr * pr + pi * pi;
+
+  if(m == 0)
+  {
+    return FALSE;
+  }
+
+  // h = y q'(y) / q(y)
+  hr = (dr * pr + di * pi) / m;
+  hi = (di * pr - dr * pi) / m;
+  t  = hr * yr - hi * yi;
+  hi = hr * yi + hi * yr;
+  hr = t;
+
+  // p'/p = y (n - h)
+  hr = (double)(n) - hr;
+  hi = -hi;
+  *gr = yr * hr - yi * hi;
+  *gi = yr * hi + yi * hr;
+
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates a polynomial and every workspace used by evaluation and root
+        finding, so later calls do not allocate
+@param  C:      Coefficients c[0..degree] (ascending powers)
+        degree: Polynomial degree
+@retval Pointer to new polynomial, NULL on error
+*/
+Polynomial poly_create(Complex C, size_t degree)
+{
+  Polynomial P = NULL;   // New polynomial
+  size_t k = 0;          // Iterator
+
+  if(C == NULL)
+  {
+    return NULL;
+  }
+
+  P = (Polynomial)calloc( 1, sizeof(t_polynomial) );
+
+  if(P == NULL)
+  {
+    return NULL;
+  }
+
+  P->degree = degree;
+  P->tol = POLY_DEFAULT_TOL;
+  P->maxIter = POLY_DEFAULT_ITER;
+  P->cRe  = (double*)malloc( (degree + 1) * sizeof(double) );
+  P->cIm  = (double*)malloc( (degree + 1) * sizeof(double) );
+  P->rRe  = (double*)malloc( (degree + 1) * sizeof(double) );
+  P->rIm  = (double*)malloc( (degree + 1) * sizeof(double) );
+  P->done = (uint8_t*)malloc( (degree + 1) * sizeof(uint8_t) );
+
+  if(P->cRe == NULL || P->cIm == NULL || P->rRe == NULL || P->rIm == NULL ||
+     P->done == NULL)
+  {
+    poly_delete(P);
+
+    return NULL;
+  }
+
+  for(k = 0; k <= degree; k++)
+  {
+    P->cRe[k] = C[k].Real;
+    P->cIm[k] = C[k].Imag;
+  }
+
+  return P;
+}
+
+/**
+@brief  Updates coefficient k
+@param  P: Polynomial
+        c: New coefficient
+        k: Power of z
+@retval TRUE if coefficient was updated, FALSE otherwise
+*/
+uint8_t poly_update(Polynomial P, Complex c, size_t k)
+{
+  if(P != NULL && c != NULL && k <= P->degree)
+  {
+    P->cRe[k] = c->Real;
+    P->cIm[k] = c->Imag;
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+@brief  Sets root finding controls
+@param  P:   Polynomial
+        tol: Relative correction tolerance (|dz| <= tol |z| stops a root)
+        it:  Max. number of iterations
+@retval TRUE if controls were updated, FALSE otherwise
+*/
+uint8_t poly_config(Polynomial P, double tol, uint32_t it)
+{
+  if(P != NULL && tol > 0 && it > 0)
+  {
+    P->tol = tol;
+    P->maxIter = it;
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+@brief  Evaluates p(Z)
+@param  P: Polynomial
+        Z: Point
+@retval Pointer to new complex p(Z), NULL on error
+*/
+Complex poly_eval(Polynomial P, Complex Z)
+{
+  double wr = 0, wi = 0;
+
+  if(P == NULL || Z == NULL)
+  {
+    return NULL;
+  }
+
+  poly_eval_batch(P, &Z->Real, &Z->Imag, &wr, &wi, 1);
+
+  return Cmplx_Hdlr.init(wr, wi);
+}
+
+/**
+@brief  Evaluates p at n points (batched Horner over split storage)
+@param  P:      Polynomial
+        zr, zi: Points (n values each)
+        wr, wi: Results (n values each)
+        n:      Number of points
+@retval TRUE if points were evaluated, FALSE otherwise
+*/
+uint8_t poly_eval_batch(Polynomial P, const double* zr, const double* zi,
+                        double* wr, double* wi, size_t n)
+{
+  double pr[POLY_LANES], pi[POLY_LANES], t = 0;
+  size_t i = 0, k = 0, l = 0, d = 0;
+
+  if(P == NULL || zr == NULL || zi == NULL || wr == NULL || wi == NULL)
+  {
+    return FALSE;
+  }
+
+  d = P->degree;
+
+  // Blocks of POLY_LANES points: lane loop maps onto SIMD registers
+  for(i = 0; i + POLY_LANES <= n; i += POLY_LANES)
+  {
+    for(l = 0; l < POLY_LANES; l++)
+    {
+      pr[l] = P->cRe[d];
+      pi[l] = P->cIm[d];
+    }
+
+    for(k = d; k-- > 0;)
+    {
+      for(l = 0; l < POLY_LANES; l++)
+      {
+        t     = pr[l] * zr[i + l] - pi[l] * zi[i + l] + P->cRe[k];
+        pi[l] = pr[l] * zi[i + l] + pi[l] * zr[i + l] + P->cIm[k];
+        pr[l] = t;
+      }
+    }
+
+    for(l = 0; l < POLY_LANES; l++)
+    {
+      wr[i + l] = pr[l];
+      wi[i + l] = pi[l];
+    }
+  }
+
+  // Remaining points
+  for(; i < n; i++)
+  {
+    pr[0] = P->cRe[d];
+    pi[0] = P->cIm[d];
+
+    for(k = d; k-- > 0;)
+    {
+      t     = pr[0] * zr[i] - pi[0] * zi[i] + P->cRe[k];
+      pi[0] = pr[0] * zi[i] + pi[0] * zr[i] + P->cIm[k];
+      pr[0] = t;
+    }
+
+    wr[i] = pr[0];
+    wi[i] = pi[0];
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Evaluates the derivative p' at n points (batched Horner)
+@param  P:      Polynomial
+        zr, zi: Points (n values each)
+        wr, wi: Results (n values each)
+        n:      Number of points
+@retval TRUE if points were evaluated, FALSE otherwise
+*/
+uint8_t poly_deriv_batch(Polynomial P, const double* zr,
+                         const double* zi, double* wr, double* wi,
+                         size_t n)
+{
+  double pr[POLY_LANES], pi[POLY_LANES], t = 0;
+  size_t i = 0, k = 0, l = 0, d = 0;
+
+  if(P == NULL || zr == NULL || zi == NULL || wr == NULL || wi == NULL)
+  {
+    return FALSE;
+  }
+
+  d = P->degree;
+
+  // p'(z) = sum k c[k] z^(k-1): Horner over scaled coefficients
+  for(i = 0; i + POLY_LANES <= n; i += POLY_LANES)
+  {
+    for(l = 0; l < POLY_LANES; l++)
+    {
+      pr[l] = (d > 0) ? d * P->cRe[d] : 0;
+      pi[l] = (d > 0) ? d * P->cIm[d] : 0;
+    }
+
+    for(k = d; k-- > 1;)
+    {
+      for(l = 0; l < POLY_LANES; l++)
+      {
+        t     = pr[l] * zr[i + l] - pi[l] * zi[i + l] + k * P->cRe[k];
+        pi[l] = pr[l] * zi[i + l] + pi[l] * zr[i + l] + k * P->cIm[k];
+        pr[l] = t;
+      }
+    }
+
+    for(l = 0; l < POLY_LANES; l++)
+    {
+      wr[i + l] = pr[l];
+      wi[i + l] = pi[l];
+    }
+  }
+
+  // Remaining points
+  for(; i < n; i++)
+  {
+    pr[0] = (d > 0) ? d * P->cRe[d] : 0;
+    pi[0] = (d > 0) ? d * P->cIm[d] : 0;
+
+    for(k = d; k-- > 1;)
+    {
+      t     = pr[0] * zr[i] - pi[0] * zi[i] + k * P->cRe[k];
+      pi[0] = pr[0] * zi[i] + pi[0] * zr[i] + k * P->cIm[k];
+      pr[0] = t;
+    }
+
+    wr[i] = pr[0];
+    wi[i] = pi[0];
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Finds all roots by Aberth-Ehrlich iteration
+@param  P: Polynomial (leading coefficient must be non-zero)
+        R: Output buffer (degree contiguous complex values)
+@retval TRUE if every root converged, FALSE otherwise
+@note Iterations used are left in P->iterations. On FALSE, R holds the last
+      estimates
+*/
+uint8_t poly_roots(Polynomial P, Complex R)
+{
+  size_t n = 0, i = 0, j = 0, left = 0;
+  double r = 0, a = 0, gr = 0, gi = 0, sr = 0, si = 0, dr = 0, di = 0;
+  double m = 0, wr = 0, wi = 0;
+  double cn = 0;
+
+  if(P == NULL || R == NULL || P->degree == 0)
+  {
+    return FALSE;
+  }
+
+  n = P->degree;
+  cn = sqrt(P->cRe[n] * P->cRe[n] + P->cIm[n] * P->cIm[n]);
+
+  if(cn == 0)
+  {
+    return FALSE;
+  }
+
+  // Initial estimates on a circle of radius |c0/cn|^(1/n), rotated to break
+  // symmetry with real-coefficient polynomials
+  r = sqrt(P->cRe[0] * P->cRe[0] + P->cIm[0] * P->cIm[0]);
+  r = (r > 0) ? pow(r / cn, 1.0 / (double)(n)) : 1.0;
+
+  for(i = 0; i < n; i++)
+  {
+    a = TWO_PI * (double)(i) / (double)(n) + 0.4;
+    P->rRe[i] = r * cos(a);
+    P->rIm[i] = r * sin(a);
+    P->done[i] = FALSE;
+  }
+
+  left = n;
+
+  for(P->iterations = 0; P->iterations < P->maxIter && left > 0;
+      P->iterations++)
+  {
+    for(i = 0; i < n; i++)
+    {
+      if(P->done[i])
+      {
+        continue;
+      }
+
+      if( !poly_logderiv(P, P->rRe[i], P->rIm[i], &gr, &gi) )
+      {
+        // Exact root
+        P->done[i] = TRUE;
+        left--;
+        continue;
+      }
+
+      // S = sum 1/(z_i - z_j), j != i
+      sr = 0; si = 0;
+
+      for(j = 0; j < n; j++)
+      {
+        if(j != i)
+        {
+          dr = P->rRe[i] - P->rRe[j];
+          di = P->rIm[i] - P->rIm[j];
+          m = dr * dr + di * di;
+
+          if(m > 0)
+          {
+            sr += dr / m;
+            si -= di / m;
+          }
+        }
+      }
+
+      // w = 1 / (p'/p - S)
+      dr = gr - sr;
+      di = gi - si;
+      m = dr * dr + di * di;
+
+      if(m == 0)
+      {
+        continue;
+      }
+
+      wr = dr / m;
+      wi = -di / m;
+
+      P->rRe[i] -= wr;
+      P->rIm[i] -= wi;
+
+      if( sqrt(wr * wr + wi * wi) <=
+          P->tol * fmax(sqrt(P->rRe[i] * P->rRe[i] + P->rIm[i] * P->rIm[i]),
+                        P->tol) )
+      {
+        P->done[i] = TRUE;
+        left--;
+      }
+    }
+  }
+
+  for(i = 0; i < n; i++)
+  {
+    R[i].Real = P->rRe[i];
+    R[i].Imag = P->rIm[i];
+
+    complex_modulus(&R[i]);
+    complex_argument(&R[i]);
+  }
+
+  return (left == 0) ? TRUE : FALSE;
+}
+
+/**
+@brief  Deletes polynomial and frees allocated memory
+@param  P: Polynomial
+@retval TRUE if polynomial was deleted with no error, FALSE otherwise
+*/
+uint8_t poly_delete(Polynomial P)
+{
+  if(P != NULL)
+  {
+    free(P->cRe);
+    free(P->cIm);
+    free(P->rRe);
+    free(P->rIm);
+    free(P->done);
+    free(P);
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+@brief  Prints polynomial coefficients on screen
+@param  P: Polynomial
+@retval TRUE if polynomial was printed with no error, FALSE otherwise
+*/
+uint8_t poly_print(Polynomial P)
+{
+  size_t k = 0;
+
+  if(P == NULL)
+  {
+    return FALSE;
+  }
+
+  for(k = P->degree + 1; k-- > 0;)
+  {
+    printf("(%.04f %c %.04f i) z^%zu%s", P->cRe[k],
+           (P->cIm[k] < 0) ? '-' : '+', fabs(P->cIm[k]), k,
+           (k > 0) ? " + " : "\n");
+  }
+
+  return TRUE;
+}
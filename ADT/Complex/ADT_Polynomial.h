@@ -0,0 +1,159 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_Polynomial.h
+ * Description   : Complex polynomials: evaluation and root finding. Header.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _POLYNOMIAL_H_
+#define _POLYNOMIAL_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Complex.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Points evaluated together by batched Horner (one SIMD-friendly block)
+#define POLY_LANES (uint8_t)(8)
+
+// Default root finding controls
+#define POLY_DEFAULT_TOL   (double)(1e-14)
+#define POLY_DEFAULT_ITER  (uint32_t)(500)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Polynomial p(z) = c[0] + c[1] z + ... + c[n] z^n
+typedef struct polynomial
+{
+  size_t   degree;       // Degree n
+  double*  cRe;          // Coefficients, real parts (n + 1 values)
+  double*  cIm;          // Coefficients, imaginary parts (n + 1 values)
+  double*  rRe;          // Root estimates, real parts (workspace)
+  double*  rIm;          // Root estimates, imaginary parts (workspace)
+  uint8_t* done;         // Converged root flags (workspace)
+  double   tol;          // Relative correction tolerance
+  uint32_t maxIter;      // Max. Aberth iterations
+  uint32_t iterations;   // Iterations used by last root search
+}
+t_polynomial;
+
+typedef t_polynomial* Polynomial;
+
+// Polynomial handler
+typedef struct polynomial_handler
+{
+  Polynomial (*init)(Complex C, size_t degree);                 // Create
+  uint8_t    (*update)(Polynomial P, Complex c, size_t k);      // Update c[k]
+  uint8_t    (*config)(Polynomial P, double tol, uint32_t it);  // Controls
+  Complex    (*eval)(Polynomial P, Complex Z);                  // p(Z)
+  uint8_t    (*evalBatch)(Polynomial P, const double* zr,
+                          const double* zi, double* wr,
+                          double* wi, size_t n);                // p(z[])
+  uint8_t    (*derivBatch)(Polynomial P, const double* zr,
+                           const double* zi, double* wr,
+                           double* wi, size_t n);               // p'(z[])
+  uint8_t    (*roots)(Polynomial P, Complex R);                 // All roots
+  uint8_t    (*del)(Polynomial P);                              // Delete
+}
+t_PolynomialHandler;
+
+extern t_PolynomialHandler Poly_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates a polynomial and every workspace used by evaluation and root
+        finding, so later calls do not allocate
+@param  C:      Coefficients c[0..degree] (ascending powers)
+        degree: Polynomial degree
+@retval Pointer to new polynomial, NULL on error
+*/
+extern Polynomial poly_create(Complex C, size_t degree);
+
+/**
+@brief  Updates coefficient k
+@param  P: Polynomial
+        c: New coefficient
+        k: Power of z
+@retval TRUE if coefficient was updated, FALSE otherwise
+*/
+extern uint8_t poly_update(Polynomial P, Complex c, size_t k);
+
+/**
+@brief  Sets root finding controls
+@param  P:   Polynomial
+        tol: Relative correction tolerance (|dz| <= tol |z| stops a root)
+        it:  Max. number of iterations
+@retval TRUE if controls were updated, FALSE otherwise
+*/
+extern uint8_t poly_config(Polynomial P, double tol, uint32_t it);
+
+/**
+@brief  Evaluates p(Z)
+@param  P: Polynomial
+        Z: Point
+@retval Pointer to new complex p(Z), NULL on error
+*/
+extern Complex poly_eval(Polynomial P, Complex Z);
+
+/**
+@brief  Evaluates p at n points (batched Horner over split storage)
+@param  P:      Polynomial
+        zr, zi: Points (n values each)
+        wr, wi: Results (n values each)
+        n:      Number of points
+@retval TRUE if points were evaluated, FALSE otherwise
+*/
+extern uint8_t poly_eval_batch(Polynomial P, const double* zr, const double* zi,
+                               double* wr, double* wi, size_t n);
+
+/**
+@brief  Evaluates the derivative p' at n points (batched Horner)
+@param  P:      Polynomial
+        zr, zi: Points (n values each)
+        wr, wi: Results (n values each)
+        n:      Number of points
+@retval TRUE if points were evaluated, FALSE otherwise
+*/
+extern uint8_t poly_deriv_batch(Polynomial P, const double* zr,
+                                const double* zi, double* wr, double* wi,
+                                size_t n);
+
+/**
+@brief  Finds all roots by Aberth-Ehrlich iteration
+@param  P: Polynomial (leading coefficient must be non-zero)
+        R: Output buffer (degree contiguous complex values)
+@retval TRUE if every root converged, FALSE otherwise
+@note Iterations used are left in P->iterations. On FALSE, R holds the last
+      estimates
+*/
+extern uint8_t poly_roots(Polynomial P, Complex R);
+
+/**
+@brief  Deletes polynomial and frees allocated memory
+@param  P: Polynomial
+@retval TRUE if polynomial was deleted with no error, FALSE otherwise
+*/
+extern uint8_t poly_delete(Polynomial P);
+
+/**
+@brief  Prints polynomial coefficients on screen
+@param  P: Polynomial
+@retval TRUE if polynomial was printed with no error, FALSE otherwise
+*/
+extern uint8_t poly_print(Polynomial P);
+
+#endif
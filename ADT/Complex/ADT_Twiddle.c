@@ -0,0 +1,326 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_Twiddle.c
+ * Description   : Shared cache of roots-of-unity (twiddle) tables. Library.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Twiddle.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Twiddle cache handler
+t_TwiddleHandler Tw_Hdlr =
+{
+  twiddle_acquire,    // Get table (reference counted)
+  twiddle_release,    // Drop reference
+  twiddle_setLimit,   // Set memory cap
+  twiddle_usage,      // Bytes held by the cache
+  twiddle_clear       // Free unreferenced tables
+};
+
+// Cache state (guarded by twiddle_lock)
+pthread_mutex_t twiddle_lock = PTHREAD_MUTEX_INITIALIZER;
+Twiddle  twiddle_head  = NULL;                    // Cached tables
+size_t   twiddle_bytes = 0;                       // Bytes held
+size_t   twiddle_limit = TWIDDLE_DEFAULT_LIMIT;   // Memory cap
+uint64_t twiddle_clock = 0;                       // LRU clock
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Bytes used by one array of the table (padded to TWIDDLE_ALIGN)
+@param  N: Table size
+@retval Bytes
+*/
+size_t twiddle_arrayBytes(size_t N)
+{
+  size_t bytes = N * sizeof(double);
+
+  return (bytes + TWIDDLE_ALIGN - 1) / TWIDDLE_ALIGN * TWIDDLE_ALIGN;
+}
+
+/**
+@brief  Allocates and fills a table. Values come from a long double
+        trigonometric recurrence re-anchored every TWIDDLE_RESYNC steps, so
+        error does not grow with N
+@param  N: Table size
+@retval Pointer to table, NULL on error
+*/
+Twiddle twiddle_create(size_t N)
+{
+  Twiddle T = NULL;
+  size_t k = 0, bytes = twiddle_arrayBytes(N);
+  long double d = 0, a = 0, b = 0, c = 0, s = 0, t = 0;
+
+  T = (Twiddle)calloc( 1, sizeof(t_twiddleTable) );
+
+  if(T == NULL)
+  {
+    return NULL;
+  }
+
+  // One aligned block: re | im
+  T->re = (double*)aligned_alloc( TWIDDLE_ALIGN, 2 * bytes );
+
+  if(T->re == NULL)
+  {
+    free(T);
+
+    return NULL;
+  }
+
+  T->N = N;
+  T->im = T->re + bytes / sizeof(double);
+
+  // w(k+1) = w(k) - w(k) (a - i b), a = 2 sin^2(d/2), b = sin(d)
+  d = 2.0L * 3.14159265358979323846264338327950288L / (long double)(N);
+  a = 2.0L * sinl(d / 2) * sinl(d / 2);
+  b = sinl(d);
+
+  for(k = 0; k < N; k++)
+  {
+    if(k % TWIDDLE_RESYNC == 0)
+    {
+      c = cosl(d * (long double)(k));
+      s = sinl(d * (long double)(k));
+    }
+
+    T->re[k] = (double)(c);
+    T->im[k] = (double)(s);
+
+    t = c - (a * c + b * s);
+    s = s + (b * c - a * s);
+    c = t;
+  }
+
+  return T;
+}
+
+/**
+@brief  Unlinks and frees least recently used unreferenced tables until the
+        cache fits its cap
+@param  none
+@retval TRUE if cache fits the cap, FALSE otherwise
+@note Caller must hold twiddle_lock
+*/
+uint8_t twiddle_evict(void)
+{
+  Twiddle T = NULL, prev = NULL, lru = NULL, lruPrev = NULL;
+
+  while(twiddle_bytes > twiddle_limit)
+  {
+    lru = NULL;
+    lruPrev = NULL;
+    prev = NULL;
+
+    for(T = twiddle_head; T != NULL; prev = T, T = T->next)
+    {
+      if(T->refs == 0 && (lru == NULL || T->stamp < lru->stamp))
+      {
+        lru = T;
+        lruPrev = prev;
+      }
+    }
+
+    if(lru == NULL)
+    {
+      return FALSE;
+    }
+
+    if(lruPrev == NULL)
+    {
+      twiddle_head = lru->next;
+    }
+    else
+    {
+      lruPrev->next = lru->next;
+    }
+
+    twiddle_bytes -= 2 * twiddle_arrayBytes(lru->N);
+    free(lru->re);
+    free(lru);
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Looks up a cached table and takes a reference on it
+@param  N: Table size
+@retval Pointer to table, NULL if not cached
+@note Caller must hold twiddle_lock
+*/
+Twiddle twiddle_find(size_t N)
+{
+  Twiddle T = NULL;
+
+  for(T = twiddle_head; T != NULL; T = T->next)
+  {
+    if(T->N == N)
+    {
+      T->refs++;
+      T->stamp = ++twiddle_clock;
+
+      return T;
+    }
+  }
+
+  return NULL;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Gets the table for size N, creating it on first use. Thread-safe
+@param  N: Table size
+@retval Pointer to table, NULL on error
+@note Every acquire must be paired with twiddle_release. Tables are read-only
+*/
+Twiddle twiddle_acquire(size_t N)
+{
+  Twiddle T = NULL, New = NULL;
+
+  if(N == 0)
+  {
+    return NULL;
+  }
+
+  pthread_mutex_lock(&twiddle_lock);
+  T = twiddle_find(N);
+  pthread_mutex_unlock(&twiddle_lock);
+
+  if(T != NULL)
+  {
+    return T;
+  }
+
+  // Table is generated outside the lock; another thread may win the race
+  New = twiddle_create(N);
+
+  if(New == NULL)
+  {
+    return NULL;
+  }
+
+  pthread_mutex_lock(&twiddle_lock);
+  T = twiddle_find(N);
+
+  if(T == NULL)
+  {
+    T = New;
+    T->refs = 1;
+    T->stamp = ++twiddle_clock;
+    T->next = twiddle_head;
+    twiddle_head = T;
+    twiddle_bytes += 2 * twiddle_arrayBytes(N);
+    New = NULL;
+
+    twiddle_evict();
+  }
+
+  pthread_mutex_unlock(&twiddle_lock);
+
+  if(New != NULL)
+  {
+    free(New->re);
+    free(New);
+  }
+
+  return T;
+}
+
+/**
+@brief  Drops a reference. Unreferenced tables stay cached until evicted
+@param  T: Table
+@retval TRUE if reference was released, FALSE otherwise
+*/
+uint8_t twiddle_release(Twiddle T)
+{
+  uint8_t ok = FALSE;
+
+  if(T != NULL)
+  {
+    pthread_mutex_lock(&twiddle_lock);
+
+    if(T->refs > 0)
+    {
+      T->refs--;
+      ok = TRUE;
+    }
+
+    // Tables kept over the cap while referenced are evicted now
+    twiddle_evict();
+
+    pthread_mutex_unlock(&twiddle_lock);
+  }
+
+  return ok;
+}
+
+/**
+@brief  Sets the memory cap, evicting least recently used unreferenced tables
+@param  bytes: Max. bytes held by the cache
+@retval TRUE if cache fits the cap, FALSE if referenced tables exceed it
+*/
+uint8_t twiddle_setLimit(size_t bytes)
+{
+  uint8_t ok = FALSE;
+
+  pthread_mutex_lock(&twiddle_lock);
+  twiddle_limit = bytes;
+  ok = twiddle_evict();
+  pthread_mutex_unlock(&twiddle_lock);
+
+  return ok;
+}
+
+/**
+@brief  Gets the number of bytes held by the cache
+@param  none
+@retval Bytes
+*/
+size_t twiddle_usage(void)
+{
+  size_t bytes = 0;
+
+  pthread_mutex_lock(&twiddle_lock);
+  bytes = twiddle_bytes;
+  pthread_mutex_unlock(&twiddle_lock);
+
+  return bytes;
+}
+
+/**
+@brief  Frees every unreferenced table
+@param  none
+@retval TRUE if cache is empty, FALSE if referenced tables remain
+*/
+uint8_t twiddle_clear(void)
+{
+  size_t limit = 0;
+  uint8_t ok = FALSE;
+
+  pthread_mutex_lock(&twiddle_lock);
+  limit = twiddle_limit;
+  twiddle_limit = 0;
+  ok = twiddle_evict();
+  twiddle_limit = limit;
+  pthread_mutex_unlock(&twiddle_lock);
+
+  return ok;
+}
@@ -0,0 +1,106 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_Twiddle.h
+ * Description   : Shared cache of roots-of-unity (twiddle) tables. Header file.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _TWIDDLE_H_
+#define _TWIDDLE_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<pthread.h>
+#include"ADT_Complex.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Table alignment in bytes (one cache line, widest SIMD register)
+#define TWIDDLE_ALIGN (size_t)(64)
+
+// Default memory cap for the whole cache
+#define TWIDDLE_DEFAULT_LIMIT (size_t)(64u << 20)
+
+// Recurrence steps between direct (cosl / sinl) evaluations
+#define TWIDDLE_RESYNC (size_t)(64)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Table of exp(2*pi*i*k/N), k = 0..N-1
+typedef struct twiddle_table
+{
+  size_t   N;                     // Table size
+  double*  re;                    // cos(2*pi*k/N)
+  double*  im;                    // sin(2*pi*k/N)
+  uint32_t refs;                  // Active users
+  uint64_t stamp;                 // Last use (LRU order)
+  struct twiddle_table* next;     // Next cached table
+}
+t_twiddleTable;
+
+typedef t_twiddleTable* Twiddle;
+
+// Twiddle cache handler
+typedef struct twiddle_handler
+{
+  Twiddle (*acquire)(size_t N);         // Get table (reference counted)
+  uint8_t (*release)(Twiddle T);        // Drop reference
+  uint8_t (*limit)(size_t bytes);       // Set memory cap
+  size_t  (*usage)(void);               // Bytes held by the cache
+  uint8_t (*clear)(void);               // Free unreferenced tables
+}
+t_TwiddleHandler;
+
+extern t_TwiddleHandler Tw_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Gets the table for size N, creating it on first use. Thread-safe
+@param  N: Table size
+@retval Pointer to table, NULL on error
+@note Every acquire must be paired with twiddle_release. Tables are read-only
+*/
+extern Twiddle twiddle_acquire(size_t N);
+
+/**
+@brief  Drops a reference. Unreferenced tables stay cached until evicted
+@param  T: Table
+@retval TRUE if reference was released, FALSE otherwise
+*/
+extern uint8_t twiddle_release(Twiddle T);
+
+/**
+@brief  Sets the memory cap, evicting least recently used unreferenced tables
+@param  bytes: Max. bytes held by the cache
+@retval TRUE if cache fits the cap, FALSE if referenced tables exceed it
+*/
+extern uint8_t twiddle_setLimit(size_t bytes);
+
+/**
+@brief  Gets the number of bytes held by the cache
+@param  none
+@retval Bytes
+*/
+extern size_t twiddle_usage(void);
+
+/**
+@brief  Frees every unreferenced table
+@param  none
+@retval TRUE if cache is empty, FALSE if referenced tables remain
+*/
+extern uint8_t twiddle_clear(void);
+
+#endif
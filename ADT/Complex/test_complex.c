@@ -4,8 +4,8 @@
  * Filename      : test_complex.c
  * Description   : Test file for complex numbers ADT.
  * Version       : 01.00
- * Revision      : 5
- * Last modified : 01/17/2021
+ * Revision      : 7
+ * Last modified : 10/18/2026
  * -----------------------------------------------------------------------------
  */
 
@@ -23,6 +23,15 @@ int main()
   // New complex numbers
   Complex Z1 = NULL, Z2 = NULL, Z3 = NULL, Z4 = NULL, Z5 = NULL;
   
+  // Roots buffer
+  t_complex Zr[5];
+  uint8_t k = 0;
+  
+  // Arena mode
+  t_complexArenaStats S;
+  Complex Za = NULL;
+  uint32_t i = 0;
+  
   printf("***** BEGIN OF TEST *****\n");
   printf("\n");
   
@@ -512,6 +521,40 @@ int main()
     printf("\n");
   }
   
+  // Delete Z4 to allocate result
+  if( !Cmplx_Hdlr.del(Z4)   )
+  {
+    printf("ERROR DELETING Z4\n");
+    exit(-1);
+  }
+  
+  // Negative integer exponent whose positive power squared overflows
+  Z5 = Cmplx_Hdlr.init(12.0, 16.0);
+  Z4 = Cmplx_Hdlr.pow(Z5, -200);
+  
+  if(Z4 == NULL)
+  {
+    printf("ERROR IN POWER OPERATION\n");
+  }
+  else
+  {
+    printf("Z4 = (12 + 16i)^(-200): \n");
+    printf( "| Z4 | = %.04e, 20^(-200) = %.04e %s\n", 
+            Cmplx_Hdlr.modulus(Z4), pow(20.0, -200.0),
+            ( fabs(Cmplx_Hdlr.modulus(Z4) / pow(20.0, -200.0) - 1) < 1e-12 ) ? 
+            "OK" : "FAIL" );
+            
+    printf("\n");
+  }
+  
+  if( !Cmplx_Hdlr.del(Z5)   )
+  {
+    printf("ERROR DELETING Z5\n");
+    exit(-1);
+  }
+  
+  Z5 = Cmplx_Hdlr.init(0.0, 0.0);
+  
   // 8. Natural exponential
   
   // Delete Z4 to allocate result
@@ -658,6 +701,23 @@ int main()
     printf("\n");
   }
   
+  // Calculate all 5th roots
+  if( !Cmplx_Hdlr.allroots(Z1, 5, Zr) )
+  {
+    printf("ERROR IN ROOTS OPERATION\n");
+  }
+  else
+  {
+    printf("Roots of Z1^(1/5): \n");
+    
+    for(k = 0; k < 5; k++)
+    {
+      printf("W%d = ", k); complex_print(&Zr[k], CARTESIAN);
+    }
+    
+    printf("\n");
+  }
+  
   // 11. Natural logarithm
   
   // Delete Z4 to allocate result
@@ -1459,6 +1519,39 @@ int main()
   printf("Complex numbers deleted\n");
   printf("\n");
   
+  // Legacy call chain in arena mode: intermediates are not freed one by one
+  complex_arena_begin();
+  
+  Z1 = Cmplx_Hdlr.init(2.0, 3.0);
+  Za = Cmplx_Hdlr.init(1.0, 0.0);
+  
+  for(i = 0; i < 10000; i++)
+  {
+    Z2 = Cmplx_Hdlr.scalar(Z1, 1e-4);
+    Z3 = Cmplx_Hdlr.exp(Z2);
+    Z4 = Cmplx_Hdlr.product(Za, Z3);
+    Cmplx_Hdlr.del(Za);               // No-op inside the arena
+    Za = Z4;
+  }
+  
+  printf("Arena: exp(Z1) by 10000 steps = "); complex_print(Za, CARTESIAN);
+  complex_arena_stats(&S);
+  printf("Arena: %llu objects, %llu bytes served, %llu chunks, %llu bytes "
+         "reserved\n", (unsigned long long)S.objects, 
+         (unsigned long long)S.bytes, (unsigned long long)S.chunks, 
+         (unsigned long long)S.reserved);
+  
+  if( !complex_arena_end() )
+  {
+    printf("ERROR ENDING ARENA\n");
+    exit(-1);
+  }
+  
+  complex_arena_stats(&S);
+  printf("Arena released: %llu bytes reserved\n", 
+         (unsigned long long)S.reserved);
+  printf("\n");
+  
   printf("***** END OF TEST *****");
   
   return 0;
@@ -0,0 +1,449 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_complexgeneric.c
+ * Description   : Test file for single / extended precision complex numbers.
+ * Version       : 01.00
+ * Revision      : 04
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<time.h>
+#include<float.h>
+#include"ADT_ComplexGeneric.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Benchmark buffer length
+#define BENCH_N (size_t)(4096)
+
+// Multiply-accumulate benchmark over one precision (by-value API)
+#define BENCH_MAC(T, VAL, label)                                              \
+  {                                                                           \
+    T* a = (T*)malloc( BENCH_N * sizeof(T) );                                 \
+    T acc = VAL##_make(0, 0);                                                 \
+    size_t i = 0, runs = 0;                                                   \
+    clock_t t0 = 0;                                                           \
+    double t = 0;                                                             \
+                                                                              \
+    for(i = 0; i < BENCH_N; i++)                                              \
+    {                                                                         \
+      a[i] = VAL##_make(cos(0.01 * i), sin(0.01 * i));                        \
+    }                                                                         \
+                                                                              \
+    t0 = clock();                                                             \
+                                                                              \
+    do                                                                        \
+    {                                                                         \
+      for(i = 0; i + 1 < BENCH_N; i++)                                        \
+      {                                                                       \
+        acc = VAL##_sum(acc, VAL##_product(a[i], a[i + 1]));                  \
+      }                                                                       \
+                                                                              \
+      runs++;                                                                 \
+      t = (double)(clock() - t0) / CLOCKS_PER_SEC;                            \
+    } while(t < 0.2);                                                         \
+                                                                              \
+    printf("%-12s (%2zu bytes): %7.2f Mops/s (acc = %.3e)\n", label,          \
+           sizeof(T), (BENCH_N - 1) * runs / t * 1e-6,                        \
+           (double)( VAL##_polar(acc).Mod ) );                                \
+    free(a);                                                                  \
+  }
+
+// Checks that one function gives the same branch in every precision of the
+// by-value API (double, float and long double)
+#define CHECK_BRANCH(fn, re, im)                                              \
+  {                                                                           \
+    t_complex  d = cval_##fn( cval_make(re, im) );                            \
+    t_complexf f = cvalf_##fn( cvalf_make((float)(re), (float)(im)) );        \
+    t_complexl l = cvall_##fn( cvall_make(re, im) );                          \
+    double m = hypot(d.Real, d.Imag);                                         \
+                                                                              \
+    if(hypot(d.Real - f.Real, d.Imag - f.Imag) > 1e-4 * (1 + m) ||            \
+       hypot(d.Real - (double)(l.Real), d.Imag - (double)(l.Imag)) >          \
+       1e-12 * (1 + m))                                                       \
+    {                                                                         \
+      printf("%-5s(%5.2f, %5.2f): FAIL\n", #fn, re, im);                      \
+      fails++;                                                                \
+    }                                                                         \
+  }
+
+// Checks one square root against its expected value, with a relative error
+// per component (a tiny component is not hidden by the other one)
+#define CHECK_SQRT(T, VAL, re, im, er, ei, tol)                               \
+  {                                                                           \
+    T r = VAL##_sqrt( VAL##_make(re, im) );                                   \
+                                                                              \
+    if(fabsl((long double)(r.Real) - (er)) > (tol) * fabsl(er) ||             \
+       fabsl((long double)(r.Imag) - (ei)) > (tol) * fabsl(ei))               \
+    {                                                                         \
+      printf("%-12s sqrt(%Lg, %Lg) = %Lg %+Lg i: FAIL\n", #T,                 \
+             (long double)(re), (long double)(im),                            \
+             (long double)(r.Real), (long double)(r.Imag));                   \
+      fails++;                                                                \
+    }                                                                         \
+  }
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Test points (branch cuts, baseline outputs)
+const double pts[8][2] = { {2.0, 3.0}, {-1.0, 5.6}, {-2.0, -3.0}, {0.5, -0.2},
+                           {-0.3, 0.1}, {3.0, 0.0}, {-3.0, 0.0}, {1.5, -4.0} };
+
+// Double handler outputs at pts[] before sqrt, inv and the inverse functions
+// wrapped the template, in the order of check_baseline()
+const double base_out[14][8][2] = {
+  { // sqrt
+    { 1.674149228, 0.8959774761 }, { 1.531108269, 1.828740695 },
+    { 0.8959774761, -1.674149228 }, { 0.7205957538, -0.1387740623 },
+    { 0.0900770948, 0.555080069 }, { 1.732050808, 0.0 },
+    { 0.0, 0.0 }, { 1.698823398, -1.17728541 }
+  },
+  { // inv
+    { 0.1538461538, 0.2307692308 }, { -0.03090234858, 0.173053152 },
+    { -0.1538461538, -0.2307692308 }, { 1.724137931, -0.6896551724 },
+    { -3.0, 1.0 }, { 0.3333333333, 0.0 },
+    { -0.3333333333, 0.0 }, { 0.08219178082, -0.2191780822 }
+  },
+  { // asin
+    { 0.5706527843, 1.98338703 }, { -0.1740918124, 2.438789504 },
+    { -0.5706527843, -1.98338703 }, { 0.5090856594, -0.2270882654 },
+    { -0.3029811073, 0.1045814988 }, { 1.570796327, -1.098612289 },
+    { -1.570796327, 1.762747174 }, { 0.350035171, -2.1555081 }
+  },
+  { // acos
+    { 1.000143542, -1.98338703 }, { 1.744888139, -2.438789504 },
+    { 2.141449111, 1.98338703 }, { 1.061710667, 0.2270882654 },
+    { 1.873777434, -0.1045814988 }, { -2.948965516e-10, 1.098612289 },
+    { 3.141592653, -1.762747174 }, { 1.220761155, 2.1555081 }
+  },
+  { // atan
+    { 1.40992105, 0.229072683 }, { -1.538951699, 0.1746369334 },
+    { -1.40992105, -0.229072683 }, { 0.4766952175, -0.1603155863 },
+    { -0.2940013018, 0.09193119503 }, { 1.249045772, 1.110223025e-16 },
+    { -1.249045772, 1.110223025e-16 }, { 1.48470092, -0.2211713481 }
+  },
+  { // acsc
+    { 0.1503856043, -0.2313346986 }, { -3.111138591, 0.1722799442 },
+    { -2.991207049, -0.2313346986 }, { 1.1314742, 1.260309917 },
+    { -1.908497436, 1.824198702 }, { 0.3398369095, 0.0 },
+    { -2.801755744, -0.0 }, { 0.08036050346, 0.2181532258 }
+  },
+  { // asec
+    { 1.420410722, 0.2313346986 }, { 4.681934917, -0.1722799442 },
+    { 4.562003376, 0.2313346986 }, { 0.4393221262, -1.260309917 },
+    { 3.479293763, -1.824198702 }, { 1.230959417, -0.0 },
+    { 4.372552071, 0.0 }, { 1.490435823, -0.2181532258 }
+  },
+  { // acot
+    { 0.1608752772, -0.229072683 }, { -0.03184462778, -0.1746369334 },
+    { -0.1608752772, 0.229072683 }, { 1.094101109, 0.1603155863 },
+    { -1.276795025, -0.09193119503 }, { 0.3217505544, 1.110223025e-16 },
+    { -0.3217505544, 1.110223025e-16 }, { 0.08609540726, 0.2211713481 }
+  },
+  { // asinh
+    { 1.968637926, 0.9646585044 }, { -2.424291783, 1.391354082 },
+    { -1.968637926, -0.9646585044 }, { 0.4884827894, -0.1792594545 },
+    { -0.2969990234, 0.09589295928 }, { 1.818446459, 0.0 },
+    { -1.818446459, 0.0 }, { 2.134875768, -1.202732212 }
+  },
+  { // acosh
+    { 1.98338703, 1.000143542 }, { -2.438789504, -1.744888139 },
+    { -1.98338703, 2.141449111 }, { 0.2270882654, -1.061710667 },
+    { -0.1045814988, -1.873777434 }, { 1.762747174, 0.0 },
+    { -1.762747174, 3.141592653 }, { 2.1555081, -1.220761156 }
+  },
+  { // atanh
+    { 0.1469466662, 1.338972522 }, { -0.03001201057, 1.399284357 },
+    { -0.1469466662, -1.338972522 }, { 0.5166065434, -0.2565289547 },
+    { -0.3059438579, 0.1093344729 }, { 0.3465735903, 1.570796327 },
+    { -0.3465735903, 1.570796327 }, { 0.07856227496, -1.353674166 }
+  },
+  { // acsch
+    { 0.1573554988, -0.2299629024 }, { 0.03137010865, -2.967750319 },
+    { 0.1573554988, 2.911629751 }, { 1.363573287, 0.3374654236 },
+    { 1.864161544, -2.833989004 }, { 0.3274501502, 0.0 },
+    { 0.3274501502, 3.141592653 }, { 0.0841258577, 0.2201794901 }
+  },
+  { // asech
+    { 0.2313346986, -1.420410722 }, { 0.1722799442, -1.60125039 },
+    { 0.2313346986, 1.721181931 }, { 1.260309917, 0.4393221265 },
+    { 1.824198702, -2.803891544 }, { -1.098612289, 0.0 },
+    { 0.0, -1.910633236 }, { 0.2181532258, 1.490435823 }
+  },
+  { // acoth
+    { 0.1469466662, -0.2318238045 }, { -0.03001201057, -0.1715119702 },
+    { -0.1469466662, 0.2318238045 }, { 0.5166065434, 1.314267372 },
+    { -0.3059438579, -1.461461854 }, { 0.3465735903, 0.0 },
+    { -0.3465735903, 0.0 }, { 0.07856227496, 0.2171221604 }
+  }
+};
+
+// Intended changes (bit i: pts[i]). Reciprocal sign, and so acsc / asec /
+// acsch; sqrt of negative reals; asin / acos / asech of reals > 1; acosh
+// branch (Re >= 0). Other entries only move by the old truncated PI
+const uint8_t base_changed[14] = {
+  0x40, 0x9F, 0x20, 0x20, 0x00, 0x56, 0x56,  // sqrt ... asec
+  0x00, 0x00, 0x56, 0x00, 0x56, 0x20, 0x00   // acot ... acoth
+};
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Square of a complex value (inverse of sqrt)
+@param  z: Complex value
+@retval z * z
+*/
+t_complex square(t_complex z)
+{
+  return cval_product(z, z);
+}
+
+/**
+@brief  Compares the double handler with its baseline outputs: unchanged
+        entries must match, intended changes must differ and invert
+@param  none
+@retval Number of failures
+*/
+size_t check_baseline(void)
+{
+  struct
+  {
+    const char* name;
+    Complex   (*hdlr)(Complex Z);      // Function under test
+    t_complex (*val)(t_complex z);     // Same function, by value
+    t_complex (*fwd)(t_complex z);     // Its inverse
+  } fn[14] = {
+    { "sqrt",  Cmplx_Hdlr.sqrt,  cval_sqrt,  square    },
+    { "inv",   Cmplx_Hdlr.inv,   cval_inv,   cval_inv  },
+    { "asin",  Cmplx_Hdlr.asin,  cval_asin,  cval_sin  },
+    { "acos",  Cmplx_Hdlr.acos,  cval_acos,  cval_cos  },
+    { "atan",  Cmplx_Hdlr.atan,  cval_atan,  cval_tan  },
+    { "acsc",  Cmplx_Hdlr.acsc,  cval_acsc,  cval_csc  },
+    { "asec",  Cmplx_Hdlr.asec,  cval_asec,  cval_sec  },
+    { "acot",  Cmplx_Hdlr.acot,  cval_acot,  cval_cot  },
+    { "asinh", Cmplx_Hdlr.asinh, cval_asinh, cval_sinh },
+    { "acosh", Cmplx_Hdlr.acosh, cval_acosh, cval_cosh },
+    { "atanh", Cmplx_Hdlr.atanh, cval_atanh, cval_tanh },
+    { "acsch", Cmplx_Hdlr.acsch, cval_acsch, cval_csch },
+    { "asech", Cmplx_Hdlr.asech, cval_asech, cval_sech },
+    { "acoth", Cmplx_Hdlr.acoth, cval_acoth, cval_coth }
+  };
+  size_t f = 0, i = 0, fails = 0, changes = 0;
+
+  for(f = 0; f < 14; f++)
+  {
+    for(i = 0; i < 8; i++)
+    {
+      Complex Z = Cmplx_Hdlr.init(pts[i][0], pts[i][1]);
+      Complex D = fn[f].hdlr(Z);
+      t_complex w = fn[f].val( cval_make(pts[i][0], pts[i][1]) );
+      t_complex e = fn[f].fwd(w);
+      const double* b = base_out[f][i];
+      uint8_t same = 0, ok = 0;
+
+      if(D != NULL)
+      {
+        same = hypot(D->Real - b[0], D->Imag - b[1]) <=
+               1e-8 * (1 + hypot(b[0], b[1]));
+        ok   = (D->Real == w.Real && D->Imag == w.Imag);
+      }
+
+      if( (base_changed[f] >> i) & 1 )
+      {
+        ok = ok && !same &&
+             hypot(e.Real - pts[i][0], e.Imag - pts[i][1]) <=
+             1e-12 * (1 + hypot(pts[i][0], pts[i][1]));
+        changes++;
+      }
+      else
+      {
+        ok = ok && same;
+      }
+
+      if(!ok)
+      {
+        printf("%-5s(%5.2f, %5.2f): FAIL\n", fn[f].name, pts[i][0],
+               pts[i][1]);
+        fails++;
+      }
+
+      Cmplx_Hdlr.del(D);
+      Cmplx_Hdlr.del(Z);
+    }
+  }
+
+  printf("%zu baseline outputs, %zu intended changes: %s\n", f * i, changes,
+         (fails == 0) ? "OK" : "FAIL");
+
+  return fails;
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  Complexf F1 = NULL, F2 = NULL, F3 = NULL;
+  Complexl L1 = NULL, L2 = NULL, L3 = NULL;
+  Complex  D1 = NULL, D2 = NULL, D3 = NULL;
+  t_complexl R[4];
+  t_complex z, w;
+  uint8_t k = 0;
+  size_t i = 0, fails = 0, n = 0;
+  long double a = sqrtl( (sqrtl(2) - 1) / 2 );   // sqrt(-1 + i) = a + bi
+  long double b = sqrtl( (sqrtl(2) + 1) / 2 );
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Same handler surface in every precision
+  F1 = Cmplxf_Hdlr.init(2.0f, 3.0f);
+  F2 = Cmplxf_Hdlr.init(-1.0f, 5.6f);
+  L1 = Cmplxl_Hdlr.init(2.0L, 3.0L);
+  L2 = Cmplxl_Hdlr.init(-1.0L, 5.6L);
+  D1 = Cmplx_Hdlr.init(2.0, 3.0);
+  D2 = Cmplx_Hdlr.init(-1.0, 5.6);
+
+  if(F1 == NULL || F2 == NULL || L1 == NULL || L2 == NULL || D1 == NULL ||
+     D2 == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  F3 = Cmplxf_Hdlr.division(F1, F2);
+  L3 = Cmplxl_Hdlr.division(L1, L2);
+  D3 = Cmplx_Hdlr.division(D1, D2);
+  printf("Z1/Z2 (float):       "); complexf_print(F3, CARTESIAN);
+  printf("Z1/Z2 (long double): "); complexl_print(L3, CARTESIAN);
+  printf("Z1/Z2 (double):      "); complex_print(D3, CARTESIAN);
+  Cmplxf_Hdlr.del(F3); Cmplxl_Hdlr.del(L3); Cmplx_Hdlr.del(D3);
+
+  F3 = Cmplxf_Hdlr.asin(F1);
+  L3 = Cmplxl_Hdlr.asin(L1);
+  D3 = Cmplx_Hdlr.asin(D1);
+  printf("asin(Z1) (float):       "); complexf_print(F3, CARTESIAN);
+  printf("asin(Z1) (long double): "); complexl_print(L3, CARTESIAN);
+  printf("asin(Z1) (double):      "); complex_print(D3, CARTESIAN);
+  Cmplxf_Hdlr.del(F3); Cmplxl_Hdlr.del(L3); Cmplx_Hdlr.del(D3);
+
+  F3 = Cmplxf_Hdlr.acosh(F2);
+  L3 = Cmplxl_Hdlr.acosh(L2);
+  D3 = Cmplx_Hdlr.acosh(D2);
+  printf("acosh(Z2) (float):       "); complexf_print(F3, CARTESIAN);
+  printf("acosh(Z2) (long double): "); complexl_print(L3, CARTESIAN);
+  printf("acosh(Z2) (double):      "); complex_print(D3, CARTESIAN);
+  Cmplxf_Hdlr.del(F3); Cmplxl_Hdlr.del(L3); Cmplx_Hdlr.del(D3);
+
+  F3 = Cmplxf_Hdlr.pow(F1, 7);
+  L3 = Cmplxl_Hdlr.pow(L1, 7);
+  printf("Z1^7 (float):       "); complexf_print(F3, CARTESIAN);
+  printf("Z1^7 (long double): "); complexl_print(L3, CARTESIAN);
+  Cmplxf_Hdlr.del(F3); Cmplxl_Hdlr.del(L3);
+
+  if( Cmplxl_Hdlr.allroots(L1, 4, R) )
+  {
+    printf("Roots of Z1^(1/4) (long double):\n");
+
+    for(k = 0; k < 4; k++)
+    {
+      printf("W%d = ", k); complexl_print(&R[k], CARTESIAN);
+    }
+  }
+
+  printf("\n");
+
+  // Inverse functions: one principal branch in every precision
+  printf("* Branch cuts (double vs. float / long double) *\n");
+
+  for(i = 0; i < sizeof(pts) / sizeof(pts[0]); i++)
+  {
+    CHECK_BRANCH(sqrt,  pts[i][0], pts[i][1])
+    CHECK_BRANCH(inv,   pts[i][0], pts[i][1])
+    CHECK_BRANCH(asin,  pts[i][0], pts[i][1])
+    CHECK_BRANCH(acos,  pts[i][0], pts[i][1])
+    CHECK_BRANCH(atan,  pts[i][0], pts[i][1])
+    CHECK_BRANCH(acsc,  pts[i][0], pts[i][1])
+    CHECK_BRANCH(asec,  pts[i][0], pts[i][1])
+    CHECK_BRANCH(acot,  pts[i][0], pts[i][1])
+    CHECK_BRANCH(asinh, pts[i][0], pts[i][1])
+    CHECK_BRANCH(acosh, pts[i][0], pts[i][1])
+    CHECK_BRANCH(atanh, pts[i][0], pts[i][1])
+    CHECK_BRANCH(acsch, pts[i][0], pts[i][1])
+    CHECK_BRANCH(asech, pts[i][0], pts[i][1])
+    CHECK_BRANCH(acoth, pts[i][0], pts[i][1])
+  }
+
+  printf("%zu points x 14 functions: %s\n", i, (fails == 0) ? "OK" : "FAIL");
+  printf("\n");
+
+  // Square root with a negative real part and a tiny imaginary part, and near
+  // overflow (where hypot(Re, Im) is not finite)
+  printf("* Square root (cancellation, overflow) *\n");
+  n = fails;
+  CHECK_SQRT(t_complexf, cvalf, -1.0f, 1e-10f, 5e-11L, 1.0L, 1e-6L)
+  CHECK_SQRT(t_complexf, cvalf, -1.0f, -1e-10f, 5e-11L, -1.0L, 1e-6L)
+  CHECK_SQRT(t_complexf, cvalf, -FLT_MAX, FLT_MAX, sqrtl(FLT_MAX) * a,
+             sqrtl(FLT_MAX) * b, 1e-6L)
+  CHECK_SQRT(t_complex, cval, -1.0, 1e-10, 5e-11L, 1.0L, 1e-15L)
+  CHECK_SQRT(t_complex, cval, -4.0, -1e-300, 2.5e-301L, -2.0L, 1e-15L)
+  CHECK_SQRT(t_complex, cval, -DBL_MAX, DBL_MAX, sqrtl(DBL_MAX) * a,
+             sqrtl(DBL_MAX) * b, 1e-15L)
+  CHECK_SQRT(t_complex, cval, DBL_MAX, DBL_MAX, sqrtl(DBL_MAX) * b,
+             sqrtl(DBL_MAX) * a, 1e-15L)
+  CHECK_SQRT(t_complexl, cvall, -1.0L, 1e-10L, 5e-11L, 1.0L, 1e-18L)
+  CHECK_SQRT(t_complexl, cvall, -1.0L, 1e-4000L, 5e-4001L, 1.0L, 1e-18L)
+  CHECK_SQRT(t_complexl, cvall, -LDBL_MAX, LDBL_MAX, sqrtl(LDBL_MAX) * a,
+             sqrtl(LDBL_MAX) * b, 1e-18L)
+
+  // Signed zero: the imaginary part keeps its sign on the branch cut
+  z = cval_sqrt( cval_make(-4.0, -0.0) );
+
+  if(z.Real != 0 || z.Imag != -2.0)
+  {
+    printf("sqrt(-4 - 0i) = %g %+g i: FAIL\n", z.Real, z.Imag);
+    fails++;
+  }
+
+  printf("sqrt checks: %s\n", (fails == n) ? "OK" : "FAIL");
+  printf("\n");
+
+  // Double handler: sqrt, inv and the inverse functions wrap the template
+  printf("* Double handler vs. baseline outputs *\n");
+  fails += check_baseline();
+  printf("\n");
+
+  // Double precision by-value API: no allocation, no delete
+  z = cval_make(2.0, 3.0);
+  w = cval_sum( cval_product(z, z), cval_scalar(cval_conj(z), 0.5) );
+  printf("Z1*Z1 + conj(Z1)/2 (by value): "); complex_print(&w, CARTESIAN);
+  printf("\n");
+
+  Cmplxf_Hdlr.del(F1); Cmplxf_Hdlr.del(F2);
+  Cmplxl_Hdlr.del(L1); Cmplxl_Hdlr.del(L2);
+  Cmplx_Hdlr.del(D1);  Cmplx_Hdlr.del(D2);
+
+  // Throughput per precision
+  printf("* Benchmark (by-value multiply-accumulate) *\n");
+  BENCH_MAC(t_complexf, cvalf, "float")
+  BENCH_MAC(t_complex,  cval,  "double")
+  BENCH_MAC(t_complexl, cvall, "long double")
+  printf("\n");
+
+  printf("***** END OF TEST *****");
+
+  return (fails == 0) ? 0 : 1;
+}
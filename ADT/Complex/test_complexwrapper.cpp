@@ -0,0 +1,167 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_complexwrapper.cpp
+ * Description   : Test file for C++ complex wrapper (expression templates).
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<ctime>
+#include<vector>
+#include"ADT_Complex.hpp"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Benchmark buffer length
+#define BENCH_N (size_t)(4096)
+
+//----------------------------------------------------------------------------//
+//                              Compile-time checks                           //
+//----------------------------------------------------------------------------//
+
+constexpr adt::complex<double> A(1.0, 2.0), B(3.0, -1.0);
+constexpr adt::complex<double> C = A * B + adt::conj(A) - 2.0 * B;
+
+static_assert(C.real() == 0.0 && C.imag() == 5.0, "constexpr expression");
+
+// Scalars of another arithmetic type convert to the expression precision
+constexpr adt::complex<double> D = A * 2 + 3 * B - A / 2;
+constexpr adt::complex<float> E = adt::complex<float>(1.0f, 1.0f) * 2.0;
+
+static_assert(D.real() == 10.5 && D.imag() == 0.0, "integer scalars");
+static_assert(E.real() == 2.0f && E.imag() == 2.0f, "double scalar on float");
+static_assert(adt::norm(A * B) == 50.0 && A * B == B * A, "norm / equality");
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  adt::complex<double> z1(2.0, 3.0), z2(-1.0, 5.6), z3;
+  adt::complex<float> f1(2.0f, 3.0f), f2;
+  adt::complex<long double> l1(2.0L, 3.0L), l2;
+  std::complex<double> s1(2.0, 3.0), s2(-1.0, 5.6), s3;
+  t_complex c;
+  Complex  H = NULL;
+  double err = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Whole expression evaluated in one pass
+  z3 = z1 * z2 + adt::conj(z1) / z2 - 0.5 * z1 * z1;
+  s3 = s1 * s2 + std::conj(s1) / s2 - 0.5 * s1 * s1;
+  err = std::abs( static_cast< std::complex<double> >(z3) - s3 );
+  printf("Z1*Z2 + conj(Z1)/Z2 - Z1*Z1/2 = %f %+fi (std: %f %+fi) %s\n",
+         z3.real(), z3.imag(), s3.real(), s3.imag(), err < 1e-12 ? "OK" : "FAIL");
+
+  // Expression kept with auto outlives the temporaries it was built from
+  {
+    auto e = adt::complex<double>(2.0, 3.0) * adt::complex<double>(-1.0, 5.6);
+    std::vector<double> scratch(64, -1.0);   // reuses the released stack
+    adt::complex<double> r = e + adt::complex<double>(scratch[0], 0.0);
+
+    printf("auto over temporaries = %f %+fi %s\n", r.real(), r.imag(),
+           (r == z1 * z2 + adt::complex<double>(-1.0)) ? "OK" : "FAIL");
+  }
+
+  // Interop with the C ADT
+  c = z3.c();
+  printf("As t_complex: "); complex_print(&c, CARTESIAN);
+  printf("              "); complex_print(&c, POLAR);
+
+  H = z1.handle();
+  z3 = adt::complex<double>(*H) + z2;
+  printf("Handle + Z2 = %f %+fi\n", z3.real(), z3.imag());
+  Cmplx_Hdlr.del(H);
+
+  // Transcendental functions go through the C by-value API
+  z3 = adt::exp(z1 * z2 / 10.0);
+  s3 = std::exp(s1 * s2 / 10.0);
+  printf("exp(Z1*Z2/10) = %f %+fi (std: %f %+fi)\n",
+         z3.real(), z3.imag(), s3.real(), s3.imag());
+
+  z3 = adt::sqrt(z2);
+  s3 = std::sqrt(s2);
+  printf("sqrt(Z2) = %f %+fi (std: %f %+fi)\n",
+         z3.real(), z3.imag(), s3.real(), s3.imag());
+
+  // Other precisions
+  f2 = f1 * f1 - adt::conj(f1);
+  l2 = l1 * l1 - adt::conj(l1);
+  printf("Z1*Z1 - conj(Z1) (float):       %f %+fi\n", f2.real(), f2.imag());
+  printf("Z1*Z1 - conj(Z1) (long double): %Lf %+Lfi\n", l2.real(), l2.imag());
+  printf("|Z1| (float): %f, arg(Z1) (long double): %Lf\n",
+         adt::abs(f1), adt::arg(l1));
+  printf("\n");
+
+  // Fused multiply-add against std::complex and the C by-value API
+  {
+    std::vector< adt::complex<double> > a(BENCH_N);
+    std::vector< std::complex<double> > b(BENCH_N);
+    std::vector<t_complex> v(BENCH_N);
+    adt::complex<double> acc;
+    std::complex<double> sacc;
+    t_complex vacc = cval_make(0, 0);
+    size_t i = 0, runs = 0;
+    std::clock_t t0 = 0;
+    double t = 0;
+
+    printf("* Benchmark (multiply-accumulate) *\n");
+
+    for(i = 0; i < BENCH_N; i++)
+    {
+      a[i] = adt::complex<double>(cos(0.01 * i), sin(0.01 * i));
+      b[i] = a[i];
+      v[i] = a[i].c();
+    }
+
+    runs = 0; t0 = std::clock();
+    do
+    {
+      for(i = 0; i + 1 < BENCH_N; i++) acc += a[i] * a[i + 1];
+      runs++;
+      t = (double)(std::clock() - t0) / CLOCKS_PER_SEC;
+    } while(t < 0.2);
+    printf("adt::complex : %8.2f Mops/s (acc = %.3e)\n",
+           (BENCH_N - 1) * runs / t * 1e-6, acc.real());
+
+    runs = 0; t0 = std::clock();
+    do
+    {
+      for(i = 0; i + 1 < BENCH_N; i++) sacc += b[i] * b[i + 1];
+      runs++;
+      t = (double)(std::clock() - t0) / CLOCKS_PER_SEC;
+    } while(t < 0.2);
+    printf("std::complex : %8.2f Mops/s (acc = %.3e)\n",
+           (BENCH_N - 1) * runs / t * 1e-6, sacc.real());
+
+    runs = 0; t0 = std::clock();
+    do
+    {
+      for(i = 0; i + 1 < BENCH_N; i++)
+      {
+        vacc = cval_sum(vacc, cval_product(v[i], v[i + 1]));
+      }
+      runs++;
+      t = (double)(std::clock() - t0) / CLOCKS_PER_SEC;
+    } while(t < 0.2);
+    printf("cval (C)     : %8.2f Mops/s (acc = %.3e)\n",
+           (BENCH_N - 1) * runs / t * 1e-6, vacc.Real);
+  }
+
+  printf("\n");
+  printf("***** END OF TEST *****");
+
+  return 0;
+}
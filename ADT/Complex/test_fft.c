@@ -0,0 +1,243 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_fft.c
+ * Description   : Test file for FFT module.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_FFT.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Max. accepted error against direct DFT
+#define TOLERANCE (double)(1e-9)
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Compares FFT of size N against a direct O(N^2) DFT and checks that the
+        inverse transform restores the input
+@param  N: Transform size
+@retval Max. absolute error
+*/
+double test_complex_fft(size_t N)
+{
+  FFTPlan P = FFT_Hdlr.init(N);
+  Complex X = (Complex)malloc( N * sizeof(t_complex) );
+  Complex Y = (Complex)malloc( N * sizeof(t_complex) );
+  double err = 0, sr = 0, si = 0, a = 0;
+  size_t k = 0, n = 0;
+
+  if(P == NULL || X == NULL || Y == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  for(n = 0; n < N; n++)
+  {
+    X[n].Real = sin(0.37 * n) + 0.5;
+    X[n].Imag = cos(1.91 * n * n);
+  }
+
+  FFT_Hdlr.forward(P, X, Y);
+
+  // Direct DFT
+  for(k = 0; k < N; k++)
+  {
+    sr = 0; si = 0;
+
+    for(n = 0; n < N; n++)
+    {
+      a = -TWO_PI * (double)( (k * n) % N ) / (double)(N);
+      sr += X[n].Real * cos(a) - X[n].Imag * sin(a);
+      si += X[n].Real * sin(a) + X[n].Imag * cos(a);
+    }
+
+    err = fmax( err, fmax( fabs(sr - Y[k].Real), fabs(si - Y[k].Imag) ) );
+  }
+
+  // Round trip (in place)
+  FFT_Hdlr.inverse(P, Y, Y);
+
+  for(n = 0; n < N; n++)
+  {
+    err = fmax( err, fmax( fabs(X[n].Real - Y[n].Real),
+                           fabs(X[n].Imag - Y[n].Imag) ) );
+  }
+
+  FFT_Hdlr.del(P);
+  free(X);
+  free(Y);
+
+  return err;
+}
+
+/**
+@brief  Compares real-input FFT of size N against the complex FFT and checks
+        the inverse real transform
+@param  N: Transform size (even)
+@retval Max. absolute error
+*/
+double test_real_fft(size_t N)
+{
+  FFTPlan P = FFT_Hdlr.initReal(N);
+  FFTPlan C = FFT_Hdlr.init(N);
+  double* x = (double*)malloc( N * sizeof(double) );
+  double* y = (double*)malloc( N * sizeof(double) );
+  Complex X = (Complex)malloc( N * sizeof(t_complex) );
+  Complex Z = (Complex)malloc( N * sizeof(t_complex) );
+  double err = 0;
+  size_t n = 0;
+
+  if(P == NULL || C == NULL || x == NULL || y == NULL || X == NULL || Z == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  for(n = 0; n < N; n++)
+  {
+    x[n] = cos(0.23 * n * n) - 0.25;
+    Z[n].Real = x[n];
+    Z[n].Imag = 0;
+  }
+
+  FFT_Hdlr.rForward(P, x, X);
+  FFT_Hdlr.forward(C, Z, Z);
+
+  for(n = 0; n <= N / 2; n++)
+  {
+    err = fmax( err, fmax( fabs(X[n].Real - Z[n].Real),
+                           fabs(X[n].Imag - Z[n].Imag) ) );
+  }
+
+  FFT_Hdlr.rInverse(P, X, y);
+
+  for(n = 0; n < N; n++)
+  {
+    err = fmax( err, fabs(x[n] - y[n]) );
+  }
+
+  FFT_Hdlr.del(P);
+  FFT_Hdlr.del(C);
+  free(x);
+  free(y);
+  free(X);
+  free(Z);
+
+  return err;
+}
+
+/**
+@brief  Measures split-storage complex FFT throughput
+@param  N: Transform size
+@retval GFLOPS (5 N log2(N) flops per transform)
+*/
+double bench_fft(size_t N)
+{
+  FFTPlan P = FFT_Hdlr.init(N);
+  double* re = (double*)calloc( N, sizeof(double) );
+  double* im = (double*)calloc( N, sizeof(double) );
+  struct timespec t0;
+  double t = 0;
+  size_t runs = 0;
+
+  if(P == NULL || re == NULL || im == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  re[1] = 1.0;
+  timespec_get(&t0, TIME_UTC);
+
+  // Alternates directions to keep values bounded
+  do
+  {
+    FFT_Hdlr.split(P, re, im, (runs % 2) ? FFT_INVERSE : FFT_FORWARD);
+    runs++;
+    t = elapsed(t0);
+  } while(t < 0.2);
+
+  FFT_Hdlr.del(P);
+  free(re);
+  free(im);
+
+  return 5.0 * N * log2( (double)(N) ) * runs / t * 1e-9;
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  size_t sizes[] = {1, 2, 3, 4, 5, 7, 8, 12, 15, 16, 30, 64, 97, 100, 256, 1000,
+                    61, 67, 2 * 127, 4099, 67 * 71, 2 * 4001};
+  size_t i = 0, fails = 0;
+  double err = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Complex transforms (radix-4, radix-2, mixed and prime sizes)
+  printf("* Complex FFT vs. direct DFT *\n");
+
+  for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    err = test_complex_fft(sizes[i]);
+    fails += !(err < TOLERANCE);
+    printf("N = %5zu: max. error = %.3e %s\n", sizes[i], err,
+           (err < TOLERANCE) ? "OK" : "ERROR");
+  }
+
+  printf("\n");
+
+  // Real-input transforms
+  printf("* Real FFT vs. complex FFT *\n");
+
+  for(i = 0; i < sizeof(sizes) / sizeof(sizes[0]); i++)
+  {
+    if(sizes[i] % 2 == 0)
+    {
+      err = test_real_fft(sizes[i]);
+      fails += !(err < TOLERANCE);
+      printf("N = %5zu: max. error = %.3e %s\n", sizes[i], err,
+             (err < TOLERANCE) ? "OK" : "ERROR");
+    }
+  }
+
+  printf("\n");
+
+  // Throughput
+  printf("* Benchmark (split storage, in place) *\n");
+
+  for(i = 6; i <= 22; i++)
+  {
+    printf("N = 2^%02zu: %.3f GFLOPS\n", i, bench_fft( (size_t)(1) << i ) );
+  }
+
+  // Large primes (Bluestein stages)
+  printf("N = 65537: %.3f GFLOPS (prime)\n", bench_fft(65537));
+  printf("N = 1000003: %.3f GFLOPS (prime)\n", bench_fft(1000003));
+
+  printf("\n");
+
+  printf("***** END OF TEST *****");
+
+  return (fails == 0) ? 0 : 1;
+}
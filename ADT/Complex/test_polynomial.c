@@ -0,0 +1,236 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_polynomial.c
+ * Description   : Test file for complex polynomials.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<time.h>
+#include"ADT_Polynomial.h"
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Finds the roots of z^n - 1 and reports the worst residual |z^n - 1|
+        and the minimum distance between two roots
+@param  n: Degree
+@retval none
+*/
+void test_unity_roots(size_t n)
+{
+  Complex C = (Complex)calloc( n + 1, sizeof(t_complex) );
+  Complex R = (Complex)malloc( n * sizeof(t_complex) );
+  Polynomial P = NULL;
+  double err = 0, gap = 1e300, t = 0, a = 0;
+  size_t i = 0, j = 0;
+  uint8_t ok = FALSE;
+  clock_t t0 = 0;
+
+  if(C == NULL || R == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  C[0].Real = -1.0;
+  C[n].Real = 1.0;
+  P = Poly_Hdlr.init(C, n);
+
+  if(P == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  t0 = clock();
+  ok = Poly_Hdlr.roots(P, R);
+  t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+
+  for(i = 0; i < n; i++)
+  {
+    // |z^n - 1| through polar form (full precision angle)
+    a = atan2(R[i].Imag, R[i].Real);
+    err = fmax( err, hypot( pow(R[i].Mod, n) * cos(n * a) - 1.0,
+                            pow(R[i].Mod, n) * sin(n * a) ) );
+
+    for(j = i + 1; j < n; j++)
+    {
+      gap = fmin( gap, hypot(R[i].Real - R[j].Real, R[i].Imag - R[j].Imag) );
+    }
+  }
+
+  printf("z^%zu - 1: converged = %d, iterations = %u, residual = %.3e, "
+         "min. gap = %.3e, time = %.4f s %s\n", n, ok, P->iterations, err, gap,
+         t, (ok && err < 1e-9 && gap > 1e-3) ? "OK" : "ERROR");
+
+  Poly_Hdlr.del(P);
+  free(C);
+  free(R);
+}
+
+/**
+@brief  Measures batched evaluation throughput
+@param  n:      Degree
+        points: Number of points
+@retval none
+*/
+void bench_eval(size_t n, size_t points)
+{
+  Complex C = (Complex)malloc( (n + 1) * sizeof(t_complex) );
+  double* zr = (double*)malloc( points * sizeof(double) );
+  double* zi = (double*)malloc( points * sizeof(double) );
+  double* wr = (double*)malloc( points * sizeof(double) );
+  double* wi = (double*)malloc( points * sizeof(double) );
+  Polynomial P = NULL;
+  size_t i = 0, runs = 0;
+  clock_t t0 = 0;
+  double t = 0;
+
+  if(C == NULL || zr == NULL || zi == NULL || wr == NULL || wi == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  for(i = 0; i <= n; i++)
+  {
+    C[i].Real = 1.0 / (i + 1);
+    C[i].Imag = -0.5 / (i + 1);
+  }
+
+  for(i = 0; i < points; i++)
+  {
+    zr[i] = cos(0.1 * i) * 0.9;
+    zi[i] = sin(0.1 * i) * 0.9;
+  }
+
+  P = Poly_Hdlr.init(C, n);
+  t0 = clock();
+
+  do
+  {
+    Poly_Hdlr.evalBatch(P, zr, zi, wr, wi, points);
+    runs++;
+    t = (double)(clock() - t0) / CLOCKS_PER_SEC;
+  } while(t < 0.2);
+
+  // 8 flops per coefficient per point
+  printf("degree %4zu: %.3f GFLOPS (%.2f Mpoints/s)\n", n,
+         8.0 * n * points * runs / t * 1e-9, points * runs / t * 1e-6);
+
+  Poly_Hdlr.del(P);
+  free(C);
+  free(zr);
+  free(zi);
+  free(wr);
+  free(wi);
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  // p(z) = (z - 1)(z + 2i)(z - 3 + i) = z^3 + (-4+3i) z^2 + (1-9i) z + 2+6i
+  t_complex C[4] = { {  2.0,  6.0, sqrt(40.0), atan2( 6.0,  2.0) },
+                     {  1.0, -9.0, sqrt(82.0), atan2(-9.0,  1.0) },
+                     { -4.0,  3.0,        5.0, atan2( 3.0, -4.0) },
+                     {  1.0,  0.0,        1.0,               0.0 } };
+  t_complex R[3];
+  double zr[11], zi[11], wr[11], wi[11], dr[11], di[11];
+  double h = 1e-6, fr = 0, fi = 0, br = 0, bi = 0, err = 0;
+  Polynomial P = NULL;
+  Complex Z = NULL, W = NULL;
+  size_t i = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  P = Poly_Hdlr.init(C, 3);
+  Z = Cmplx_Hdlr.init(1.0, 0.0);
+
+  if(P == NULL || Z == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  printf("p(z) = "); poly_print(P);
+
+  // Single point evaluation
+  W = Poly_Hdlr.eval(P, Z);
+  printf("p(1) = "); complex_print(W, CARTESIAN);
+  Cmplx_Hdlr.del(W);
+  Cmplx_Hdlr.del(Z);
+
+  // Batched evaluation (one full block + tail) and derivative
+  for(i = 0; i < 11; i++)
+  {
+    zr[i] = 0.3 * i - 1.0;
+    zi[i] = 0.1 * i * i - 0.7;
+  }
+
+  Poly_Hdlr.evalBatch(P, zr, zi, wr, wi, 11);
+  Poly_Hdlr.derivBatch(P, zr, zi, dr, di, 11);
+
+  for(i = 0; i < 11; i++)
+  {
+    // Central difference along the real axis
+    zr[i] += h;  Poly_Hdlr.evalBatch(P, &zr[i], &zi[i], &fr, &fi, 1);
+    zr[i] -= 2 * h; Poly_Hdlr.evalBatch(P, &zr[i], &zi[i], &br, &bi, 1);
+    zr[i] += h;
+
+    err = fmax( err, hypot( (fr - br) / (2 * h) - dr[i],
+                            (fi - bi) / (2 * h) - di[i] ) );
+  }
+
+  printf("p'(z) vs. central difference: max. error = %.3e %s\n", err,
+         (err < 1e-6) ? "OK" : "ERROR");
+
+  // Roots
+  if( !Poly_Hdlr.roots(P, R) )
+  {
+    printf("ERROR IN ROOT FINDING\n");
+  }
+  else
+  {
+    printf("Roots (%u iterations):\n", P->iterations);
+
+    for(i = 0; i < 3; i++)
+    {
+      printf("z%zu = ", i + 1); complex_print(&R[i], CARTESIAN);
+    }
+  }
+
+  Poly_Hdlr.del(P);
+  printf("\n");
+
+  // Aberth-Ehrlich on high degrees
+  printf("* Roots of unity *\n");
+  test_unity_roots(10);
+  test_unity_roots(100);
+  test_unity_roots(1000);
+  printf("\n");
+
+  // Throughput
+  printf("* Benchmark (batched Horner, 4096 points) *\n");
+  bench_eval(10, 4096);
+  bench_eval(100, 4096);
+  bench_eval(1000, 4096);
+  printf("\n");
+
+  printf("***** END OF TEST *****");
+
+  return 0;
+}
@@ -0,0 +1,129 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_twiddle.c
+ * Description   : Test file for twiddle table cache.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Twiddle.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Worker threads for concurrent acquire / release
+#define THREADS (uint8_t)(8)
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Acquires and releases tables of a few sizes repeatedly
+@param  arg: Unused
+@retval NULL
+*/
+void* worker(void* arg)
+{
+  Twiddle T = NULL;
+  size_t i = 0;
+
+  for(i = 0; i < 1000; i++)
+  {
+    T = Tw_Hdlr.acquire( (size_t)(64) << (i % 4) );
+
+    if(T == NULL || T->re[0] != 1.0)
+    {
+      printf("ERROR IN CONCURRENT ACQUIRE\n");
+    }
+
+    Tw_Hdlr.release(T);
+  }
+
+  return arg;
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  Twiddle T1 = NULL, T2 = NULL, T3 = NULL;
+  pthread_t th[THREADS];
+  size_t N = (size_t)(1) << 20, k = 0;
+  double err = 0;
+  uint8_t i = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Accuracy against direct evaluation
+  T1 = Tw_Hdlr.acquire(N);
+
+  if(T1 == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  for(k = 0; k < N; k++)
+  {
+    err = fmax( err, fabs(T1->re[k] - cos(TWO_PI * k / N)) );
+    err = fmax( err, fabs(T1->im[k] - sin(TWO_PI * k / N)) );
+  }
+
+  printf("N = 2^20: max. error = %.3e %s\n", err, (err < 1e-15) ? "OK" : "ERROR");
+  printf("Aligned: %s\n",
+         ( (uintptr_t)(T1->re) % TWIDDLE_ALIGN == 0 &&
+           (uintptr_t)(T1->im) % TWIDDLE_ALIGN == 0 ) ? "OK" : "ERROR");
+
+  // Same N shares one table
+  T2 = Tw_Hdlr.acquire(N);
+  printf("Shared table: %s (refs = %u)\n", (T1 == T2) ? "OK" : "ERROR", T1->refs);
+
+  Tw_Hdlr.release(T2);
+  Tw_Hdlr.release(T1);
+  printf("Cache usage: %zu bytes\n", Tw_Hdlr.usage());
+
+  // LRU eviction under a cap that fits one 2^20 table
+  Tw_Hdlr.limit( 2 * N * sizeof(double) );
+  T3 = Tw_Hdlr.acquire(N / 2);
+  Tw_Hdlr.release(T3);
+  printf("After eviction: %zu bytes %s\n", Tw_Hdlr.usage(),
+         (Tw_Hdlr.usage() <= 2 * N * sizeof(double)) ? "OK" : "ERROR");
+
+  // Referenced tables are never evicted
+  T1 = Tw_Hdlr.acquire(N);
+  printf("Clear with live reference: %s\n", Tw_Hdlr.clear() ? "ERROR" : "OK");
+  Tw_Hdlr.release(T1);
+  Tw_Hdlr.limit(TWIDDLE_DEFAULT_LIMIT);
+
+  // Concurrent users
+  for(i = 0; i < THREADS; i++)
+  {
+    pthread_create(&th[i], NULL, worker, NULL);
+  }
+
+  for(i = 0; i < THREADS; i++)
+  {
+    pthread_join(th[i], NULL);
+  }
+
+  printf("Concurrent acquire / release done\n");
+  printf("Clear: %s\n", Tw_Hdlr.clear() ? "OK" : "ERROR");
+  printf("Cache usage: %zu bytes\n", Tw_Hdlr.usage());
+  printf("\n");
+
+  printf("***** END OF TEST *****");
+
+  return 0;
+}
@@ -0,0 +1,649 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_ComplexMatrix.c
+ * Description   : Abstract Data Type for complex matrices. Library file.
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_ComplexMatrix.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Complex matrix handler
+t_CMatrixHandler CMx_Hdlr =
+{
+  cmatrix_create,           // Create
+  cmatrix_identity,         // Identity
+  cmatrix_isNull,           // Null matrix?
+  cmatrix_getRows,          // Get #rows
+  cmatrix_getColumns,       // Get #columns
+  cmatrix_get,              // Get element
+  cmatrix_update,           // Update element
+  cmatrix_areEqual,         // M1 == M2?
+  cmatrix_sum,              // Matrix sum
+  cmatrix_scalar,           // Scalar product
+  cmatrix_product,          // Matrix product
+  cmatrix_inverse,          // Inverse matrix
+  cmatrix_transpose,        // Transpose
+  cmatrix_hermitian,        // Conj. transpose
+  cmatrix_delete            // Delete matrix
+};
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Copies a matrix, optionally transposed and/or conjugated
+@param  M:     Pointer to matrix
+        trans: TRUE to transpose
+        conj:  TRUE to conjugate
+@retval Pointer to new matrix
+*/
+CMatrix cmatrix_copy(CMatrix M, uint8_t trans, uint8_t conj)
+{
+  CMatrix T = NULL;
+  size_t i = 0, j = 0, ib = 0, jb = 0;
+
+  if(M == NULL)
+  {
+    return NULL;
+  }
+
+  T = trans ? cmatrix_create(M->columns, M->rows) :
+              cmatrix_create(M->rows, M->columns);
+
+  if(T == NULL)
+  {
+    return NULL;
+  }
+
+  if(!trans)
+  {
+    for(i = 0; i < M->rows; i++)
+    {
+      for(j = 0; j < M->columns; j++)
+      {
+        T->re[i * T->ld + j] = M->re[i * M->ld + j];
+        T->im[i * T->ld + j] = conj ? 0.0 - M->im[i * M->ld + j] :
+                                      M->im[i * M->ld + j];
+      }
+    }
+
+    return T;
+  }
+
+  // Transposition by tiles keeps both sides in cache
+  for(ib = 0; ib < M->rows; ib += CMX_PAD * 4)
+  {
+    for(jb = 0; jb < M->columns; jb += CMX_PAD * 4)
+    {
+      for(i = ib; i < M->rows && i < ib + CMX_PAD * 4; i++)
+      {
+        for(j = jb; j < M->columns && j < jb + CMX_PAD * 4; j++)
+        {
+          T->re[j * T->ld + i] = M->re[i * M->ld + j];
+          T->im[j * T->ld + i] = conj ? 0.0 - M->im[i * M->ld + j] :
+                                      M->im[i * M->ld + j];
+        }
+      }
+    }
+  }
+
+  return T;
+}
+
+/**
+@brief  Product kernel on one block: C[i0:i1, j0:j1] += A[i0:i1, k0:k1] B[k0:k1,
+        j0:j1]
+@param  A, B, C: Operand and result matrices
+        i0, i1:  Row range
+        k0, k1:  Inner range
+        j0, j1:  Column range
+@retval none
+*/
+void cmatrix_kernel(CMatrix A, CMatrix B, CMatrix C, size_t i0, size_t i1,
+                    size_t k0, size_t k1, size_t j0, size_t j1)
+{
+  size_t i = 0, k = 0, j = 0;
+  double ar = 0, ai = 0;
+  double* restrict cr = NULL;
+  double* restrict ci = NULL;
+  const double* restrict br = NULL;
+  const double* restrict bi = NULL;
+
+  for(i = i0; i < i1; i++)
+  {
+    cr = &C->re[i * C->ld];
+    ci = &C->im[i * C->ld];
+
+    for(k = k0; k < k1; k++)
+    {
+      ar = A->re[i * A->ld + k];
+      ai = A->im[i * A->ld + k];
+      br = &B->re[k * B->ld];
+      bi = &B->im[k * B->ld];
+
+      // Contiguous in j on split planes: vectorizes
+      for(j = j0; j < j1; j++)
+      {
+        cr[j] += ar * br[j] - ai * bi[j];
+        ci[j] += ar * bi[j] + ai * br[j];
+      }
+    }
+  }
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates memory to create a new complex matrix. All values as zero
+@param  rows:    Number of rows
+        columns: Number of columns
+@retval Pointer to new matrix
+*/
+CMatrix cmatrix_create(size_t rows, size_t columns)
+{
+  CMatrix M = NULL;
+  size_t ld = 0, bytes = 0;
+
+  if(rows == 0 || columns == 0 || columns > SIZE_MAX - CMX_PAD)
+  {
+    return NULL;
+  }
+
+  // Row stride padded to a whole cache line, avoiding power-of-two strides
+  // (4 KiB multiples) that map every row of a block to the same cache sets
+  ld = (columns + CMX_PAD - 1) / CMX_PAD * CMX_PAD;
+  ld = (ld % 512 == 0) ? ld + CMX_PAD : ld;
+
+  // Overflow-checked plane size (a multiple of CMX_ALIGN)
+  if(rows > SIZE_MAX / ld / sizeof(double))
+  {
+    return NULL;
+  }
+
+  bytes = rows * ld * sizeof(double);
+
+  M = (CMatrix)malloc( sizeof(t_cmatrix) );
+
+  if(M == NULL)
+  {
+    return NULL;
+  }
+
+  M->rows    = rows;
+  M->columns = columns;
+  M->ld      = ld;
+  M->re      = (double*)aligned_alloc( CMX_ALIGN, bytes );
+  M->im      = (double*)aligned_alloc( CMX_ALIGN, bytes );
+
+  if(M->re == NULL || M->im == NULL)
+  {
+    free(M->re);
+    free(M->im);
+    free(M);
+
+    return NULL;
+  }
+
+  memset(M->re, 0, bytes);
+  memset(M->im, 0, bytes);
+
+  return M;
+}
+
+/**
+@brief  Allocates memory to create a new identity matrix
+@param  dimension: Matrix dimension (n x n)
+@retval Pointer to new matrix
+*/
+CMatrix cmatrix_identity(size_t dimension)
+{
+  CMatrix M = cmatrix_create(dimension, dimension);
+  size_t i = 0;
+
+  if(M != NULL)
+  {
+    for(i = 0; i < dimension; i++)
+    {
+      M->re[i * M->ld + i] = 1;
+    }
+  }
+
+  return M;
+}
+
+/**
+@brief  Verifies if matrix is null
+@param  M: Pointer to matrix
+@retval TRUE if matrix is null, FALSE otherwise
+*/
+uint8_t cmatrix_isNull(CMatrix M)
+{
+  size_t i = 0, j = 0;
+
+  if(M != NULL)
+  {
+    for(i = 0; i < M->rows; i++)
+    {
+      for(j = 0; j < M->columns; j++)
+      {
+        if(M->re[i * M->ld + j] != 0 || M->im[i * M->ld + j] != 0)
+        {
+          return FALSE;
+        }
+      }
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Gets number of rows of indicated matrix
+@param  M: Pointer to matrix
+@retval Number of rows
+*/
+size_t cmatrix_getRows(CMatrix M)
+{
+  return (M != NULL) ? M->rows : 0;
+}
+
+/**
+@brief  Gets number of columns of indicated matrix
+@param  M: Pointer to matrix
+@retval Number of columns
+*/
+size_t cmatrix_getColumns(CMatrix M)
+{
+  return (M != NULL) ? M->columns : 0;
+}
+
+/**
+@brief  Gets an element of introduced matrix
+@param  M: Pointer to matrix
+        i: Row index
+        j: Column index
+        Z: Pointer to complex receiving the element
+@retval TRUE if element was copied, FALSE otherwise
+*/
+uint8_t cmatrix_get(CMatrix M, size_t i, size_t j, Complex Z)
+{
+  if(M != NULL && Z != NULL && i < M->rows && j < M->columns)
+  {
+    Z->Real = M->re[i * M->ld + j];
+    Z->Imag = M->im[i * M->ld + j];
+
+    complex_modulus(Z);
+    complex_argument(Z);
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+@brief  Updates a value of introduced matrix
+@param  M: Pointer to matrix
+        k: Complex value
+        i: Row index
+        j: Column index
+@retval TRUE if element was updated, FALSE otherwise
+*/
+uint8_t cmatrix_update(CMatrix M, Complex k, size_t i, size_t j)
+{
+  if(M != NULL && k != NULL && i < M->rows && j < M->columns)
+  {
+    M->re[i * M->ld + j] = k->Real;
+    M->im[i * M->ld + j] = k->Imag;
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+@brief  Verifies if M1 and M2 are equal
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if matrices are equal, FALSE otherwise
+*/
+uint8_t cmatrix_areEqual(CMatrix M1, CMatrix M2)
+{
+  size_t i = 0, j = 0;
+
+  if(M1 == NULL || M2 == NULL || M1->rows != M2->rows ||
+     M1->columns != M2->columns)
+  {
+    return FALSE;
+  }
+
+  for(i = 0; i < M1->rows; i++)
+  {
+    for(j = 0; j < M1->columns; j++)
+    {
+      if(M1->re[i * M1->ld + j] != M2->re[i * M2->ld + j] ||
+         M1->im[i * M1->ld + j] != M2->im[i * M2->ld + j])
+      {
+        return FALSE;
+      }
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Obtains the algebraic sum of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to sum matrix
+*/
+CMatrix cmatrix_sum(CMatrix M1, CMatrix M2)
+{
+  CMatrix S = NULL;
+  size_t i = 0;
+
+  if(M1 == NULL || M2 == NULL || M1->rows != M2->rows ||
+     M1->columns != M2->columns)
+  {
+    return NULL;
+  }
+
+  S = cmatrix_create(M1->rows, M1->columns);
+
+  if(S != NULL)
+  {
+    // Same dimensions imply same stride: padding is zero and sums to zero
+    for(i = 0; i < S->rows * S->ld; i++)
+    {
+      S->re[i] = M1->re[i] + M2->re[i];
+      S->im[i] = M1->im[i] + M2->im[i];
+    }
+  }
+
+  return S;
+}
+
+/**
+@brief  Obtains the multiplication of a matrix and a complex factor
+@param  k: Pointer to complex factor
+        M: Pointer to matrix
+@retval Pointer to scaled matrix
+*/
+CMatrix cmatrix_scalar(Complex k, CMatrix M)
+{
+  CMatrix S = NULL;
+  size_t i = 0;
+  double kr = 0, ki = 0;
+
+  if(k == NULL || M == NULL)
+  {
+    return NULL;
+  }
+
+  S  = cmatrix_create(M->rows, M->columns);
+  kr = k->Real;
+  ki = k->Imag;
+
+  if(S != NULL)
+  {
+    for(i = 0; i < S->rows * S->ld; i++)
+    {
+      S->re[i] = kr * M->re[i] - ki * M->im[i];
+      S->im[i] = kr * M->im[i] + ki * M->re[i];
+    }
+  }
+
+  return S;
+}
+
+/**
+@brief  Obtains the algebraic multiplication of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to product matrix
+*/
+CMatrix cmatrix_product(CMatrix M1, CMatrix M2)
+{
+  CMatrix P = NULL;
+  size_t ib = 0, kb = 0, jb = 0;
+  size_t n = 0, m = 0, p = 0;
+
+  if(M1 == NULL || M2 == NULL || M1->columns != M2->rows)
+  {
+    return NULL;
+  }
+
+  n = M1->rows;
+  m = M1->columns;
+  p = M2->columns;
+  P = cmatrix_create(n, p);
+
+  if(P == NULL)
+  {
+    return NULL;
+  }
+
+  // Row blocks of the result are independent
+  #pragma omp parallel for private(kb, jb) schedule(dynamic) \
+                           if(n * m * p >= CMX_PARALLEL_MIN)
+  for(ib = 0; ib < n; ib += CMX_BLOCK_I)
+  {
+    for(kb = 0; kb < m; kb += CMX_BLOCK_K)
+    {
+      for(jb = 0; jb < p; jb += CMX_BLOCK_J)
+      {
+        cmatrix_kernel(M1, M2, P,
+                       ib, (ib + CMX_BLOCK_I < n) ? ib + CMX_BLOCK_I : n,
+                       kb, (kb + CMX_BLOCK_K < m) ? kb + CMX_BLOCK_K : m,
+                       jb, (jb + CMX_BLOCK_J < p) ? jb + CMX_BLOCK_J : p);
+      }
+    }
+  }
+
+  return P;
+}
+
+/**
+@brief  Gets inverse matrix of M if existing (Gauss-Jordan, partial pivoting)
+@param  M: Pointer to matrix
+@retval Pointer to inverse matrix, NULL if M is not square or a pivot column
+        is exactly zero (same singularity test as matrix_lu)
+*/
+CMatrix cmatrix_inverse(CMatrix M)
+{
+  CMatrix A = NULL, X = NULL;
+  size_t n = 0, ld = 0, c = 0, r = 0, j = 0, piv = 0;
+  double best = 0, mag = 0, t = 0;
+  double ar = 0, ai = 0, pr = 0, pi = 0, fr = 0, fi = 0;
+
+  if(M == NULL || M->rows != M->columns)
+  {
+    return NULL;
+  }
+
+  n = M->rows;
+  A = cmatrix_copy(M, FALSE, FALSE);
+  X = cmatrix_identity(n);
+
+  if(A == NULL || X == NULL)
+  {
+    cmatrix_delete(A);
+    cmatrix_delete(X);
+
+    return NULL;
+  }
+
+  ld = A->ld;
+
+  for(c = 0; c < n; c++)
+  {
+    // Pivot: largest |Re| + |Im| in column c (no squares to underflow)
+    best = 0;
+    piv  = c;
+
+    for(r = c; r < n; r++)
+    {
+      mag = fabs(A->re[r * ld + c]) + fabs(A->im[r * ld + c]);
+
+      if(mag > best)
+      {
+        best = mag;
+        piv  = r;
+      }
+    }
+
+    if(best == 0)
+    {
+      cmatrix_delete(A);
+      cmatrix_delete(X);
+
+      return NULL;
+    }
+
+    // Row swap in both systems
+    if(piv != c)
+    {
+      for(j = 0; j < n; j++)
+      {
+        t = A->re[c * ld + j]; A->re[c * ld + j] = A->re[piv * ld + j];
+        A->re[piv * ld + j] = t;
+        t = A->im[c * ld + j]; A->im[c * ld + j] = A->im[piv * ld + j];
+        A->im[piv * ld + j] = t;
+        t = X->re[c * ld + j]; X->re[c * ld + j] = X->re[piv * ld + j];
+        X->re[piv * ld + j] = t;
+        t = X->im[c * ld + j]; X->im[c * ld + j] = X->im[piv * ld + j];
+        X->im[piv * ld + j] = t;
+      }
+    }
+
+    // Normalize pivot row by 1 / a_cc (scaled by best against underflow)
+    ar = A->re[c * ld + c] / best;
+    ai = A->im[c * ld + c] / best;
+    t  = (ar * ar + ai * ai) * best;
+    pr =  ar / t;
+    pi = -ai / t;
+
+    for(j = 0; j < n; j++)
+    {
+      t = A->re[c * ld + j];
+      A->re[c * ld + j] = t * pr - A->im[c * ld + j] * pi;
+      A->im[c * ld + j] = t * pi + A->im[c * ld + j] * pr;
+      t = X->re[c * ld + j];
+      X->re[c * ld + j] = t * pr - X->im[c * ld + j] * pi;
+      X->im[c * ld + j] = t * pi + X->im[c * ld + j] * pr;
+    }
+
+    // Eliminate column c from every other row
+    #pragma omp parallel for private(j, fr, fi) if(n * n >= CMX_PARALLEL_MIN)
+    for(r = 0; r < n; r++)
+    {
+      if(r == c)
+      {
+        continue;
+      }
+
+      fr = A->re[r * ld + c];
+      fi = A->im[r * ld + c];
+
+      if(fr == 0 && fi == 0)
+      {
+        continue;
+      }
+
+      for(j = 0; j < n; j++)
+      {
+        A->re[r * ld + j] -= fr * A->re[c * ld + j] - fi * A->im[c * ld + j];
+        A->im[r * ld + j] -= fr * A->im[c * ld + j] + fi * A->re[c * ld + j];
+        X->re[r * ld + j] -= fr * X->re[c * ld + j] - fi * X->im[c * ld + j];
+        X->im[r * ld + j] -= fr * X->im[c * ld + j] + fi * X->re[c * ld + j];
+      }
+    }
+  }
+
+  cmatrix_delete(A);
+
+  return X;
+}
+
+/**
+@brief  Transposes matrix M
+@param  M: Pointer to matrix
+@retval Pointer to transposed matrix
+*/
+CMatrix cmatrix_transpose(CMatrix M)
+{
+  return cmatrix_copy(M, TRUE, FALSE);
+}
+
+/**
+@brief  Conjugate transpose (Hermitian adjoint) of matrix M
+@param  M: Pointer to matrix
+@retval Pointer to conjugate transposed matrix
+*/
+CMatrix cmatrix_hermitian(CMatrix M)
+{
+  return cmatrix_copy(M, TRUE, TRUE);
+}
+
+/**
+@brief  Deletes matrix and frees allocated memory
+@param  M: Pointer to matrix
+@retval TRUE if matrix was deleted with no error, FALSE otherwise
+*/
+uint8_t cmatrix_delete(CMatrix M)
+{
+  if(M != NULL)
+  {
+    free(M->re);
+    free(M->im);
+    free(M);
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+@brief  Prints matrix on screen
+@param  M: Pointer to matrix
+@retval TRUE if matrix was printed with no error, FALSE otherwise
+*/
+uint8_t cmatrix_print(CMatrix M)
+{
+  size_t i = 0, j = 0;
+
+  if(M == NULL)
+  {
+    return FALSE;
+  }
+
+  for(i = 0; i < M->rows; i++)
+  {
+    for(j = 0; j < M->columns; j++)
+    {
+      printf("%9.4f %+9.4fi  ", M->re[i * M->ld + j], M->im[i * M->ld + j]);
+    }
+
+    printf("\n");
+  }
+
+  return TRUE;
+}
@@ -0,0 +1,212 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_ComplexMatrix.h
+ * Description   : Abstract Data Type for complex matrices. Header file.
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _COMPLEX_MATRIX_H_
+#define _COMPLEX_MATRIX_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<string.h>
+#include"../Complex/ADT_Complex.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Buffer alignment (bytes) and row padding (doubles per cache line)
+#define CMX_ALIGN (size_t)(64)
+#define CMX_PAD   (size_t)(8)
+
+// Product blocking (rows of A, inner dimension, columns of B)
+#define CMX_BLOCK_I (size_t)(64)
+#define CMX_BLOCK_K (size_t)(128)
+#define CMX_BLOCK_J (size_t)(128)
+
+// Min. multiply-adds to run products with OpenMP threads
+#define CMX_PARALLEL_MIN (size_t)(1 << 18)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Complex matrix, split storage: element (i, j) is re[i*ld + j] + i im[i*ld + j]
+typedef struct cmatrix_struct
+{
+  size_t  rows;      // Number of rows
+  size_t  columns;   // Number of columns
+  size_t  ld;        // Leading dimension (row stride, padded)
+  double* re;        // Real parts (aligned, rows * ld)
+  double* im;        // Imaginary parts (aligned, rows * ld)
+}
+t_cmatrix;
+
+typedef t_cmatrix* CMatrix;
+
+// Complex matrix handler
+typedef struct cmatrix_handler
+{
+  CMatrix (*init)(size_t Rows, size_t Columns);                // Create
+  CMatrix (*eye)(size_t dimension);                            // Identity
+  uint8_t (*isNull)(CMatrix M);                                // Null matrix?
+  size_t  (*row)(CMatrix M);                                   // Get #rows
+  size_t  (*col)(CMatrix M);                                   // Get #columns
+  uint8_t (*get)(CMatrix M, size_t i, size_t j, Complex Z);    // Get element
+  uint8_t (*update)(CMatrix M, Complex k, size_t i, size_t j); // Update element
+  uint8_t (*areEqual)(CMatrix M1, CMatrix M2);                 // M1 == M2?
+  CMatrix (*sum)(CMatrix M1, CMatrix M2);                      // Matrix sum
+  CMatrix (*scalar)(Complex k, CMatrix M);                     // Scalar product
+  CMatrix (*product)(CMatrix M1, CMatrix M2);                  // Matrix product
+  CMatrix (*inv)(CMatrix M);                                   // Inverse matrix
+  CMatrix (*transp)(CMatrix M);                                // Transpose
+  CMatrix (*herm)(CMatrix M);                                  // Conj. transpose
+  uint8_t (*del)(CMatrix M);                                   // Delete matrix
+}
+t_CMatrixHandler;
+
+extern t_CMatrixHandler CMx_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates memory to create a new complex matrix. All values as zero
+@param  rows:    Number of rows
+        columns: Number of columns
+@retval Pointer to new matrix
+@note   Returns NULL on zero dimensions or if the size overflows
+*/
+extern CMatrix cmatrix_create(size_t rows, size_t columns);
+
+/**
+@brief  Allocates memory to create a new identity matrix
+@param  dimension: Matrix dimension (n x n)
+@retval Pointer to new matrix
+*/
+extern CMatrix cmatrix_identity(size_t dimension);
+
+/**
+@brief  Verifies if matrix is null
+@param  M: Pointer to matrix
+@retval TRUE if matrix is null, FALSE otherwise
+*/
+extern uint8_t cmatrix_isNull(CMatrix M);
+
+/**
+@brief  Gets number of rows of indicated matrix
+@param  M: Pointer to matrix
+@retval Number of rows
+*/
+extern size_t cmatrix_getRows(CMatrix M);
+
+/**
+@brief  Gets number of columns of indicated matrix
+@param  M: Pointer to matrix
+@retval Number of columns
+*/
+extern size_t cmatrix_getColumns(CMatrix M);
+
+/**
+@brief  Gets an element of introduced matrix
+@param  M: Pointer to matrix
+        i: Row index
+        j: Column index
+        Z: Pointer to complex receiving the element
+@retval TRUE if element was copied, FALSE otherwise
+*/
+extern uint8_t cmatrix_get(CMatrix M, size_t i, size_t j, Complex Z);
+
+/**
+@brief  Updates a value of introduced matrix
+@param  M: Pointer to matrix
+        k: Complex value
+        i: Row index
+        j: Column index
+@retval TRUE if element was updated, FALSE otherwise
+*/
+extern uint8_t cmatrix_update(CMatrix M, Complex k, size_t i, size_t j);
+
+/**
+@brief  Verifies if M1 and M2 are equal
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if matrices are equal, FALSE otherwise
+*/
+extern uint8_t cmatrix_areEqual(CMatrix M1, CMatrix M2);
+
+/**
+@brief  Obtains the algebraic sum of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to sum matrix
+@note   If dimensions do not match, the function returns a NULL pointer
+*/
+extern CMatrix cmatrix_sum(CMatrix M1, CMatrix M2);
+
+/**
+@brief  Obtains the multiplication of a matrix and a complex factor
+@param  k: Pointer to complex factor
+        M: Pointer to matrix
+@retval Pointer to scaled matrix
+*/
+extern CMatrix cmatrix_scalar(Complex k, CMatrix M);
+
+/**
+@brief  Obtains the algebraic multiplication of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to product matrix
+@note   Cache-blocked; the inner loop runs over contiguous columns of the real
+        and imaginary planes so it vectorizes. Threads with OpenMP
+*/
+extern CMatrix cmatrix_product(CMatrix M1, CMatrix M2);
+
+/**
+@brief  Gets inverse matrix of M if existing (Gauss-Jordan, partial pivoting)
+@param  M: Pointer to matrix
+@retval Pointer to inverse matrix
+@note   Returns NULL if M is not square or a pivot column is exactly zero, the
+        same test as matrix_lu (no tolerance: a nearly singular M gives a
+        large inverse)
+*/
+extern CMatrix cmatrix_inverse(CMatrix M);
+
+/**
+@brief  Transposes matrix M
+@param  M: Pointer to matrix
+@retval Pointer to transposed matrix
+*/
+extern CMatrix cmatrix_transpose(CMatrix M);
+
+/**
+@brief  Conjugate transpose (Hermitian adjoint) of matrix M
+@param  M: Pointer to matrix
+@retval Pointer to conjugate transposed matrix
+*/
+extern CMatrix cmatrix_hermitian(CMatrix M);
+
+/**
+@brief  Deletes matrix and frees allocated memory
+@param  M: Pointer to matrix
+@retval TRUE if matrix was deleted with no error, FALSE otherwise
+*/
+extern uint8_t cmatrix_delete(CMatrix M);
+
+/**
+@brief  Prints matrix on screen
+@param  M: Pointer to matrix
+@retval TRUE if matrix was printed with no error, FALSE otherwise
+*/
+extern uint8_t cmatrix_print(CMatrix M);
+
+#endif
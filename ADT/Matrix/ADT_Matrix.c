@@ -4,8 +4,8 @@
  * Filename      : ADT_Matrix.c
  * Description   : Abstract Data Type for matrices. Library file.
  * Version       : 01.00
- * Revision      : 01
- * Last modified : 01/24/2021
+ * Revision      : 13
+ * Last modified : 10/18/2026
  * -----------------------------------------------------------------------------
  */
 
@@ -15,11 +15,44 @@
 
 #include"ADT_Matrix.h"
 
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// GEMM micro-kernel on GCC vector extensions (GCC and Clang)
+#if defined(__GNUC__) && !defined(MX_NO_VECTOR_KERNEL)
+#define MX_VECTOR_KERNEL
+#endif
+
+// ISO C modes disable multiply-add contraction: the kernel re-enables it, so
+// each rank-1 update is one FMA per register where the ISA has it (GCC)
+#if defined(__GNUC__) && !defined(__clang__)
+#define MK_FMA __attribute__((optimize("fp-contract=fast")))
+#else
+#define MK_FMA
+#endif
+
 //----------------------------------------------------------------------------//
 //                            General definitions                             //
 //----------------------------------------------------------------------------//
 
-// Vector handler
+// Operations of the element-wise streaming kernel
+typedef enum
+{
+  MX_EW_AXPBY,              // alpha A + beta B (B optional)
+  MX_EW_PRODUCT,            // A .* B
+  MX_EW_DIVISION,           // A ./ B
+  MX_EW_POWER               // A .^ alpha
+}
+t_matrixEwOp;
+
+// GEMM micro-kernel
+typedef void (*t_matrixKernel)(size_t kc, const Data* restrict a,
+                               const Data* restrict b, Data* restrict c,
+                               size_t ldc, size_t mr, size_t nr, Data alpha,
+                               Data beta);
+
+// Matrix handler
 t_MatrixHandler Mx_Hdlr =
 {
   matrix_create,            // Create Matrix
@@ -27,383 +60,2462 @@ t_MatrixHandler Mx_Hdlr =
   matrix_isNull,            // Null matrix?
   matrix_getRows,           // Get #rows
   matrix_getColumns,        // Get #columns
+  matrix_get,               // Get element
   matrix_getDeterminant,    // Get determinant
   matrix_update,            // Update element
+  matrix_touch,             // Mark modified
   matrix_areEqual,          // M1 == M2?
   matrix_sum,               // Matrix sum
+  matrix_sum_into,          // R = M1 + M2
   matrix_scalar,            // Scalar product
+  matrix_scalar_into,       // R = k M
+  matrix_axpby,             // R = aA + bB
   matrix_product,           // Matrix product
+  matrix_gemm,              // C = aAB + bC
   matrix_power,             // Matrix power
   matrix_element_product,   // Element product
+  matrix_element_product_into,  // R = M1 .* M2
   matrix_element_division,  // Element division
+  matrix_element_division_into, // R = M1 ./ M2
   matrix_element_power,     // Element power
+  matrix_element_power_into,    // R = M .^ n
   matrix_inverse,           // Inverse matrix
+  matrix_solve,             // X: A X = B
   matrix_transpose,         // Transpose
+  matrix_transpose_inplace, // Transpose in place
+  matrix_transpose_view,    // Transposed view
+  matrix_view,              // Block view
+  matrix_view_into,         // Block view in caller storage
   matrix_minor,             // Minor ij
   matrix_cofactor,          // Cofactor ij
   matrix_diagonal,          // Diagonal matrix
+  matrix_banded,            // Banded matrix
+  matrix_triangular,        // Triangular matrix
+  matrix_symmetric,         // Symmetric matrix
+  matrix_pack,              // Structured copy
+  matrix_unpack,            // Dense copy
   matrix_delete             // Delete matrix
 };
 
+// LU factorization handler
+t_MatrixLUHandler MxLU_Hdlr =
+{
+  matrix_lu_create,         // Factorize
+  matrix_lu_det,            // Determinant
+  matrix_lu_solve,          // A X = B
+  matrix_lu_inverse,        // Inverse matrix
+  matrix_lu_delete          // Delete factors
+};
 
 //----------------------------------------------------------------------------//
-//                              Public functions                              //
+//                              Private functions                             //
 //----------------------------------------------------------------------------//
 
+// GEMM micro-kernel: MX_MR x MX_NR block of C from packed slivers (see
+// ADT_MatrixKernel.inc)
+#if defined(MX_KERNEL_DISPATCH) && defined(MX_VECTOR_KERNEL)
+
+// One vector build per ISA, picked by the resolver at load time
+#define MK_FN     matrix_gemm_kernel_avx512
+#define MK_TARGET __attribute__((target("avx512f")))
+#define MK_W      8
+#include"ADT_MatrixKernel.inc"
+#undef MK_FN
+#undef MK_TARGET
+#undef MK_W
+
+#define MK_FN     matrix_gemm_kernel_avx2
+#define MK_TARGET __attribute__((target("avx2,fma")))
+#define MK_W      4
+#include"ADT_MatrixKernel.inc"
+#undef MK_FN
+#undef MK_TARGET
+#undef MK_W
+
+#define MK_FN     matrix_gemm_kernel_sse2
+#define MK_TARGET
+#define MK_W      2
+#include"ADT_MatrixKernel.inc"
+#undef MK_FN
+#undef MK_TARGET
+#undef MK_W
+
 /**
-@brief  Allocates memory to create a new matrix. All values as zero by default
-@param  rows: Number of rows
-        columns: Number of columns
-@retval Pointer to new matrix
+@brief  Picks the GEMM micro-kernel for the running CPU
+@param  none
+@retval Pointer to micro-kernel
+@note   Runs while the program is relocated, before sanitizer runtimes are
+        initialized, so it is not instrumented
 */
-Matrix matrix_create(uint8_t rows, uint8_t columns)
+__attribute__((no_sanitize_address))
+t_matrixKernel matrix_gemm_kernel_select(void)
 {
-  Matrix M = NULL;         // New matrix
-  uint8_t i = 0, j = 0;    // Iterators
+  __builtin_cpu_init();
 
-  // Allocates memory for matrix structure
-  M = (Matrix)malloc( sizeof(t_matrix) );
-  
-  // Returns in case of memory allocation error
-  if(M == NULL)
-  {
-    return M;
-  }
-  
-  // Sets matrix dimensions
-  M.rows = rows;
-  M.columns = columns;
-  
-  // Initializes determinant pointer
-  if(rows == columns)
+  if( __builtin_cpu_supports("avx512f") )
   {
-    // Determinant is defined only if M is a square matrix
-    /* TODO: Determinant calculation */
+    return matrix_gemm_kernel_avx512;
   }
-  else
+
+  if( __builtin_cpu_supports("avx2") && __builtin_cpu_supports("fma") )
   {
-    M.determinant = NULL;
+    return matrix_gemm_kernel_avx2;
   }
-  
-  // Allocates memory for pointers array
-  M.matrix = (Array)calloc( rows, sizeof(Vector) );
 
-  // Allocates memory each row
-  for(i = 0; i < columns; i++)
+  return matrix_gemm_kernel_sse2;
+}
+
+void matrix_gemm_kernel(size_t kc, const Data* restrict a,
+                        const Data* restrict b, Data* restrict c, size_t ldc,
+                        size_t mr, size_t nr, Data alpha, Data beta)
+  __attribute__((ifunc("matrix_gemm_kernel_select")));
+
+#elif defined(MX_VECTOR_KERNEL)
+
+// One vector build for the target ISA of the whole file
+#define MK_FN     matrix_gemm_kernel
+#define MK_TARGET
+#if defined(__AVX512F__)
+#define MK_W      8
+#elif defined(__AVX__)
+#define MK_W      4
+#else
+#define MK_W      2
+#endif
+#include"ADT_MatrixKernel.inc"
+#undef MK_FN
+#undef MK_TARGET
+#undef MK_W
+
+#else
+
+/**
+@brief  GEMM micro-kernel, portable build (arguments as in
+        ADT_MatrixKernel.inc)
+*/
+void matrix_gemm_kernel(size_t kc, const Data* restrict a,
+                        const Data* restrict b, Data* restrict c, size_t ldc,
+                        size_t mr, size_t nr, Data alpha, Data beta)
+{
+  Data tile[MX_MR * MX_NR] = {0};     // Accumulator tile
+  size_t p = 0, i = 0, j = 0;
+
+  for(p = 0; p < kc; p++, a += MX_MR, b += MX_NR)
   {
-    M.matrix[i] = (Data*)calloc( columns, sizeof(Data) );
-    
-    // Returns in case of memory allocation error
-    if(M.matrix[i] == NULL)
+    for(i = 0; i < MX_MR; i++)
     {
-      // Frees allocated elements in the array
-      for(j = 0; j < i; j++)
-      {
-        free( M.matrix[j] );
-      }
-      
-      // Frees determinant pointer
-      if(M.determinant != NULL)
+      for(j = 0; j < MX_NR; j++)
       {
-        free(M.determinant);
+        tile[i * MX_NR + j] += a[i] * b[j];
       }
-      
-      // Frees memory allocated for matrix structure
-      free(M);
-      
-      return NULL;
     }
   }
-  
-  // Sets matrix elements as zero
-  for(i = 0; i < rows; i++)
+
+  for(i = 0; i < mr; i++)
   {
-    for(j = 0; j < columns; j++)
+    for(j = 0; j < nr; j++)
     {
-      M.matrix[i][j] = 0;
+      c[i * ldc + j] = (beta == 0) ? alpha * tile[i * MX_NR + j] :
+                       alpha * tile[i * MX_NR + j] + beta * c[i * ldc + j];
     }
   }
-   
-   return M;
 }
 
+#endif
+
 /**
-@brief  Allocates memory to create a new identity matrix.
-@param  dimension: Matrix dimension (n x n)
-@retval Pointer to new matrix
+@brief  Packs an m x kc block of A into MX_MR-row slivers (zero padded)
+@param  A:   Top-left element of the block
+        lda: Leading dimension of A
+        ta:  TRUE if A is stored transposed (element (r, p) at A[p * lda + r])
+        m:   Number of rows
+        kc:  Number of columns
+        Ap:  Destination buffer (ceil(m / MX_MR) * MX_MR * kc)
+@retval none
 */
-Matrix matrix_identity(uint8_t dimension)
+void matrix_gemm_packA(const Data* A, size_t lda, uint8_t ta, size_t m,
+                       size_t kc, Data* Ap)
 {
-  Matrix M_eye = NULL;         // New identity matrix
-  uint8_t i = 0, j = 0;        // Iterators
-  
-  // Initializes matrix
-  if(dimension != 0)
+  size_t s = 0, p = 0, i = 0, r = 0;
+  size_t slivers = (m + MX_MR - 1) / MX_MR;
+  size_t rs = ta ? 1 : lda, cs = ta ? lda : 1;     // Row / column strides
+
+  #pragma omp parallel for private(p, i, r) if(m * kc >= MX_PARALLEL_MIN)
+  for(s = 0; s < slivers; s++)
   {
-    M_eye = Mx_Hdlr.init(dimension, dimension);
-    
-    if(M_eye != NULL)
+    for(p = 0; p < kc; p++)
     {
-      // Sets identity matrix elements
-      for(i = 0; i < M_eye.rows; i++)
+      for(i = 0; i < MX_MR; i++)
       {
-        for(j = 0; j < M_eye.columns; j++)
-        {
-          if(i == j)
-          {
-            M_eye.matrix[i][j] = 1;
-          }
-        }
+        r = s * MX_MR + i;
+        Ap[(s * kc + p) * MX_MR + i] = (r < m) ? A[r * rs + p * cs] : 0;
       }
     }
   }
-  
-  return M_eye;
 }
 
 /**
-@brief  Verifies if matrix is null
-@param  M: Pointer to matrix
-@retval TRUE if matrix is null, FALSE otherwise
+@brief  Packs a kc x nc block of B into MX_NR-column slivers (zero padded)
+@param  B:   Top-left element of the block
+        ldb: Leading dimension of B
+        tb:  TRUE if B is stored transposed (element (p, c) at B[c * ldb + p])
+        kc:  Number of rows
+        nc:  Number of columns
+        Bp:  Destination buffer (ceil(nc / MX_NR) * MX_NR * kc)
+@retval none
 */
-uint8_t matrix_isNull(Matrix M)
+void matrix_gemm_packB(const Data* B, size_t ldb, uint8_t tb, size_t kc,
+                       size_t nc, Data* Bp)
 {
-  uint8_t i = 0, j = 0;        // Iterators
-  
-  if(M != NULL)
+  size_t t = 0, p = 0, j = 0, col = 0;
+  size_t slivers = (nc + MX_NR - 1) / MX_NR;
+
+  #pragma omp parallel for private(p, j, col) if(nc * kc >= MX_PARALLEL_MIN)
+  for(t = 0; t < slivers; t++)
   {
-    // Verifies matrix elements
-    for(i = 0; i < M.rows; i++)
+    if(tb)
     {
-      for(j = 0; j < M.columns; j++)
+      // Each sliver column is a contiguous run of a stored row
+      for(j = 0; j < MX_NR; j++)
       {
-        if(M.matrix[i][j] != 0)
+        col = t * MX_NR + j;
+
+        for(p = 0; p < kc; p++)
         {
-          return FALSE;
+          Bp[(t * kc + p) * MX_NR + j] = (col < nc) ? B[col * ldb + p] : 0;
+        }
+      }
+    }
+    else
+    {
+      for(p = 0; p < kc; p++)
+      {
+        for(j = 0; j < MX_NR; j++)
+        {
+          col = t * MX_NR + j;
+          Bp[(t * kc + p) * MX_NR + j] = (col < nc) ? B[p * ldb + col] : 0;
         }
       }
     }
   }
-  
-  return TRUE;
-}
-
-/**
-@brief  Gets number of rows of indicated matrix
-@param  M: Pointer to matrix
-@retval Number of rows
-*/
-uint8_t matrix_getRows(Matrix M)
-{
-  return M.rows;
 }
 
 /**
-@brief  Gets number of columns of indicated matrix
-@param  M: Pointer to matrix
-@retval Number of columns
+@brief  GEMM on raw row-major blocks: C = alpha * A * B + beta * C
+@param  m, n, k:  Dimensions (A: m x k, B: k x n, C: m x n)
+        alpha:    Scale of A * B
+        A, lda:   First operand and its leading dimension
+        ta:       TRUE if A is stored transposed (k x m block)
+        B, ldb:   Second operand and its leading dimension
+        tb:       TRUE if B is stored transposed (n x k block)
+        beta:     Scale of previous C (0: previous C is not read)
+        C, ldc:   Result and its leading dimension
+@retval TRUE if product was computed, FALSE on allocation error
+@note   A and B are packed before use, so they may live in the same buffer as
+        C as long as the three blocks do not overlap. Transposed operands are
+        read by the packing routines; they are never materialized
 */
-uint8_t matrix_getColumns(Matrix M)
+uint8_t matrix_gemm_core(size_t m, size_t n, size_t k, Data alpha,
+                         const Data* A, size_t lda, uint8_t ta,
+                         const Data* B, size_t ldb, uint8_t tb,
+                         Data beta, Data* C, size_t ldc)
 {
-  return M.columns;
-}
+  Data *Ap = NULL, *Bp = NULL;        // Packed panels
+  size_t jc = 0, pc = 0, ic = 0;      // Cache block origins
+  size_t jr = 0, ir = 0;              // Register block origins
+  size_t nc = 0, kc = 0, mc = 0;      // Cache block sizes
+  size_t mSlivers = (m + MX_MR - 1) / MX_MR;
+  size_t nPanel = (n < MX_NC) ? (n + MX_NR - 1) / MX_NR * MX_NR : MX_NC;
+  Data b = 0;                         // Beta of current panel
 
-/**
-@brief  Gets determinant of matrix if defined
-@param  M: Pointer to matrix
-        detval: Determinant value
-@retval TRUE if determinant exists, FALSE otherwise
-*/
-uint8_t matrix_getDeterminant(Matrix M, double* detval)
-{
-  // Returns determinant if defined
-  if(M.determinant != NULL)
+  if(m == 0 || n == 0)
   {
-    *detval = *M.determinant;
-    
     return TRUE;
   }
-  
-  return FALSE;
-}
 
-/**
-@brief  Updates a value of introduced matrix
-@param  M: Pointer to matrix
-        k: Data
-        i: Row index
-        j: Column index
-@retval TRUE if element was updated, FALSE otherwise
-*/
-uint8_t matrix_update(Matrix M, Data k, uint8_t i, uint8_t j)
-{
-  if(M != NULL)
+  // Empty inner dimension: A * B = 0, so C = beta * C
+  if(k == 0)
   {
-    // Updates ijth element
-    M.matrix[i][j] = k;
-    
+    for(ic = 0; ic < m; ic++)
+    {
+      for(jc = 0; jc < n; jc++)
+      {
+        C[ic * ldc + jc] = (beta == 0) ? 0 : beta * C[ic * ldc + jc];
+      }
+    }
+
     return TRUE;
   }
-  
-  return FALSE;
-}
 
-/**
-@brief  Verifies if M1 and M2 are equal
-@param  M1: Pointer to first matrix
-        M2: Pointer to second matrix
-@retval TRUE if matrices are equal, FALSE otherwise
-*/
-uint8_t matrix_areEqual(Matrix M1, Matrix M2)
-{
-  uint8_t i = 0, j = 0;        // Iterators
-  
-  if(M1 != NULL && M2 != NULL && M1.rows == M2.rows && M1.columns == M2.columns)
+  Ap = (Data*)aligned_alloc( MX_ALIGN, mSlivers * MX_MR * MX_KC * sizeof(Data) );
+  Bp = (Data*)aligned_alloc( MX_ALIGN, nPanel * MX_KC * sizeof(Data) );
+
+  if(Ap == NULL || Bp == NULL)
   {
-    // Verifies matrix elements
-    for(i = 0; i < M1.rows; i++)
+    free(Ap);
+    free(Bp);
+
+    return FALSE;
+  }
+
+  for(jc = 0; jc < n; jc += MX_NC)
+  {
+    nc = (n - jc < MX_NC) ? n - jc : MX_NC;
+
+    for(pc = 0; pc < k; pc += MX_KC)
     {
-      for(j = 0; j < M1.columns; j++)
+      kc = (k - pc < MX_KC) ? k - pc : MX_KC;
+      b  = (pc == 0) ? beta : 1;
+
+      // Panels: B (kc x nc) shared by all threads, A (m x kc) by row blocks
+      matrix_gemm_packB(tb ? &B[jc * ldb + pc] : &B[pc * ldb + jc], ldb, tb,
+                        kc, nc, Bp);
+      matrix_gemm_packA(ta ? &A[pc * lda] : &A[pc], lda, ta, m, kc, Ap);
+
+      // Each (MX_MC row block, MX_NR column sliver) pair is independent
+      #pragma omp parallel for collapse(2) private(ir, mc) schedule(static) \
+                               if(m * nc * kc >= MX_PARALLEL_MIN)
+      for(ic = 0; ic < m; ic += MX_MC)
       {
-        if(M1.matrix[i][j] != M2.matrix[i][j])
+        for(jr = 0; jr < nc; jr += MX_NR)
         {
-          return FALSE;
+          mc = (m - ic < MX_MC) ? m - ic : MX_MC;
+
+          for(ir = 0; ir < mc; ir += MX_MR)
+          {
+            matrix_gemm_kernel(kc, &Ap[(ic + ir) * kc], &Bp[jr * kc],
+                               &C[(ic + ir) * ldc + jc + jr], ldc,
+                               (mc - ir < MX_MR) ? mc - ir : MX_MR,
+                               (nc - jr < MX_NR) ? nc - jr : MX_NR,
+                               alpha, b);
+          }
         }
       }
     }
-    
-    return TRUE;
   }
-  
-  return FALSE;
-}
 
-/**
-@brief  Obtains the algebraic sum of two matrices
-@param  M1: Pointer to first matrix
-        M2: Pointer to second matrix
-@retval Pointer to sum matrix
-@note   If dimensions do not match, the function returns a NULL pointer
-*/
-Matrix matrix_sum(Matrix M1, Matrix M2)
-{
-  return NULL;
-}
+  free(Ap);
+  free(Bp);
 
-/**
-@brief  Obtains the multiplication of a matrix and a scalar factor
-@param  V: Pointer to matrix
-        k: Scalar factor
-@retval Pointer to scalated matrix
-*/
-Matrix matrix_scalar(Data k, Matrix M)
-{
-  return NULL;
+  return TRUE;
 }
 
 /**
-@brief  Obtains the algebraic multiplication of two matrices
-@param  M1: Pointer to first matrix
-        M2: Pointer to second matrix
-@retval Pointer to product matrix
-@note If dimensions do not match, the function returns a NULL pointer
+@brief  Offset of element (i, j) in the storage of M
+@param  M: Pointer to matrix (or transposed view)
+        i: Row index
+        j: Column index
+@retval Offset into M->data
 */
-Matrix matrix_product(Matrix M1, Matrix M2)
+size_t matrix_index(Matrix M, size_t i, size_t j)
 {
-  return NULL;
+  return M->transposed ? j * M->ld + i : i * M->ld + j;
 }
 
 /**
-@brief  Obtains the algebraic integer power of a matrix
+@brief  Number of elements in the storage of a structured matrix
 @param  M: Pointer to matrix
-        n: Exponent
-@retval Pointer to power matrix
-@note If dimensions do not match, the function returns a NULL pointer
+@retval Stored elements (banded: corner slots of the first and last rows
+        included, always zero)
 */
-Matrix matrix_power(Matrix M, uint8_t n)
+size_t matrix_storage(Matrix M)
 {
-  return NULL;
+  switch(M->structure)
+  {
+    case MX_DIAGONAL:
+      return M->rows;
+    case MX_UPPER:
+    case MX_LOWER:
+    case MX_SYMMETRIC:
+      return M->rows * (M->rows + 1) / 2;
+    default:
+      return M->rows * M->ld;
+  }
 }
 
 /**
-@brief  Obtains the element-wise multiplication of two matrices
-@param  M1: Pointer to first matrix
-        M2: Pointer to second matrix
-@retval Pointer to product matrix
-@note If dimensions do not match, the function returns a NULL pointer
+@brief  Stored slice of row i: columns [lo, hi), contiguous in data
+@param  M:  Pointer to matrix
+        i:  Row index
+        lo: First stored column
+        hi: Slice end (exclusive)
+@retval Pointer to element (i, lo), NULL for transposed views
+@note   Row i is zero outside the slice, except for symmetric matrices,
+        whose slice is the lower part (columns 0..i) of the row
 */
-Matrix matrix_element_product(Matrix M1, Matrix M2)
+Data* matrix_row(Matrix M, size_t i, size_t* lo, size_t* hi)
 {
-  return NULL;
-}
+  size_t n = M->rows;
 
-/**
-@brief  Obtains the element-wise division of two matrices
-@param  M1: Pointer to first matrix
-        M2: Pointer to second matrix
-@retval Pointer to division matrix
-@note If dimensions do not match, the function returns a NULL pointer
-*/
-Matrix matrix_element_division(Matrix M1, Matrix M2)
-{
-  return NULL;
+  if(M->transposed)
+  {
+    return NULL;
+  }
+
+  switch(M->structure)
+  {
+    case MX_DIAGONAL:
+      *lo = i;
+      *hi = i + 1;
+      return &M->data[i];
+    case MX_BANDED:
+      *lo = (i > M->kl) ? i - M->kl : 0;
+      *hi = (n - i > M->ku) ? i + M->ku + 1 : n;
+      return &M->data[i * M->ld + *lo + M->kl - i];
+    case MX_UPPER:
+      *lo = i;
+      *hi = n;
+      return &M->data[i * n - i * (i - 1) / 2];
+    case MX_LOWER:
+    case MX_SYMMETRIC:
+      *lo = 0;
+      *hi = i + 1;
+      return &M->data[i * (i + 1) / 2];
+    default:
+      *lo = 0;
+      *hi = M->columns;
+      return &M->data[i * M->ld];
+  }
 }
 
 /**
-@brief  Obtains the element-wise power of a matrix
-@param  M: Pointer to matrix
-        n: Exponent
-@retval Pointer to power matrix
+@brief  Location of element (i, j) in any storage
+@param  M: Pointer to matrix (or transposed view)
+        i: Row index
+        j: Column index
+@retval Pointer into M->data, NULL if (i, j) is outside the structure
 */
-Matrix matrix_element_power(Matrix M, double n)
+Data* matrix_slot(Matrix M, size_t i, size_t j)
 {
-  return NULL;
+  Data* p = NULL;
+  size_t lo = 0, hi = 0, t = 0;
+
+  if(M->structure == MX_GENERAL)
+  {
+    return &M->data[matrix_index(M, i, j)];
+  }
+
+  // Upper triangle of a symmetric matrix: its mirror in the lower one
+  if(M->structure == MX_SYMMETRIC && j > i)
+  {
+    t = i;
+    i = j;
+    j = t;
+  }
+
+  p = matrix_row(M, i, &lo, &hi);
+
+  return (j >= lo && j < hi) ? &p[j - lo] : NULL;
 }
 
 /**
-@brief  Gets inverse matrix of M if existing
-@param  M: Pointer to matrix
-@retval Pointer to inverse matrix 
-@note Returns NULL if inverse matrix is undefined
+@brief  Value of element (i, j) in any storage
+@param  M: Pointer to matrix (or transposed view)
+        i: Row index
+        j: Column index
+@retval Element, 0 outside the structure
 */
-Matrix matrix_inverse(Matrix M)
+Data matrix_at(Matrix M, size_t i, size_t j)
 {
-  return NULL;
+  Data* p = matrix_slot(M, i, j);
+
+  return (p != NULL) ? *p : 0;
 }
 
 /**
-@brief  Transposes matrix M
-@param  M: Pointer to matrix
-@retval Pointer to transposed matrix
+@brief  Checks if the elements of two matrices (or views) share storage
+@param  A, B: Pointers to matrices
+@retval TRUE if some element of A is also an element of B
+@note   General views of one matrix are blocks of its storage, compared as
+        rectangles: side-by-side blocks do not overlap
 */
-Matrix matrix_transpose(Matrix M)
+uint8_t matrix_overlap(Matrix A, Matrix B)
 {
-  return NULL;
+  Matrix R = (A->base != NULL) ? A->base : A;           // Owners
+  Matrix S = (B->base != NULL) ? B->base : B;
+  size_t oa = 0, ob = 0;                                // Offsets
+  size_t ra = 0, ca = 0, rb = 0, cb = 0;                // Stored shapes
+
+  if(R != S || R->structure != MX_GENERAL)
+  {
+    return R == S;
+  }
+
+  oa = (size_t)(A->data - R->data);
+  ob = (size_t)(B->data - R->data);
+  ra = A->transposed ? A->columns : A->rows;
+  ca = A->transposed ? A->rows : A->columns;
+  rb = B->transposed ? B->columns : B->rows;
+  cb = B->transposed ? B->rows : B->columns;
+
+  return oa / R->ld < ob / R->ld + rb && ob / R->ld < oa / R->ld + ra &&
+         oa % R->ld < ob % R->ld + cb && ob % R->ld < oa % R->ld + ca;
 }
 
 /**
-@brief  Gets minor ij of matrix M if existing
-@param  M: Pointer to matrix
-        i: Row index
-        j: Column index
-@retval Pointer to minor 
-@note Returns NULL if minor is undefined
+@brief  Allocates a null structured matrix
+@param  n:  Dimension (n x n)
+        s:  Structure (not MX_GENERAL)
+        kl: Sub-diagonals (MX_BANDED only, < n)
+        ku: Super-diagonals (MX_BANDED only, < n)
+@retval Pointer to new matrix, NULL on invalid dimensions or memory error
 */
-Matrix matrix_minor(Matrix M, uint8_t i, uint8_t j)
+Matrix matrix_alloc_structured(size_t n, t_matrixStructure s, size_t kl,
+                               size_t ku)
 {
-  return NULL;
-}
+  Matrix M = NULL;
 
-/**
-@brief  Gets cofactor ij of matrix M if existing
+  if(n == 0 || s == MX_GENERAL || (s == MX_BANDED && (kl >= n || ku >= n)))
+  {
+    return NULL;
+  }
+
+  kl = (s == MX_BANDED) ? kl : 0;
+  ku = (s == MX_BANDED) ? ku : 0;
+
+  // Overflow-checked storage: n (kl + ku + 1) or n (n + 1) / 2 elements
+  if((s == MX_BANDED && n > SIZE_MAX / sizeof(Data) / (kl + ku + 1)) ||
+     (s != MX_BANDED && s != MX_DIAGONAL &&
+      n + 1 > SIZE_MAX / sizeof(Data) / n))
+  {
+    return NULL;
+  }
+
+  M = (Matrix)malloc( sizeof(t_matrix) );
+
+  if(M == NULL)
+  {
+    return NULL;
+  }
+
+  M->rows = n;
+  M->columns = n;
+  M->ld = kl + ku + 1;
+  M->structure = s;
+  M->kl = kl;
+  M->ku = ku;
+  M->determinant = 0;
+  M->dirty = TRUE;
+  M->lu = NULL;
+  M->transposed = FALSE;
+  M->base = NULL;
+  M->matrix = NULL;
+  M->release = NULL;
+  M->data = (Data*)calloc( matrix_storage(M), sizeof(Data) );
+
+  if(M->data == NULL)
+  {
+    free(M);
+
+    return NULL;
+  }
+
+  return M;
+}
+
+/**
+@brief  Row update y += a x
+@param  n: Number of elements
+        a: Scale of x
+        x: Source row
+        y: Destination row (no overlap with x)
+@retval none
+*/
+MX_KERNEL_CLONES
+void matrix_axpy_row(size_t n, Data a, const Data* restrict x,
+                     Data* restrict y)
+{
+  size_t j = 0;
+
+  for(j = 0; j < n; j++)
+  {
+    y[j] += a * x[j];
+  }
+}
+
+/**
+@brief  Copies op(S) of a structured matrix into a dense row-major buffer
+@param  S:     Pointer to structured source matrix (n x n)
+        trans: TRUE to copy S^T
+        D:     Destination buffer (n x n)
+        ldd:   Leading dimension of D
+@retval none
+*/
+void matrix_copy_structured(Matrix S, uint8_t trans, Data* D, size_t ldd)
+{
+  const Data* p = NULL;
+  size_t n = S->rows, i = 0, j = 0, lo = 0, hi = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    memset(&D[i * ldd], 0, n * sizeof(Data));
+  }
+
+  for(i = 0; i < n; i++)
+  {
+    p = matrix_row(S, i, &lo, &hi);
+
+    for(j = lo; j < hi; j++)
+    {
+      // Symmetric rows hold (i, j) and (j, i)
+      if(trans || S->structure == MX_SYMMETRIC)
+      {
+        D[j * ldd + i] = p[j - lo];
+      }
+
+      if(!trans || S->structure == MX_SYMMETRIC)
+      {
+        D[i * ldd + j] = p[j - lo];
+      }
+    }
+  }
+}
+
+/**
+@brief  Transposes a block that fits in L1: D (cols x rows) = S^T
+@param  S, lds: Source block and its leading dimension
+        D, ldd: Destination block and its leading dimension (no overlap)
+        rows:   Source rows
+        cols:   Source columns
+@retval none
+@note   Full MX_TR_TILE x MX_TR_TILE tiles have constant trip counts, so the
+        compiler turns them into in-register shuffles; edges are scalar
+*/
+MX_KERNEL_CLONES
+void matrix_transpose_leaf(const Data* restrict S, size_t lds,
+                           Data* restrict D, size_t ldd, size_t rows,
+                           size_t cols)
+{
+  size_t rf = rows / MX_TR_TILE * MX_TR_TILE;   // Rows in full tiles
+  size_t cf = cols / MX_TR_TILE * MX_TR_TILE;   // Columns in full tiles
+  size_t i0 = 0, j0 = 0, i = 0, j = 0;
+
+  for(i0 = 0; i0 < rf; i0 += MX_TR_TILE)
+  {
+    for(j0 = 0; j0 < cf; j0 += MX_TR_TILE)
+    {
+      for(j = 0; j < MX_TR_TILE; j++)
+      {
+        #pragma GCC unroll 8
+        for(i = 0; i < MX_TR_TILE; i++)
+        {
+          D[(j0 + j) * ldd + i0 + i] = S[(i0 + i) * lds + j0 + j];
+        }
+      }
+    }
+
+    for(j = cf; j < cols; j++)
+    {
+      for(i = i0; i < i0 + MX_TR_TILE; i++)
+      {
+        D[j * ldd + i] = S[i * lds + j];
+      }
+    }
+  }
+
+  for(i = rf; i < rows; i++)
+  {
+    for(j = 0; j < cols; j++)
+    {
+      D[j * ldd + i] = S[i * lds + j];
+    }
+  }
+}
+
+/**
+@brief  Cache-oblivious transpose D (cols x rows) = S^T
+@param  S, lds: Source block and its leading dimension
+        D, ldd: Destination block and its leading dimension (no overlap)
+        rows:   Source rows
+        cols:   Source columns
+@retval none
+@note   Halves the longer side until the block fits in L1, so every level
+        of the cache hierarchy sees blocks of its own size
+*/
+void matrix_transpose_rec(const Data* S, size_t lds, Data* D, size_t ldd,
+                          size_t rows, size_t cols)
+{
+  size_t h = 0;                                 // Split point
+
+  if(rows <= MX_TR_LEAF && cols <= MX_TR_LEAF)
+  {
+    matrix_transpose_leaf(S, lds, D, ldd, rows, cols);
+  }
+  else if(rows >= cols)
+  {
+    h = rows / 2 / MX_TR_TILE * MX_TR_TILE;
+    matrix_transpose_rec(S, lds, D, ldd, h, cols);
+    matrix_transpose_rec(&S[h * lds], lds, &D[h], ldd, rows - h, cols);
+  }
+  else
+  {
+    h = cols / 2 / MX_TR_TILE * MX_TR_TILE;
+    matrix_transpose_rec(S, lds, D, ldd, rows, h);
+    matrix_transpose_rec(&S[h], lds, &D[h * ldd], ldd, rows, cols - h);
+  }
+}
+
+/**
+@brief  Copies op(S) into a row-major buffer, op(S) = S or S^T
+@param  S:     Pointer to source matrix (or transposed view, any storage)
+        trans: TRUE to copy S^T
+        D:     Destination buffer
+        ldd:   Leading dimension of D
+@retval none
+*/
+void matrix_copy(Matrix S, uint8_t trans, Data* D, size_t ldd)
+{
+  size_t rows = S->transposed ? S->columns : S->rows;    // Stored shape
+  size_t cols = S->transposed ? S->rows : S->columns;
+  size_t b = 0, i = 0;
+
+  if(S->structure != MX_GENERAL)
+  {
+    matrix_copy_structured(S, trans, D, ldd);
+  }
+  else if(trans != S->transposed)
+  {
+    // Bands of source rows are independent
+    #pragma omp parallel for schedule(dynamic) \
+                             if(rows * cols >= MX_PARALLEL_MIN)
+    for(b = 0; b < rows; b += MX_TR_BAND)
+    {
+      matrix_transpose_rec(&S->data[b * S->ld], S->ld, &D[b], ldd,
+                           (rows - b < MX_TR_BAND) ? rows - b : MX_TR_BAND,
+                           cols);
+    }
+  }
+  else if(ldd == S->ld)
+  {
+    // Padding included, but not past the last element (S may be a view)
+    memcpy(D, S->data, ((rows - 1) * ldd + cols) * sizeof(Data));
+  }
+  else
+  {
+    for(i = 0; i < rows; i++)
+    {
+      memcpy(&D[i * ldd], &S->data[i * S->ld], cols * sizeof(Data));
+    }
+  }
+}
+
+/**
+@brief  Element-wise kernel over one contiguous row: r = op(a, b)
+@param  op:    Operation
+        n:     Number of elements
+        alpha: Scale of a (MX_EW_AXPBY) or exponent (MX_EW_POWER)
+        a:     First operand
+        beta:  Scale of b (MX_EW_AXPBY)
+        b:     Second operand (NULL for scaling and powers)
+        r:     Result (may be a or b)
+@retval none
+@note   One loop per case with no branch inside, so each one vectorizes
+*/
+MX_KERNEL_CLONES
+void matrix_ewise_row(t_matrixEwOp op, size_t n, Data alpha, const Data* a,
+                      Data beta, const Data* b, Data* r)
+{
+  size_t j = 0, e = 0, c = 0, m = 0;
+  size_t k = (fabs(alpha) <= MX_EW_POW_INT) ? (size_t)fabs(alpha) : 0;
+  Data x[MX_EW_CHUNK], y[MX_EW_CHUNK];      // Powers of a / partial result
+
+  switch(op)
+  {
+    case MX_EW_AXPBY:
+      if(b == NULL)
+      {
+        for(j = 0; j < n; j++)
+        {
+          r[j] = alpha * a[j];
+        }
+      }
+      else
+      {
+        for(j = 0; j < n; j++)
+        {
+          r[j] = alpha * a[j] + beta * b[j];
+        }
+      }
+      break;
+
+    case MX_EW_PRODUCT:
+      for(j = 0; j < n; j++)
+      {
+        r[j] = a[j] * b[j];
+      }
+      break;
+
+    case MX_EW_DIVISION:
+      for(j = 0; j < n; j++)
+      {
+        r[j] = a[j] / b[j];
+      }
+      break;
+
+    case MX_EW_POWER:
+      if(alpha == 0.5)
+      {
+        for(j = 0; j < n; j++)
+        {
+          r[j] = sqrt(a[j]);
+        }
+      }
+      else if(alpha == (Data)k || alpha == -(Data)k)   // |alpha| integer
+      {
+        // Repeated squaring by chunks: bit loop outside, element loops
+        // (vectorized) inside
+        for(c = 0; c < n; c += MX_EW_CHUNK)
+        {
+          m = (n - c < MX_EW_CHUNK) ? n - c : MX_EW_CHUNK;
+
+          for(j = 0; j < m; j++)
+          {
+            x[j] = a[c + j];
+            y[j] = 1;
+          }
+
+          for(e = k; e != 0; e >>= 1)
+          {
+            if(e & 1)
+            {
+              for(j = 0; j < m; j++)
+              {
+                y[j] *= x[j];
+              }
+            }
+
+            for(j = 0; j < m; j++)
+            {
+              x[j] *= x[j];
+            }
+          }
+
+          for(j = 0; j < m; j++)
+          {
+            r[c + j] = (alpha < 0) ? 1 / y[j] : y[j];
+          }
+        }
+      }
+      else
+      {
+        for(j = 0; j < n; j++)
+        {
+          r[j] = pow(a[j], alpha);
+        }
+      }
+      break;
+  }
+}
+
+/**
+@brief  Checks if op(A, B) has the structure of A
+@param  op:    Operation
+        alpha: Scale of A (MX_EW_AXPBY) or exponent (MX_EW_POWER)
+        A:     Pointer to first matrix
+        B:     Pointer to second matrix (NULL for scaling and powers)
+@retval TRUE if A is structured, B (if any) has the same structure and op
+        maps the zeros outside it to zero (any op for symmetric matrices)
+*/
+uint8_t matrix_ewise_keeps(t_matrixEwOp op, Data alpha, Matrix A, Matrix B)
+{
+  if(A->structure == MX_GENERAL || (B != NULL && (B->structure !=
+     A->structure || B->kl != A->kl || B->ku != A->ku)))
+  {
+    return FALSE;
+  }
+
+  return A->structure == MX_SYMMETRIC || op == MX_EW_AXPBY ||
+         op == MX_EW_PRODUCT || (op == MX_EW_POWER && alpha > 0);
+}
+
+/**
+@brief  Element-wise operation into R: R = op(A, B)
+@param  op:    Operation
+        R:     Pointer to result matrix (may be A or B)
+        alpha: Scale of A (MX_EW_AXPBY) or exponent (MX_EW_POWER)
+        A:     Pointer to first matrix
+        beta:  Scale of B (MX_EW_AXPBY)
+        B:     Pointer to second matrix (NULL for scaling and powers)
+@retval TRUE if operation was computed, FALSE if dimensions do not match,
+        R is a transposed view of an operand, R is structured and the
+        result is not, or on memory error
+@note   Operands stored in the orientation of R stream row by row; the
+        others are first transposed (or unpacked) into a temporary with the
+        blocked kernel. A structured R streams the packed storage
+*/
+uint8_t matrix_ewise(t_matrixEwOp op, Matrix R, Data alpha, Matrix A,
+                     Data beta, Matrix B)
+{
+  Matrix T[2] = {A, B};                 // Operands in the orientation of R
+  Matrix X = NULL;
+  size_t rows = 0, cols = 0, i = 0, s = 0;
+  uint8_t ok = TRUE;
+
+  if(R == NULL || A == NULL || A->rows != R->rows || 
+     A->columns != R->columns || (B != NULL && (B->rows != R->rows || 
+     B->columns != R->columns)))
+  {
+    return FALSE;
+  }
+
+  // Structured R: operands of the same structure, one pass over the packed
+  // storage
+  if(R->structure != MX_GENERAL)
+  {
+    if(!matrix_ewise_keeps(op, alpha, A, B) || A->structure != R->structure
+       || A->kl != R->kl || A->ku != R->ku)
+    {
+      return FALSE;
+    }
+
+    matrix_touch(R);
+    s = matrix_storage(R);
+
+    #pragma omp parallel for if(s >= MX_PARALLEL_MIN)
+    for(i = 0; i < s; i += MX_EW_SPAN)
+    {
+      matrix_ewise_row(op, (s - i < MX_EW_SPAN) ? s - i : MX_EW_SPAN, alpha,
+                       &A->data[i], beta, (B != NULL) ? &B->data[i] : NULL,
+                       &R->data[i]);
+    }
+
+    return TRUE;
+  }
+
+  // Stored shape of R
+  rows = R->transposed ? R->columns : R->rows;
+  cols = R->transposed ? R->rows : R->columns;
+
+  for(s = 0; s < 2; s++)
+  {
+    X = T[s];
+
+    // Partially overlapping views are read from a copy as well
+    if(X != NULL && (X->transposed != R->transposed ||
+       X->structure != MX_GENERAL || (X->data != R->data &&
+       matrix_overlap(X, R))))
+    {
+      // Writing R would overwrite elements still to be read
+      if(X->data == R->data)
+      {
+        ok = FALSE;
+        T[s] = NULL;
+      }
+      else
+      {
+        T[s] = Mx_Hdlr.init(rows, cols);
+
+        if(T[s] == NULL)
+        {
+          ok = FALSE;
+        }
+        else
+        {
+          matrix_copy(X, R->transposed, T[s]->data, T[s]->ld);
+        }
+      }
+    }
+  }
+
+  if(ok)
+  {
+    matrix_touch(R);
+
+    #pragma omp parallel for if(rows * cols >= MX_PARALLEL_MIN)
+    for(i = 0; i < rows; i++)
+    {
+      matrix_ewise_row(op, cols, alpha, &T[0]->data[i * T[0]->ld], beta,
+                       (T[1] != NULL) ? &T[1]->data[i * T[1]->ld] : NULL,
+                       &R->data[i * R->ld]);
+    }
+  }
+
+  // Temporaries
+  for(s = 0; s < 2; s++)
+  {
+    if(T[s] != A && T[s] != B)
+    {
+      Mx_Hdlr.del(T[s]);
+    }
+  }
+
+  return ok;
+}
+
+/**
+@brief  Element-wise operation into a new matrix: op(A, B)
+@param  op:    Operation
+        alpha: Scale of A (MX_EW_AXPBY) or exponent (MX_EW_POWER)
+        A:     Pointer to first matrix
+        beta:  Scale of B (MX_EW_AXPBY)
+        B:     Pointer to second matrix (NULL for scaling and powers)
+@retval Pointer to result matrix (structured as A when the operation keeps
+        the structure), NULL if dimensions do not match
+*/
+Matrix matrix_ewise_new(t_matrixEwOp op, Data alpha, Matrix A, Data beta,
+                        Matrix B)
+{
+  Matrix R = NULL;
+
+  if(A == NULL || (B != NULL && (A->rows != B->rows ||
+     A->columns != B->columns)))
+  {
+    return NULL;
+  }
+
+  R = matrix_ewise_keeps(op, alpha, A, B) ?
+      matrix_alloc_structured(A->rows, A->structure, A->kl, A->ku) :
+      Mx_Hdlr.init(A->rows, A->columns);
+
+  if(R != NULL && !matrix_ewise(op, R, alpha, A, beta, B))
+  {
+    Mx_Hdlr.del(R);
+    R = NULL;
+  }
+
+  return R;
+}
+
+/**
+@brief  Factors the panel of columns [k0, k1) of an LU matrix in place
+@param  F:   Pointer to factorization (rows above k0 already factored)
+        k0:  First panel column
+        k1:  Panel end (exclusive)
+@retval none
+@note   Row interchanges are applied to whole rows, so the L columns on the
+        left and the not yet updated columns on the right stay consistent.
+        Only an exactly zero pivot column marks the matrix singular, as in
+        the banded and triangular solvers: ill-conditioned matrices keep
+        their computed determinant, inverse and solutions
+*/
+void matrix_lu_panel(MatrixLU F, size_t k0, size_t k1)
+{
+  Data* a = F->LU->data;
+  size_t ld = F->LU->ld, n = F->n;
+  size_t i = 0, j = 0, c = 0, p = 0;
+  Data best = 0, t = 0, inv = 0, l = 0;
+
+  for(j = k0; j < k1; j++)
+  {
+    // Partial pivoting: largest magnitude in column j
+    for(i = j, p = j, best = -1; i < n; i++)
+    {
+      if(fabs(a[i * ld + j]) > best)
+      {
+        best = fabs(a[i * ld + j]);
+        p = i;
+      }
+    }
+
+    F->piv[j] = p;
+
+    if(best == 0)
+    {
+      F->singular = TRUE;
+
+      continue;
+    }
+
+    if(p != j)
+    {
+      for(c = 0; c < n; c++)
+      {
+        t = a[j * ld + c];
+        a[j * ld + c] = a[p * ld + c];
+        a[p * ld + c] = t;
+      }
+
+      F->sign = -F->sign;
+    }
+
+    // Multipliers and rank-1 update restricted to the panel
+    inv = 1 / a[j * ld + j];
+
+    #pragma omp parallel for private(l, c) if((n - j) * (k1 - j) >= MX_PARALLEL_MIN)
+    for(i = j + 1; i < n; i++)
+    {
+      l = (a[i * ld + j] *= inv);
+
+      for(c = j + 1; c < k1; c++)
+      {
+        a[i * ld + c] -= l * a[j * ld + c];
+      }
+    }
+  }
+}
+
+/**
+@brief  Drops the LU factors cached in M, not those of its base
+@param  M: Pointer to matrix
+@retval none
+*/
+void matrix_lu_drop(Matrix M)
+{
+  if(M->lu != NULL)
+  {
+    matrix_lu_delete(M->lu);
+    M->lu = NULL;
+  }
+}
+
+/**
+@brief  Gets the LU factors of M, factorizing only if M changed since the
+        last call
+@param  M: Pointer to square matrix
+@retval Pointer to factors owned by M (freed by matrix_touch / matrix_delete),
+        NULL if M is not square or on memory error
+@note   Also refreshes the cached determinant. Views are factorized on every
+        call; reading a view leaves the caches of its base untouched
+*/
+MatrixLU matrix_factors(Matrix M)
+{
+  if(M == NULL || M->rows != M->columns)
+  {
+    return NULL;
+  }
+  
+  // Views see writes to their base that do not reach their own flag
+  if(M->dirty || M->lu == NULL || M->base != NULL)
+  {
+    matrix_lu_drop(M);
+    M->lu = matrix_lu_create(M);
+    
+    if(M->lu == NULL)
+    {
+      return NULL;
+    }
+    
+    M->determinant = matrix_lu_det(M->lu);
+    M->dirty = FALSE;
+  }
+  
+  return M->lu;
+}
+
+/**
+@brief  LU factorization with partial pivoting of a banded matrix
+@param  M:    Pointer to banded matrix (n x n, kl / ku)
+        w:    Factors (n x ldw, ldw = 2 kl + ku + 1): row i holds columns
+              [i - kl, i + kl + ku] at w[i * ldw + j + kl - i], the last kl
+              for fill-in
+        piv:  Row interchanged with row j at step j (n elements)
+        sign: Sign of the permutation
+@retval TRUE if factorized, FALSE on a zero pivot (singular)
+@note   Interchanges reach columns j.. only: multipliers stay in the row
+        where they were computed, so a solve applies interchanges and
+        eliminations step by step
+*/
+uint8_t matrix_band_lu(Matrix M, Data* w, size_t* piv, double* sign)
+{
+  size_t n = M->rows, kl = M->kl, ku = M->ku, ldw = 2 * kl + ku + 1;
+  size_t i = 0, j = 0, c = 0, p = 0, ie = 0, ce = 0;
+  Data best = 0, t = 0, l = 0;
+
+  memset(w, 0, n * ldw * sizeof(Data));
+
+  // Same offsets as the band storage
+  for(i = 0; i < n; i++)
+  {
+    memcpy(&w[i * ldw], &M->data[i * M->ld], M->ld * sizeof(Data));
+  }
+
+  *sign = 1;
+
+  for(j = 0; j < n; j++)
+  {
+    ie = (n - j > kl) ? j + kl + 1 : n;           // Rows with column j
+    ce = (n - j > kl + ku) ? j + kl + ku + 1 : n; // Columns after fill-in
+
+    for(i = j, p = j, best = -1; i < ie; i++)
+    {
+      if(fabs(w[i * ldw + j + kl - i]) > best)
+      {
+        best = fabs(w[i * ldw + j + kl - i]);
+        p = i;
+      }
+    }
+
+    piv[j] = p;
+
+    if(best == 0)
+    {
+      return FALSE;
+    }
+
+    if(p != j)
+    {
+      for(c = j; c < ce; c++)
+      {
+        t = w[j * ldw + c + kl - j];
+        w[j * ldw + c + kl - j] = w[p * ldw + c + kl - p];
+        w[p * ldw + c + kl - p] = t;
+      }
+
+      *sign = -*sign;
+    }
+
+    for(i = j + 1; i < ie; i++)
+    {
+      l = (w[i * ldw + j + kl - i] /= w[j * ldw + kl]);
+
+      if(l != 0)
+      {
+        matrix_axpy_row(ce - j - 1, -l, &w[j * ldw + kl + 1],
+                        &w[i * ldw + j + 1 + kl - i]);
+      }
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Solves A X = B in place from a band LU factorization of A
+@param  w:      Factors (see matrix_band_lu)
+        piv:    Row interchanges
+        n:      Dimension
+        kl, ku: Sub- / super-diagonals of A
+        X:      Pointer to right-hand sides on input, solution on output
+@retval none
+*/
+void matrix_band_solve(const Data* w, const size_t* piv, size_t n, size_t kl,
+                       size_t ku, Matrix X)
+{
+  Data* x = X->data;
+  size_t ldw = 2 * kl + ku + 1, lx = X->ld, m = X->columns;
+  size_t i = 0, j = 0, c = 0, ie = 0, ce = 0;
+  Data t = 0;
+
+  // L: interchange, then eliminate below row j
+  for(j = 0; j < n; j++)
+  {
+    if(piv[j] != j)
+    {
+      for(c = 0; c < m; c++)
+      {
+        t = x[j * lx + c];
+        x[j * lx + c] = x[piv[j] * lx + c];
+        x[piv[j] * lx + c] = t;
+      }
+    }
+
+    ie = (n - j > kl) ? j + kl + 1 : n;
+
+    for(i = j + 1; i < ie; i++)
+    {
+      matrix_axpy_row(m, -w[i * ldw + j + kl - i], &x[j * lx], &x[i * lx]);
+    }
+  }
+
+  // U: kl + ku super-diagonals
+  for(i = n; i-- > 0; )
+  {
+    ce = (n - i > kl + ku) ? i + kl + ku + 1 : n;
+
+    for(c = i + 1; c < ce; c++)
+    {
+      matrix_axpy_row(m, -w[i * ldw + c + kl - i], &x[c * lx], &x[i * lx]);
+    }
+
+    matrix_ewise_row(MX_EW_AXPBY, m, 1 / w[i * ldw + kl], &x[i * lx], 0, NULL,
+                     &x[i * lx]);
+  }
+}
+
+/**
+@brief  Product of two matrices when at least one is structured
+@param  A: Pointer to first matrix (m x k)
+        B: Pointer to second matrix (k x n)
+@retval Pointer to product matrix, NULL on memory error
+@note   Row i of the product is the sum of a_ik times row k of B over the
+        stored slice of row i of A, written into the stored slice of row i
+        of the result. Symmetric operands and transposed views are unpacked
+*/
+Matrix matrix_product_structured(Matrix A, Matrix B)
+{
+  Matrix T[2] = {A, B};                 // Operands with contiguous rows
+  Matrix P = NULL;
+  t_matrixStructure s = MX_GENERAL;
+  size_t kl = 0, ku = 0, i = 0, t = 0;
+
+  for(t = 0; t < 2; t++)
+  {
+    if(T[t]->transposed || T[t]->structure == MX_SYMMETRIC)
+    {
+      T[t] = matrix_unpack(T[t]);
+    }
+  }
+
+  // Structure of the product: diagonal factors keep the other one;
+  // triangles and bands are closed
+  if(T[0] != NULL && T[1] != NULL)
+  {
+    if(T[0]->structure == MX_DIAGONAL)
+    {
+      s = T[1]->structure;
+      kl = T[1]->kl;
+      ku = T[1]->ku;
+    }
+    else if(T[1]->structure == MX_DIAGONAL)
+    {
+      s = T[0]->structure;
+      kl = T[0]->kl;
+      ku = T[0]->ku;
+    }
+    else if(T[0]->structure == MX_BANDED && T[1]->structure == MX_BANDED)
+    {
+      s = MX_BANDED;
+      kl = (T[0]->kl + T[1]->kl < A->rows) ? T[0]->kl + T[1]->kl : A->rows - 1;
+      ku = (T[0]->ku + T[1]->ku < A->rows) ? T[0]->ku + T[1]->ku : A->rows - 1;
+    }
+    else if(T[0]->structure == T[1]->structure)
+    {
+      s = T[0]->structure;
+    }
+
+    P = (s == MX_GENERAL) ? Mx_Hdlr.init(A->rows, B->columns) :
+                            matrix_alloc_structured(A->rows, s, kl, ku);
+  }
+
+  if(P != NULL)
+  {
+    #pragma omp parallel for schedule(dynamic, 64) \
+                             if(P->rows * P->columns >= MX_PARALLEL_MIN)
+    for(i = 0; i < P->rows; i++)
+    {
+      size_t alo = 0, ahi = 0, blo = 0, bhi = 0, plo = 0, phi = 0, k = 0;
+      const Data* a = matrix_row(T[0], i, &alo, &ahi);
+      const Data* b = NULL;
+      Data* p = matrix_row(P, i, &plo, &phi);
+
+      for(k = alo; k < ahi; k++)
+      {
+        if(a[k - alo] != 0)
+        {
+          b = matrix_row(T[1], k, &blo, &bhi);
+          matrix_axpy_row(bhi - blo, a[k - alo], b, &p[blo - plo]);
+        }
+      }
+    }
+  }
+
+  // Temporaries
+  for(t = 0; t < 2; t++)
+  {
+    if(T[t] != A && T[t] != B)
+    {
+      Mx_Hdlr.del(T[t]);
+    }
+  }
+
+  return P;
+}
+
+/**
+@brief  Solves A X = B for a structured A
+@param  A: Pointer to structured square matrix (n x n)
+        B: Pointer to right-hand sides (n x r, any storage)
+@retval Pointer to solution matrix X (n x r), NULL if A is singular or on
+        memory error
+@note   Diagonal and triangular: substitution by rows, in the order in which
+        the unknowns of each row are already known. Symmetric: cached LU
+*/
+Matrix matrix_solve_structured(Matrix A, Matrix B)
+{
+  Matrix X = NULL;
+  const Data* a = NULL;
+  Data* w = NULL;
+  size_t* piv = NULL;
+  Data* x = NULL;
+  size_t n = A->rows, m = B->columns, lx = 0, r = 0, i = 0, k = 0;
+  size_t lo = 0, hi = 0;
+  double sign = 1;
+  uint8_t ok = TRUE;
+
+  X = Mx_Hdlr.init(B->rows, B->columns);
+
+  if(X == NULL)
+  {
+    return NULL;
+  }
+
+  x  = X->data;
+  lx = X->ld;
+  matrix_copy(B, FALSE, x, lx);
+
+  switch(A->structure)
+  {
+    case MX_DIAGONAL:
+    case MX_LOWER:
+    case MX_UPPER:
+      // x_i = (b_i - sum of a_ik x_k, k != i) / a_ii; upper: bottom-up
+      for(r = 0; r < n && ok; r++)
+      {
+        i = (A->structure == MX_UPPER) ? n - 1 - r : r;
+        a = matrix_row(A, i, &lo, &hi);
+
+        for(k = lo; k < hi; k++)
+        {
+          if(k != i && a[k - lo] != 0)
+          {
+            matrix_axpy_row(m, -a[k - lo], &x[k * lx], &x[i * lx]);
+          }
+        }
+
+        ok = (a[i - lo] != 0);
+
+        if(ok)
+        {
+          matrix_ewise_row(MX_EW_AXPBY, m, 1 / a[i - lo], &x[i * lx], 0, NULL,
+                           &x[i * lx]);
+        }
+      }
+      break;
+
+    case MX_BANDED:
+      w = (Data*)malloc( n * (2 * A->kl + A->ku + 1) * sizeof(Data) );
+      piv = (size_t*)malloc( n * sizeof(size_t) );
+      ok = (w != NULL && piv != NULL && matrix_band_lu(A, w, piv, &sign));
+
+      if(ok)
+      {
+        matrix_band_solve(w, piv, n, A->kl, A->ku, X);
+      }
+
+      free(w);
+      free(piv);
+      break;
+
+    default:
+      ok = matrix_lu_solve(matrix_factors(A), X, X);
+      break;
+  }
+
+  if(!ok)
+  {
+    Mx_Hdlr.del(X);
+    X = NULL;
+  }
+
+  return X;
+}
+
+/**
+@brief  Refreshes the cached determinant of a structured matrix
+@param  M: Pointer to structured matrix
+@retval TRUE if determinant was computed, FALSE on memory error
+@note   Diagonal and triangular: product of the diagonal, O(n). Banded: band
+        LU, O(n kl (kl + ku)). Symmetric: cached LU
+*/
+uint8_t matrix_structured_det(Matrix M)
+{
+  Data* w = NULL;
+  size_t* piv = NULL;
+  size_t n = M->rows, i = 0;
+  double d = 1;
+
+  switch(M->structure)
+  {
+    case MX_BANDED:
+      w = (Data*)malloc( n * (2 * M->kl + M->ku + 1) * sizeof(Data) );
+      piv = (size_t*)malloc( n * sizeof(size_t) );
+
+      if(w == NULL || piv == NULL)
+      {
+        free(w);
+        free(piv);
+
+        return FALSE;
+      }
+
+      if(matrix_band_lu(M, w, piv, &d))
+      {
+        for(i = 0; i < n; i++)
+        {
+          d *= w[i * (2 * M->kl + M->ku + 1) + M->kl];
+        }
+      }
+      else
+      {
+        d = 0;
+      }
+
+      free(w);
+      free(piv);
+      break;
+
+    case MX_SYMMETRIC:
+      return matrix_factors(M) != NULL;
+
+    default:
+      for(i = 0; i < n; i++)
+      {
+        d *= *matrix_slot(M, i, i);
+      }
+      break;
+  }
+
+  M->determinant = d;
+  M->dirty = FALSE;
+
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates memory to create a new matrix. All values as zero by default
+@param  rows: Number of rows
+        columns: Number of columns
+@retval Pointer to new matrix
+*/
+Matrix matrix_create(size_t rows, size_t columns)
+{
+  Matrix M = NULL;         // New matrix
+  size_t ld = 0;           // Leading dimension
+  size_t i = 0;            // Iterator
+  
+  // Validates dimensions
+  if(rows == 0 || columns == 0 || columns > SIZE_MAX - MX_PAD)
+  {
+    return NULL;
+  }
+  
+  // Rows padded to whole cache lines; 4 KiB multiples (which map every row
+  // of a block to the same cache sets) get one more line
+  ld = (columns + MX_PAD - 1) / MX_PAD * MX_PAD;
+  ld = (ld % (4096 / sizeof(Data)) == 0) ? ld + MX_PAD : ld;
+  
+  // Overflow-checked buffer sizes
+  if(rows > SIZE_MAX / ld / sizeof(Data) || rows > SIZE_MAX / sizeof(Vector))
+  {
+    return NULL;
+  }
+
+  // Allocates memory for matrix structure
+  M = (Matrix)malloc( sizeof(t_matrix) );
+  
+  // Returns in case of memory allocation error
+  if(M == NULL)
+  {
+    return M;
+  }
+  
+  // Sets matrix dimensions
+  M->rows = rows;
+  M->columns = columns;
+  M->ld = ld;
+  M->structure = MX_GENERAL;
+  M->kl = 0;
+  M->ku = 0;
+  
+  // Nothing cached yet
+  M->determinant = 0;
+  M->dirty = TRUE;
+  M->lu = NULL;
+  M->transposed = FALSE;
+  M->base = NULL;
+  M->release = NULL;
+  
+  // Allocates one aligned buffer for all elements and the row pointers view
+  M->data = (Data*)aligned_alloc( MX_ALIGN, rows * ld * sizeof(Data) );
+  M->matrix = (Array)malloc( rows * sizeof(Vector) );
+  
+  // Returns in case of memory allocation error
+  if(M->data == NULL || M->matrix == NULL)
+  {
+    free(M->data);
+    free(M->matrix);
+    free(M);
+    
+    return NULL;
+  }
+  
+  // Sets matrix elements (and padding) as zero
+  memset(M->data, 0, rows * ld * sizeof(Data));
+  
+  // Row i starts at data + i * ld
+  for(i = 0; i < rows; i++)
+  {
+    M->matrix[i] = M->data + i * ld;
+  }
+   
+  return M;
+}
+
+/**
+@brief  Allocates memory to create a new identity matrix.
+@param  dimension: Matrix dimension (n x n)
+@retval Pointer to new matrix
+*/
+Matrix matrix_identity(size_t dimension)
+{
+  Matrix M_eye = NULL;         // New identity matrix
+  size_t i = 0;                // Iterator
+  
+  // Initializes matrix
+  if(dimension != 0)
+  {
+    M_eye = Mx_Hdlr.init(dimension, dimension);
+    
+    if(M_eye != NULL)
+    {
+      // Sets identity matrix elements
+      for(i = 0; i < M_eye->rows; i++)
+      {
+        M_eye->data[i * M_eye->ld + i] = 1;
+      }
+    }
+  }
+  
+  return M_eye;
+}
+
+/**
+@brief  Verifies if matrix is null
+@param  M: Pointer to matrix
+@retval TRUE if matrix is null, FALSE otherwise
+*/
+uint8_t matrix_isNull(Matrix M)
+{
+  size_t i = 0, j = 0;         // Iterators
+  
+  if(M != NULL && M->structure != MX_GENERAL)
+  {
+    // Packed storage: zeros outside the structure are not stored
+    for(i = 0; i < matrix_storage(M); i++)
+    {
+      if(M->data[i] != 0)
+      {
+        return FALSE;
+      }
+    }
+  }
+  else if(M != NULL)
+  {
+    // Verifies matrix elements
+    for(i = 0; i < M->rows; i++)
+    {
+      for(j = 0; j < M->columns; j++)
+      {
+        if(M->data[matrix_index(M, i, j)] != 0)
+        {
+          return FALSE;
+        }
+      }
+    }
+  }
+  
+  return TRUE;
+}
+
+/**
+@brief  Gets number of rows of indicated matrix
+@param  M: Pointer to matrix
+@retval Number of rows
+*/
+size_t matrix_getRows(Matrix M)
+{
+  return (M != NULL) ? M->rows : 0;
+}
+
+/**
+@brief  Gets number of columns of indicated matrix
+@param  M: Pointer to matrix
+@retval Number of columns
+*/
+size_t matrix_getColumns(Matrix M)
+{
+  return (M != NULL) ? M->columns : 0;
+}
+
+/**
+@brief  Gets an element of a matrix (any storage)
+@param  M: Pointer to matrix
+        i: Row index
+        j: Column index
+        k: Pointer to value (0 outside the structure)
+@retval TRUE if indices are valid, FALSE otherwise
+*/
+uint8_t matrix_get(Matrix M, size_t i, size_t j, Data* k)
+{
+  if(M == NULL || k == NULL || i >= M->rows || j >= M->columns)
+  {
+    return FALSE;
+  }
+
+  *k = matrix_at(M, i, j);
+
+  return TRUE;
+}
+
+/**
+@brief  Gets determinant of matrix if defined
+@param  M: Pointer to matrix
+        detval: Determinant value
+@retval TRUE if determinant exists, FALSE otherwise
+*/
+uint8_t matrix_getDeterminant(Matrix M, double* detval)
+{
+  if(detval == NULL || M == NULL)
+  {
+    return FALSE;
+  }
+
+  // Structured: diagonal products or band LU; otherwise determinant is
+  // defined only if M is a square matrix
+  if(M->structure != MX_GENERAL)
+  {
+    if(M->dirty && !matrix_structured_det(M))
+    {
+      return FALSE;
+    }
+  }
+  else if(matrix_factors(M) == NULL)
+  {
+    return FALSE;
+  }
+  
+  *detval = M->determinant;
+  
+  return TRUE;
+}
+
+/**
+@brief  Updates a value of introduced matrix
+@param  M: Pointer to matrix
+        k: Data
+        i: Row index
+        j: Column index
+@retval TRUE if element was updated, FALSE otherwise (out of range, or a
+        nonzero outside the structure)
+*/
+uint8_t matrix_update(Matrix M, Data k, size_t i, size_t j)
+{
+  Data* p = NULL;
+  
+  if(M != NULL && i < M->rows && j < M->columns)
+  {
+    p = matrix_slot(M, i, j);
+    
+    // Outside the structure only zeros fit (and are already there)
+    if(p == NULL)
+    {
+      return (k == 0);
+    }
+    
+    // Updates ijth element
+    *p = k;
+    matrix_touch(M);
+    
+    return TRUE;
+  }
+  
+  return FALSE;
+}
+
+/**
+@brief  Marks matrix as modified, dropping cached determinant and LU factors
+@param  M: Pointer to matrix
+@retval TRUE if matrix exists, FALSE otherwise
+@note   Touching a view also touches its base
+*/
+uint8_t matrix_touch(Matrix M)
+{
+  if(M != NULL)
+  {
+    if(M->base != NULL)
+    {
+      matrix_touch(M->base);
+    }
+    
+    matrix_lu_drop(M);
+    M->dirty = TRUE;
+    
+    return TRUE;
+  }
+  
+  return FALSE;
+}
+
+/**
+@brief  Verifies if M1 and M2 are equal
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if matrices are equal, FALSE otherwise
+*/
+uint8_t matrix_areEqual(Matrix M1, Matrix M2)
+{
+  size_t i = 0, j = 0;         // Iterators
+  
+  if(M1 != NULL && M2 != NULL && M1->rows == M2->rows && 
+     M1->columns == M2->columns)
+  {
+    // Verifies matrix elements
+    for(i = 0; i < M1->rows; i++)
+    {
+      for(j = 0; j < M1->columns; j++)
+      {
+        if(matrix_at(M1, i, j) != matrix_at(M2, i, j))
+        {
+          return FALSE;
+        }
+      }
+    }
+    
+    return TRUE;
+  }
+  
+  return FALSE;
+}
+
+/**
+@brief  Obtains the algebraic sum of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to sum matrix
+@note   If dimensions do not match, the function returns a NULL pointer
+*/
+Matrix matrix_sum(Matrix M1, Matrix M2)
+{
+  return (M2 != NULL) ? matrix_ewise_new(MX_EW_AXPBY, 1, M1, 1, M2) : NULL;
+}
+
+/**
+@brief  Algebraic sum into an existing matrix: R = M1 + M2
+@param  R:  Pointer to result matrix (may be M1 or M2: in place)
+        M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if sum was computed, FALSE if dimensions do not match
+*/
+uint8_t matrix_sum_into(Matrix R, Matrix M1, Matrix M2)
+{
+  return (M2 != NULL) ? matrix_ewise(MX_EW_AXPBY, R, 1, M1, 1, M2) : FALSE;
+}
+
+/**
+@brief  Obtains the multiplication of a matrix and a scalar factor
+@param  k: Scalar factor
+        M: Pointer to matrix
+@retval Pointer to scalated matrix
+*/
+Matrix matrix_scalar(Data k, Matrix M)
+{
+  return matrix_ewise_new(MX_EW_AXPBY, k, M, 0, NULL);
+}
+
+/**
+@brief  Scalar product into an existing matrix: R = k M
+@param  R: Pointer to result matrix (may be M: in place)
+        k: Scalar factor
+        M: Pointer to matrix
+@retval TRUE if product was computed, FALSE if dimensions do not match
+*/
+uint8_t matrix_scalar_into(Matrix R, Data k, Matrix M)
+{
+  return matrix_ewise(MX_EW_AXPBY, R, k, M, 0, NULL);
+}
+
+/**
+@brief  Fused linear combination: R = a A + b B
+@param  R: Pointer to result matrix (may be A or B: in place)
+        a: Scale of A
+        A: Pointer to first matrix
+        b: Scale of B
+        B: Pointer to second matrix
+@retval TRUE if combination was computed, FALSE if dimensions do not match
+*/
+uint8_t matrix_axpby(Matrix R, Data a, Matrix A, Data b, Matrix B)
+{
+  return (B != NULL) ? matrix_ewise(MX_EW_AXPBY, R, a, A, b, B) : FALSE;
+}
+
+/**
+@brief  Obtains the algebraic multiplication of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to product matrix
+@note If dimensions do not match, the function returns a NULL pointer
+*/
+Matrix matrix_product(Matrix M1, Matrix M2)
+{
+  Matrix P = NULL;
+
+  if(M1 == NULL || M2 == NULL || M1->columns != M2->rows)
+  {
+    return NULL;
+  }
+
+  if(M1->structure != MX_GENERAL || M2->structure != MX_GENERAL)
+  {
+    return matrix_product_structured(M1, M2);
+  }
+
+  P = Mx_Hdlr.init(M1->rows, M2->columns);
+
+  if(P != NULL && !matrix_gemm(1, M1, M2, 0, P))
+  {
+    Mx_Hdlr.del(P);
+
+    return NULL;
+  }
+
+  return P;
+}
+
+/**
+@brief  General matrix product in place: C = alpha * A * B + beta * C
+@param  alpha: Scale of A * B
+        A:     Pointer to first matrix (m x k)
+        B:     Pointer to second matrix (k x n)
+        beta:  Scale of previous C (0: previous C is ignored, even NaN)
+        C:     Pointer to result matrix (m x n), storage disjoint from A, B
+@retval TRUE if product was computed, FALSE otherwise
+@note   Any operand may be a transposed view. A transposed C is computed as
+        C^T = alpha * B^T * A^T + beta * C^T
+*/
+uint8_t matrix_gemm(Data alpha, Matrix A, Matrix B, Data beta, Matrix C)
+{
+  Matrix P = NULL;
+  uint8_t ok = FALSE;
+
+  if(A == NULL || B == NULL || C == NULL || A->columns != B->rows ||
+     C->rows != A->rows || C->columns != B->columns || C->structure !=
+     MX_GENERAL || matrix_overlap(C, A) || matrix_overlap(C, B))
+  {
+    return FALSE;
+  }
+
+  // Structured operands: specialized product, then C = alpha P + beta C
+  if(A->structure != MX_GENERAL || B->structure != MX_GENERAL)
+  {
+    P = matrix_product_structured(A, B);
+    ok = (P != NULL && matrix_ewise(MX_EW_AXPBY, C, alpha, P, beta,
+                                    (beta != 0) ? C : NULL));
+    Mx_Hdlr.del(P);
+
+    return ok;
+  }
+
+  matrix_touch(C);
+
+  if(C->transposed)
+  {
+    return matrix_gemm_core(B->columns, A->rows, A->columns, alpha, B->data,
+                            B->ld, !B->transposed, A->data, A->ld,
+                            !A->transposed, beta, C->data, C->ld);
+  }
+
+  return matrix_gemm_core(A->rows, B->columns, A->columns, alpha, A->data,
+                          A->ld, A->transposed, B->data, B->ld,
+                          B->transposed, beta, C->data, C->ld);
+}
+
+/**
+@brief  Obtains the algebraic integer power of a matrix
 @param  M: Pointer to matrix
-        i: Row index
-        j: Column index
-        cof: Pointer to cofactor value
-@retval TRUE if cofactor exists, FALSE otherwise
+        n: Exponent (M^0 = I)
+@retval Pointer to power matrix
+@note If dimensions do not match, the function returns a NULL pointer
+*/
+Matrix matrix_power(Matrix M, uint64_t n)
+{
+  Matrix P = NULL;                  // Power
+  Data *s1 = NULL, *s2 = NULL;      // Scratch buffers
+  Data *r = NULL, *x = NULL, *t = NULL, *w = NULL;
+  Matrix U = NULL;                  // Unpacked M
+  size_t d = 0, ld = 0, i = 0, j = 0;
+  uint8_t diagonal = TRUE, first = TRUE, ok = TRUE;
+  
+  if(M == NULL || M->rows != M->columns)
+  {
+    return NULL;
+  }
+  
+  d = M->rows;
+  
+  // Diagonal storage: element powers of the n stored values
+  if(M->structure == MX_DIAGONAL)
+  {
+    P = matrix_alloc_structured(d, MX_DIAGONAL, 0, 0);
+    
+    for(i = 0; P != NULL && i < d; i++)
+    {
+      P->data[i] = (n == 0) ? 1 : pow(M->data[i], (double)n);
+    }
+    
+    return P;
+  }
+  
+  // Other structures: dense power, packed again when the structure is kept
+  if(M->structure != MX_GENERAL)
+  {
+    U = matrix_unpack(M);
+    P = matrix_power(U, n);
+    Mx_Hdlr.del(U);
+    
+    if(P != NULL && M->structure != MX_BANDED)
+    {
+      U = matrix_pack(P, M->structure, 0, 0);
+      Mx_Hdlr.del(P);
+      P = U;
+    }
+    
+    return P;
+  }
+  P = Mx_Hdlr.init(d, d);
+  
+  if(P == NULL)
+  {
+    return NULL;
+  }
+  
+  ld = P->ld;
+  matrix_copy(M, FALSE, P->data, ld);
+  
+  // Diagonal (or identity) input: element powers of the diagonal
+  for(i = 0; i < d && diagonal; i++)
+  {
+    for(j = 0; j < d; j++)
+    {
+      if(i != j && P->data[i * ld + j] != 0)
+      {
+        diagonal = FALSE;
+        break;
+      }
+    }
+  }
+  
+  if(diagonal || n <= 1)
+  {
+    for(i = 0; i < d; i++)
+    {
+      if(n == 0)
+      {
+        memset(&P->data[i * ld], 0, d * sizeof(Data));
+        P->data[i * ld + i] = 1;
+      }
+      else
+      {
+        P->data[i * ld + i] = pow(P->data[i * ld + i], (double)n);
+      }
+    }
+    
+    return P;
+  }
+  
+  s1 = (Data*)aligned_alloc( MX_ALIGN, d * ld * sizeof(Data) );
+  s2 = (Data*)aligned_alloc( MX_ALIGN, d * ld * sizeof(Data) );
+  
+  if(s1 == NULL || s2 == NULL)
+  {
+    free(s1);
+    free(s2);
+    Mx_Hdlr.del(P);
+    
+    return NULL;
+  }
+  
+  // x: M^(2^k), r: product of the powers of the set bits seen so far, t:
+  // spare. The three pointers rotate among P->data, s1 and s2
+  memcpy(s1, P->data, d * ld * sizeof(Data));
+  r = P->data;
+  x = s1;
+  t = s2;
+  
+  while(n != 0 && ok)
+  {
+    if(n & 1)
+    {
+      if(first)
+      {
+        // r = x (not I * x)
+        memcpy(r, x, d * ld * sizeof(Data));
+        first = FALSE;
+      }
+      else
+      {
+        ok = matrix_gemm_core(d, d, d, 1, r, ld, FALSE, x, ld, FALSE, 0, t,
+                              ld);
+        w = r; r = t; t = w;
+      }
+    }
+    
+    n >>= 1;
+    
+    if(n != 0 && ok)
+    {
+      ok = matrix_gemm_core(d, d, d, 1, x, ld, FALSE, x, ld, FALSE, 0, t, ld);
+      w = x; x = t; t = w;
+    }
+  }
+  
+  // Result back into the buffer owned by P
+  if(r != P->data)
+  {
+    memcpy(P->data, r, d * ld * sizeof(Data));
+  }
+  
+  free(s1);
+  free(s2);
+  
+  if(!ok)
+  {
+    Mx_Hdlr.del(P);
+    P = NULL;
+  }
+  
+  return P;
+}
+
+/**
+@brief  Obtains the element-wise multiplication of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to product matrix
+@note If dimensions do not match, the function returns a NULL pointer
+*/
+Matrix matrix_element_product(Matrix M1, Matrix M2)
+{
+  return (M2 != NULL) ? matrix_ewise_new(MX_EW_PRODUCT, 0, M1, 0, M2) : NULL;
+}
+
+/**
+@brief  Element-wise multiplication into an existing matrix: R = M1 .* M2
+@param  R:  Pointer to result matrix (may be M1 or M2: in place)
+        M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if product was computed, FALSE if dimensions do not match
+*/
+uint8_t matrix_element_product_into(Matrix R, Matrix M1, Matrix M2)
+{
+  return (M2 != NULL) ? matrix_ewise(MX_EW_PRODUCT, R, 0, M1, 0, M2) : FALSE;
+}
+
+/**
+@brief  Obtains the element-wise division of two matrices
+@param  M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval Pointer to division matrix
+@note If dimensions do not match, the function returns a NULL pointer
+*/
+Matrix matrix_element_division(Matrix M1, Matrix M2)
+{
+  return (M2 != NULL) ? matrix_ewise_new(MX_EW_DIVISION, 0, M1, 0, M2) : NULL;
+}
+
+/**
+@brief  Element-wise division into an existing matrix: R = M1 ./ M2
+@param  R:  Pointer to result matrix (may be M1 or M2: in place)
+        M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if division was computed, FALSE if dimensions do not match
+*/
+uint8_t matrix_element_division_into(Matrix R, Matrix M1, Matrix M2)
+{
+  return (M2 != NULL) ? matrix_ewise(MX_EW_DIVISION, R, 0, M1, 0, M2) : 
+                        FALSE;
+}
+
+/**
+@brief  Obtains the element-wise power of a matrix
+@param  M: Pointer to matrix
+        n: Exponent
+@retval Pointer to power matrix
+*/
+Matrix matrix_element_power(Matrix M, double n)
+{
+  return matrix_ewise_new(MX_EW_POWER, n, M, 0, NULL);
+}
+
+/**
+@brief  Element-wise power into an existing matrix: R = M .^ n
+@param  R: Pointer to result matrix (may be M: in place)
+        M: Pointer to matrix
+        n: Exponent
+@retval TRUE if power was computed, FALSE if dimensions do not match
+*/
+uint8_t matrix_element_power_into(Matrix R, Matrix M, double n)
+{
+  return matrix_ewise(MX_EW_POWER, R, n, M, 0, NULL);
+}
+
+/**
+@brief  Gets inverse matrix of M if existing
+@param  M: Pointer to matrix
+@retval Pointer to inverse matrix 
+@note Returns NULL if inverse matrix is undefined
+*/
+Matrix matrix_inverse(Matrix M)
+{
+  Matrix I = NULL, X = NULL, R = NULL;
+  size_t i = 0;
+  
+  if(M == NULL || M->structure == MX_GENERAL)
+  {
+    return matrix_lu_inverse( matrix_factors(M) );
+  }
+  
+  // Diagonal: reciprocals of the stored values
+  if(M->structure == MX_DIAGONAL)
+  {
+    R = matrix_alloc_structured(M->rows, MX_DIAGONAL, 0, 0);
+    
+    for(i = 0; R != NULL && i < M->rows; i++)
+    {
+      if(M->data[i] == 0)
+      {
+        Mx_Hdlr.del(R);
+        
+        return NULL;
+      }
+      
+      R->data[i] = 1 / M->data[i];
+    }
+    
+    return R;
+  }
+  
+  // Specialized solve against I; triangular and symmetric inverses keep
+  // the structure, banded ones fill in
+  I = Mx_Hdlr.eye(M->rows);
+  X = (I != NULL) ? matrix_solve(M, I) : NULL;
+  Mx_Hdlr.del(I);
+  
+  if(X != NULL && M->structure != MX_BANDED)
+  {
+    R = matrix_pack(X, M->structure, 0, 0);
+    Mx_Hdlr.del(X);
+    X = R;
+  }
+  
+  return X;
+}
+
+/**
+@brief  Solves the linear system A X = B
+@param  A: Pointer to square matrix (n x n)
+        B: Pointer to right-hand sides (n x r)
+@retval Pointer to solution matrix X (n x r)
+@note   Returns NULL if dimensions do not match or A is singular
+*/
+Matrix matrix_solve(Matrix A, Matrix B)
+{
+  MatrixLU F = NULL;
+  Matrix X = NULL;
+  
+  if(A == NULL || B == NULL || A->rows != B->rows)
+  {
+    return NULL;
+  }
+  
+  if(A->structure != MX_GENERAL)
+  {
+    return matrix_solve_structured(A, B);
+  }
+  
+  F = matrix_factors(A);
+  X = Mx_Hdlr.init(B->rows, B->columns);
+  
+  if(F == NULL || X == NULL || !matrix_lu_solve(F, B, X))
+  {
+    Mx_Hdlr.del(X);
+    X = NULL;
+  }
+  
+  return X;
+}
+
+/**
+@brief  Transposes matrix M
+@param  M: Pointer to matrix
+@retval Pointer to transposed matrix
+*/
+Matrix matrix_transpose(Matrix M)
+{
+  Matrix T = NULL;
+  Data* p = NULL;
+  t_matrixStructure s = MX_GENERAL;
+  size_t i = 0, j = 0, lo = 0, hi = 0;
+  
+  if(M != NULL && M->structure != MX_GENERAL)
+  {
+    // Diagonal and symmetric: same storage; triangles swap, bands mirror
+    s = (M->structure == MX_UPPER) ? MX_LOWER :
+        (M->structure == MX_LOWER) ? MX_UPPER : M->structure;
+    T = matrix_alloc_structured(M->rows, s, M->ku, M->kl);
+    
+    for(i = 0; T != NULL && i < T->rows; i++)
+    {
+      p = matrix_row(T, i, &lo, &hi);
+      
+      for(j = lo; j < hi; j++)
+      {
+        p[j - lo] = matrix_at(M, j, i);
+      }
+    }
+  }
+  else if(M != NULL)
+  {
+    T = Mx_Hdlr.init(M->columns, M->rows);
+    
+    if(T != NULL)
+    {
+      matrix_copy(M, TRUE, T->data, T->ld);
+    }
+  }
+  
+  return T;
+}
+
+/**
+@brief  Transposes a square matrix in place
+@param  M: Pointer to square matrix
+@retval TRUE if matrix was transposed, FALSE if not square
+*/
+uint8_t matrix_transpose_inplace(Matrix M)
+{
+  Data* a = NULL;
+  size_t n = 0, ld = 0, bi = 0, bj = 0, ib = 0, jb = 0, i = 0;
+  
+  if(M == NULL || M->rows != M->columns)
+  {
+    return FALSE;
+  }
+  
+  // Packed storage: only structures equal to their transpose
+  if(M->structure != MX_GENERAL)
+  {
+    return (M->structure == MX_DIAGONAL || M->structure == MX_SYMMETRIC);
+  }
+  
+  a  = M->data;
+  ld = M->ld;
+  n  = M->rows;
+  
+  // Tile pairs (bi, bj) and (bj, bi) are swapped by the same thread
+  #pragma omp parallel for private(bj, ib, jb, i) schedule(dynamic) \
+                           if(n * n >= MX_PARALLEL_MIN)
+  for(bi = 0; bi < n; bi += MX_TR_LEAF)
+  {
+    Data tile[MX_TR_LEAF * MX_TR_LEAF];         // L1 buffer (ld MX_TR_LEAF)
+    
+    ib = (n - bi < MX_TR_LEAF) ? n - bi : MX_TR_LEAF;
+    
+    for(bj = bi; bj < n; bj += MX_TR_LEAF)
+    {
+      jb = (n - bj < MX_TR_LEAF) ? n - bj : MX_TR_LEAF;
+      
+      // tile = X^T, X = Y^T, Y = tile (X diagonal: X = tile)
+      matrix_transpose_leaf(&a[bi * ld + bj], ld, tile, MX_TR_LEAF, ib, jb);
+      
+      if(bj != bi)
+      {
+        matrix_transpose_leaf(&a[bj * ld + bi], ld, &a[bi * ld + bj], ld,
+                              jb, ib);
+      }
+      
+      for(i = 0; i < jb; i++)
+      {
+        memcpy(&a[(bj + i) * ld + bi], &tile[i * MX_TR_LEAF],
+               ib * sizeof(Data));
+      }
+    }
+  }
+  
+  matrix_touch(M);
+  
+  return TRUE;
+}
+
+/**
+@brief  Gets a transposed view of M (no element is copied)
+@param  M: Pointer to matrix
+@retval Pointer to view, NULL on memory error
+*/
+Matrix matrix_transpose_view(Matrix M)
+{
+  return (M != NULL) ? matrix_view(M, 0, 0, M->rows, M->columns, TRUE) :
+         NULL;
+}
+
+/**
+@brief  Gets a view of a block of M (no element is copied)
+@param  M:       Pointer to matrix (or view)
+        i, j:    First row and column of the block in M
+        rows:    Number of rows of the block
+        columns: Number of columns of the block
+        trans:   TRUE to view the block transposed (columns x rows)
+@retval Pointer to view, NULL on memory error, structured M or a block
+        outside M
+*/
+Matrix matrix_view(Matrix M, size_t i, size_t j, size_t rows,
+                   size_t columns, uint8_t trans)
+{
+  Matrix V = NULL;
+  
+  if(M == NULL || M->structure != MX_GENERAL)
+  {
+    return NULL;
+  }
+  
+  V = (Matrix)malloc( sizeof(t_matrix) );
+  
+  if(V != NULL && !matrix_view_into(V, M, i, j, rows, columns, trans))
+  {
+    free(V);
+    V = NULL;
+  }
+  
+  return V;
+}
+
+/**
+@brief  Sets up a view of a block of M in caller storage (no allocation)
+@param  V:       Pointer to matrix structure to fill (e.g. a local t_matrix)
+        M:       Pointer to matrix (or view)
+        i, j:    First row and column of the block in M
+        rows:    Number of rows of the block
+        columns: Number of columns of the block
+        trans:   TRUE to view the block transposed (columns x rows)
+@retval TRUE if view was set up, FALSE on structured M or a block outside M
 */
-uint8_t matrix_cofactor(Matrix M, uint8_t i, uint8_t j, double* cf)
+uint8_t matrix_view_into(Matrix V, Matrix M, size_t i, size_t j,
+                         size_t rows, size_t columns, uint8_t trans)
 {
+  Matrix B = NULL;                  // Owner of the storage
+  size_t o = 0;                     // Offset of the block in B
+  
+  if(V == NULL || M == NULL || M->structure != MX_GENERAL || rows == 0 ||
+     columns == 0 || i >= M->rows || j >= M->columns ||
+     rows > M->rows - i || columns > M->columns - j)
+  {
+    return FALSE;
+  }
+  
+  B = (M->base != NULL) ? M->base : M;
+  V->rows = trans ? columns : rows;
+  V->columns = trans ? rows : columns;
+  V->ld = M->ld;
+  V->structure = MX_GENERAL;
+  V->kl = 0;
+  V->ku = 0;
+  V->determinant = 0;
+  V->dirty = TRUE;
+  V->lu = NULL;
+  V->transposed = (M->transposed != trans);
+  V->base = B;
+  V->data = &M->data[matrix_index(M, i, j)];
+  V->release = NULL;
+  
+  // Row pointers of the owner serve views in its orientation that start
+  // at column 0
+  o = (size_t)(V->data - B->data);
+  V->matrix = (!V->transposed && o % B->ld == 0 && B->matrix != NULL) ?
+              &B->matrix[o / B->ld] : NULL;
+  
   return TRUE;
 }
 
@@ -415,19 +2527,188 @@ uint8_t matrix_cofactor(Matrix M, uint8_t i, uint8_t j, double* cf)
 @retval Pointer to minor 
 @note Returns NULL if minor is undefined
 */
-Matrix matrix_minor(Matrix M, uint8_t i, uint8_t j)
+Matrix matrix_minor(Matrix M, size_t i, size_t j)
+{
+  Matrix S = NULL;             // Submatrix
+  size_t r = 0, c = 0;         // Iterators
+  
+  if(M == NULL || M->rows < 2 || M->columns < 2 || i >= M->rows || 
+     j >= M->columns)
+  {
+    return NULL;
+  }
+  
+  S = Mx_Hdlr.init(M->rows - 1, M->columns - 1);
+  
+  if(S != NULL)
+  {
+    // Copies every row but i, skipping column j
+    for(r = 0; r < S->rows; r++)
+    {
+      for(c = 0; c < S->columns; c++)
+      {
+        S->data[r * S->ld + c] = 
+          matrix_at(M, r < i ? r : r + 1, c < j ? c : c + 1);
+      }
+    }
+  }
+  
+  return S;
+}
+
+/**
+@brief  Gets cofactor ij of matrix M if existing
+@param  M: Pointer to matrix
+        i: Row index
+        j: Column index
+        cof: Pointer to cofactor value
+@retval TRUE if cofactor exists, FALSE otherwise
+*/
+uint8_t matrix_cofactor(Matrix M, size_t i, size_t j, double* cf)
+{
+  Matrix S = NULL;
+  double d = 0;
+  
+  if(M == NULL || cf == NULL || M->rows != M->columns || i >= M->rows || 
+     j >= M->columns)
+  {
+    return FALSE;
+  }
+  
+  // Determinant of the empty minor
+  if(M->rows == 1)
+  {
+    *cf = 1;
+    
+    return TRUE;
+  }
+  
+  // (-1)^(i + j) det(minor ij), determinant by LU
+  S = matrix_minor(M, i, j);
+  
+  if(S == NULL || !matrix_getDeterminant(S, &d))
+  {
+    Mx_Hdlr.del(S);
+    
+    return FALSE;
+  }
+  
+  *cf = ((i + j) % 2 == 0) ? d : -d;
+  Mx_Hdlr.del(S);
+  
+  return TRUE;
+}
+
+/**
+@brief  Gets a matrix with vector D as main diagonal (n values stored)
+@param  D:         Main diagonal (NULL: zeros)
+        dimension: Matrix dimension (n x n)
+@retval Pointer to matrix, NULL on zero dimension or memory error
+*/
+Matrix matrix_diagonal(Vector D, size_t dimension)
+{
+  Matrix M = matrix_alloc_structured(dimension, MX_DIAGONAL, 0, 0);
+  
+  if(M != NULL && D != NULL)
+  {
+    memcpy(M->data, D, dimension * sizeof(Data));
+  }
+  
+  return M;
+}
+
+/**
+@brief  Creates a null banded matrix
+@param  n:  Dimension (n x n)
+        kl: Sub-diagonals (< n)
+        ku: Super-diagonals (< n)
+@retval Pointer to matrix, NULL on invalid dimensions or memory error
+*/
+Matrix matrix_banded(size_t n, size_t kl, size_t ku)
+{
+  return matrix_alloc_structured(n, MX_BANDED, kl, ku);
+}
+
+/**
+@brief  Creates a null triangular matrix (rows packed)
+@param  n:     Dimension (n x n)
+        upper: TRUE for upper, FALSE for lower triangular
+@retval Pointer to matrix, NULL on invalid dimensions or memory error
+*/
+Matrix matrix_triangular(size_t n, uint8_t upper)
+{
+  return matrix_alloc_structured(n, upper ? MX_UPPER : MX_LOWER, 0, 0);
+}
+
+/**
+@brief  Creates a null symmetric matrix (lower triangle packed)
+@param  n: Dimension (n x n)
+@retval Pointer to matrix, NULL on invalid dimensions or memory error
+*/
+Matrix matrix_symmetric(size_t n)
+{
+  return matrix_alloc_structured(n, MX_SYMMETRIC, 0, 0);
+}
+
+/**
+@brief  Copies the elements of M allowed by a structure into a new matrix
+@param  M:      Pointer to square matrix (any storage)
+        s:      Structure of the result
+        kl, ku: Sub- / super-diagonals (MX_BANDED only)
+@retval Pointer to new matrix, NULL if M is not square or kl, ku >= n
+*/
+Matrix matrix_pack(Matrix M, t_matrixStructure s, size_t kl, size_t ku)
 {
-  return NULL;
+  Matrix P = NULL;
+  Data* p = NULL;
+  size_t i = 0, j = 0, lo = 0, hi = 0;
+  
+  if(M == NULL || M->rows != M->columns)
+  {
+    return NULL;
+  }
+  
+  if(s == MX_GENERAL)
+  {
+    return matrix_unpack(M);
+  }
+  
+  P = matrix_alloc_structured(M->rows, s, kl, ku);
+  
+  // Stored slice of every row (symmetric: lower triangle)
+  for(i = 0; P != NULL && i < P->rows; i++)
+  {
+    p = matrix_row(P, i, &lo, &hi);
+    
+    for(j = lo; j < hi; j++)
+    {
+      p[j - lo] = matrix_at(M, i, j);
+    }
+  }
+  
+  return P;
 }
 
 /**
-@brief  Gets a matrix with vector V as main diagonal
-@param  D: Main diagonal
-@retval Pointer to matrix 
+@brief  Copies a matrix into dense row-major storage
+@param  M: Pointer to matrix (any storage, or transposed view)
+@retval Pointer to new general matrix
 */
-Matrix matrix_diagonal(Vector D)
+Matrix matrix_unpack(Matrix M)
 {
-  return NULL;
+  Matrix U = NULL;
+  
+  if(M != NULL)
+  {
+    U = Mx_Hdlr.init(M->rows, M->columns);
+    
+    if(U != NULL)
+    {
+      matrix_copy(M, FALSE, U->data, U->ld);
+    }
+  }
+  
+  return U;
 }
 
 /**
@@ -437,6 +2718,307 @@ Matrix matrix_diagonal(Vector D)
 */
 uint8_t matrix_delete(Matrix M)
 {
+  // Validates indicated matrix
+  if(M != NULL)
+  {
+    // Frees allocated memory (views own only their structure)
+    matrix_lu_delete(M->lu);
+    
+    if(M->base == NULL)
+    {
+      free(M->matrix);
+      
+      if(M->release != NULL)
+      {
+        M->release(M);
+      }
+      else
+      {
+        free(M->data);
+      }
+    }
+    
+    free(M);
+    
+    return TRUE;
+  }
+  
+  return FALSE;
+}
+
+/**
+@brief  Prints matrix on screen
+@param  M: Pointer to matrix
+@retval TRUE if matrix was printed with no error, FALSE otherwise
+*/
+uint8_t matrix_print(Matrix M)
+{
+  size_t i = 0, j = 0;         // Iterators
+  
+  if(M == NULL)
+  {
+    return FALSE;
+  }
+  
+  for(i = 0; i < M->rows; i++)
+  {
+    for(j = 0; j < M->columns; j++)
+    {
+      printf("%10.4f ", matrix_at(M, i, j));
+    }
+    
+    printf("\n");
+  }
+  
+  return TRUE;
+}
+
+
+/**
+@brief  Computes the LU factorization with partial pivoting P M = L U
+@param  M: Pointer to square matrix (not modified)
+@retval Pointer to factorization, NULL if M is not square or on memory error
+*/
+MatrixLU matrix_lu_create(Matrix M)
+{
+  MatrixLU F = NULL;
+  Data* a = NULL;
+  size_t n = 0, ld = 0, k0 = 0, k1 = 0, r = 0, q = 0, c = 0;
+  Data l = 0;
+  
+  if(M == NULL || M->rows != M->columns)
+  {
+    return NULL;
+  }
+  
+  n = M->rows;
+  F = (MatrixLU)malloc( sizeof(t_matrixLU) );
+  
+  if(F == NULL)
+  {
+    return NULL;
+  }
+  
+  F->n = n;
+  F->sign = 1;
+  F->singular = FALSE;
+  F->LU = Mx_Hdlr.init(n, n);
+  F->piv = (size_t*)malloc( n * sizeof(size_t) );
+  
+  if(F->LU == NULL || F->piv == NULL)
+  {
+    matrix_lu_delete(F);
+    
+    return NULL;
+  }
+  
+  a  = F->LU->data;
+  ld = F->LU->ld;
+  
+  // Same dimensions, same stride: one copy of the whole buffer (or a
+  // transpose for views)
+  matrix_copy(M, FALSE, a, ld);
+  
+  for(k0 = 0; k0 < n; k0 = k1)
+  {
+    k1 = (n - k0 < MX_LU_NB) ? n : k0 + MX_LU_NB;
+    
+    // L11, L21 and U11 of the panel
+    matrix_lu_panel(F, k0, k1);
+    
+    if(k1 == n)
+    {
+      break;
+    }
+    
+    // U12 = inv(L11) A12 (unit lower triangular, row-wise updates)
+    for(r = k0 + 1; r < k1; r++)
+    {
+      for(q = k0; q < r; q++)
+      {
+        l = a[r * ld + q];
+        
+        for(c = k1; c < n; c++)
+        {
+          a[r * ld + c] -= l * a[q * ld + c];
+        }
+      }
+    }
+    
+    // A22 -= L21 U12 (blocks of the same buffer that do not overlap)
+    if(!matrix_gemm_core(n - k1, n - k1, k1 - k0, -1, &a[k1 * ld + k0], ld,
+                         FALSE, &a[k0 * ld + k1], ld, FALSE, 1,
+                         &a[k1 * ld + k1], ld))
+    {
+      matrix_lu_delete(F);
+      
+      return NULL;
+    }
+  }
+  
+  return F;
+}
+
+/**
+@brief  Gets the determinant from an LU factorization
+@param  F: Pointer to factorization
+@retval Determinant (exactly 0 if singular), product of the pivots
+*/
+double matrix_lu_det(MatrixLU F)
+{
+  double d = 0;
+  size_t i = 0;
+  
+  if(F == NULL)
+  {
+    return 0;
+  }
+  
+  for(i = 0, d = F->sign; i < F->n; i++)
+  {
+    d *= F->LU->data[i * F->LU->ld + i];
+  }
+  
+  return d;
+}
+
+/**
+@brief  Solves A X = B using an LU factorization of A
+@param  F: Pointer to factorization
+        B: Pointer to right-hand sides (n x r)
+        X: Pointer to general solution (n x r), may be B itself (not a
+           transposed view)
+@retval TRUE if system was solved, FALSE if singular or dimensions differ
+*/
+uint8_t matrix_lu_solve(MatrixLU F, Matrix B, Matrix X)
+{
+  const Data* a = NULL;
+  Data* x = NULL;
+  size_t n = 0, ld = 0, lx = 0, m = 0;
+  size_t i = 0, k = 0, c = 0, cb = 0, ce = 0;
+  Data t = 0, l = 0;
+  
+  if(F == NULL || B == NULL || X == NULL || F->singular || B->rows != F->n ||
+     X->rows != B->rows || X->columns != B->columns || X->transposed ||
+     X->structure != MX_GENERAL || (matrix_overlap(X, B) &&
+     (X->data != B->data || B->transposed)))
+  {
+    return FALSE;
+  }
+  
+  n  = F->n;
+  m  = B->columns;
+  a  = F->LU->data;
+  ld = F->LU->ld;
+  x  = X->data;
+  lx = X->ld;
+  
+  if(X->data != B->data)
+  {
+    matrix_copy(B, FALSE, x, lx);
+  }
+  
+  matrix_touch(X);
+  
+  // Row interchanges P B
+  for(i = 0; i < n; i++)
+  {
+    if(F->piv[i] != i)
+    {
+      for(c = 0; c < m; c++)
+      {
+        t = x[i * lx + c];
+        x[i * lx + c] = x[F->piv[i] * lx + c];
+        x[F->piv[i] * lx + c] = t;
+      }
+    }
+  }
+  
+  // Column blocks of X are independent: forward (L) then backward (U) sweeps
+  // with row operations that run along contiguous columns
+  #pragma omp parallel for private(ce, i, k, c, l) schedule(dynamic) \
+                           if(n * n * m >= MX_PARALLEL_MIN)
+  for(cb = 0; cb < m; cb += MX_KC)
+  {
+    ce = (m - cb < MX_KC) ? m : cb + MX_KC;
+    
+    for(i = 1; i < n; i++)
+    {
+      for(k = 0; k < i; k++)
+      {
+        l = a[i * ld + k];
+        
+        for(c = cb; c < ce; c++)
+        {
+          x[i * lx + c] -= l * x[k * lx + c];
+        }
+      }
+    }
+    
+    for(i = n; i-- > 0; )
+    {
+      for(k = i + 1; k < n; k++)
+      {
+        l = a[i * ld + k];
+        
+        for(c = cb; c < ce; c++)
+        {
+          x[i * lx + c] -= l * x[k * lx + c];
+        }
+      }
+      
+      l = 1 / a[i * ld + i];
+      
+      for(c = cb; c < ce; c++)
+      {
+        x[i * lx + c] *= l;
+      }
+    }
+  }
+  
   return TRUE;
 }
 
+/**
+@brief  Gets the inverse matrix from an LU factorization
+@param  F: Pointer to factorization
+@retval Pointer to inverse matrix, NULL if singular
+*/
+Matrix matrix_lu_inverse(MatrixLU F)
+{
+  Matrix X = NULL;
+  
+  if(F == NULL || F->singular)
+  {
+    return NULL;
+  }
+  
+  X = Mx_Hdlr.eye(F->n);
+  
+  if(X != NULL && !matrix_lu_solve(F, X, X))
+  {
+    Mx_Hdlr.del(X);
+    X = NULL;
+  }
+  
+  return X;
+}
+
+/**
+@brief  Deletes an LU factorization and frees allocated memory
+@param  F: Pointer to factorization
+@retval TRUE if factorization was deleted with no error, FALSE otherwise
+*/
+uint8_t matrix_lu_delete(MatrixLU F)
+{
+  if(F != NULL)
+  {
+    Mx_Hdlr.del(F->LU);
+    free(F->piv);
+    free(F);
+    
+    return TRUE;
+  }
+  
+  return FALSE;
+}
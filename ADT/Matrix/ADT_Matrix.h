@@ -4,8 +4,8 @@
  * Filename      : ADT_Matrix.h
  * Description   : Abstract Data Type for matrices. Header file.
  * Version       : 01.00
- * Revision      : 02
- * Last modified : 01/24/2021
+ * Revision      : 13
+ * Last modified : 10/18/2026
  * -----------------------------------------------------------------------------
  */
 
@@ -19,6 +19,7 @@
 #include<stdint.h>
 #include<stdio.h>
 #include<stdlib.h>
+#include<string.h>
 #include<math.h>
 
 //----------------------------------------------------------------------------//
@@ -29,8 +30,52 @@
 #define TRUE      (uint8_t)(1)
 #define FALSE     (uint8_t)(0)
 
-// Max. dimension
-#define MAX_DIM (uint8_t)(100)
+// Storage alignment (bytes) and row padding (elements per cache line)
+#define MX_ALIGN (size_t)(64)
+#define MX_PAD   (size_t)(MX_ALIGN / sizeof(Data))
+
+// GEMM register tile (MX_MR x MX_NR) and cache blocks: MX_KC x MX_NR slivers
+// of B stay in L1, MX_MC x MX_KC blocks of A in L2, MX_KC x MX_NC panels of B
+// in L3
+#define MX_MR (size_t)(6)
+#define MX_NR (size_t)(8)
+#define MX_MC (size_t)(72)
+#define MX_KC (size_t)(256)
+#define MX_NC (size_t)(4080)
+
+// LU panel width (columns factored before each trailing GEMM update)
+#define MX_LU_NB (size_t)(64)
+
+// Transpose: register tiles (MX_TR_TILE x MX_TR_TILE), recursion leaf (both
+// blocks stay in L1) and row bands handed to each OpenMP thread
+#define MX_TR_TILE (size_t)(8)
+#define MX_TR_LEAF (size_t)(32)
+#define MX_TR_BAND (size_t)(256)
+
+// Largest |integer exponent| computed by repeated squaring in element powers,
+// and elements squared per pass (two stack buffers of this size)
+#define MX_EW_POW_INT (double)(64)
+#define MX_EW_CHUNK   (size_t)(256)
+
+// Packed elements per OpenMP chunk in element-wise operations on structured
+// matrices
+#define MX_EW_SPAN (size_t)(8192)
+
+// Min. multiply-adds to run matrix kernels with OpenMP threads
+#define MX_PARALLEL_MIN (size_t)(1 << 18)
+
+// Hot loops compiled once per ISA and picked at load time (GCC, x86-64 Linux):
+// AVX-512, AVX + FMA and baseline clones; the GEMM micro-kernel has one
+// build per ISA with its own register width. Elsewhere a single portable
+// build is used
+#if defined(__GNUC__) && !defined(__clang__) && defined(__x86_64__) && \
+    defined(__linux__) && !defined(MX_NO_CLONES)
+#define MX_KERNEL_DISPATCH
+#define MX_KERNEL_CLONES \
+  __attribute__((target_clones("avx512f", "fma", "default")))
+#else
+#define MX_KERNEL_CLONES
+#endif
 
 //----------------------------------------------------------------------------//
 //                            General definitions                             //
@@ -45,47 +90,132 @@ typedef Data* Vector;
 // 2-D Array definition
 typedef Vector* Array;
 
-// Matrix
+// Storage schemes. Structured matrices are square, keep only the elements
+// their structure allows (packed in data, n = rows) and have no row pointers
+typedef enum
+{
+  MX_GENERAL,    // Dense: (i, j) at data[i * ld + j]
+  MX_DIAGONAL,   // Diagonal: (i, i) at data[i]
+  MX_BANDED,     // kl sub- / ku super-diagonals: (i, j) at data[i * ld + j - i
+                 // + kl], ld = kl + ku + 1 (tridiagonal: kl = ku = 1)
+  MX_UPPER,      // Upper triangular, rows packed: (i, j >= i) at data[i * n -
+                 // i * (i - 1) / 2 + j - i]
+  MX_LOWER,      // Lower triangular, rows packed: (i, j <= i) at data[i * (i +
+                 // 1) / 2 + j]
+  MX_SYMMETRIC   // Symmetric: lower triangle packed as MX_LOWER
+}
+t_matrixStructure;
+
+// Matrix: element (i, j) is data[i * ld + j], also reachable as matrix[i][j].
+// Determinant and LU factors are cached until the elements change. Library
+// functions drop the cache themselves; raw writes through data or matrix (of
+// M or of any view of M) are not seen until matrix_touch is called on M or on
+// the view written through: until then det / inv / solve use the old factors.
+// A transposed view shares the storage of its base matrix: element (i, j) is
+// data[j * ld + i] and there are no row pointers (matrix is NULL).
+// Structured matrices are read and written through matrix_get / update
 typedef struct matrix_struct
 {
-  uint8_t rows;
-  uint8_t columns;
-  double* determinant;
-  Array matrix;
+  size_t  rows;          // Number of rows
+  size_t  columns;       // Number of columns
+  size_t  ld;            // Leading dimension (row stride, padded)
+  t_matrixStructure structure; // Storage scheme
+  size_t  kl;            // Banded: sub-diagonals
+  size_t  ku;            // Banded: super-diagonals
+  double  determinant;   // Cached determinant (valid if not dirty)
+  uint8_t dirty;         // TRUE if elements changed since the last factorization
+  struct matrix_lu* lu;  // Cached LU factors (NULL if not computed)
+  uint8_t transposed;    // TRUE if elements are stored column by column
+  struct matrix_struct* base; // Owner of data for views (NULL if M owns it)
+  Data*   data;          // Contiguous aligned storage (rows * ld); views:
+                         // first element, inside the storage of base.
+                         // Raw writes: call matrix_touch afterwards
+  Array   matrix;        // Row pointers into data (compatibility view,
+                         // NULL for views not starting at column 0).
+                         // Raw writes: call matrix_touch afterwards
+  void    (*release)(struct matrix_struct* M); // Frees data not obtained
+                                               // from malloc (NULL: free)
 }
 t_matrix;
 
 typedef t_matrix* Matrix;
 
+// LU factorization P A = L U (L unit lower and U upper, packed in one matrix)
+typedef struct matrix_lu
+{
+  size_t  n;          // Dimension
+  Matrix  LU;         // Packed factors
+  size_t* piv;        // Row interchanges: step i swapped rows i and piv[i]
+  int8_t  sign;       // Permutation sign (+1 / -1)
+  uint8_t singular;   // TRUE if a pivot column was exactly zero
+}
+t_matrixLU;
+
+typedef t_matrixLU* MatrixLU;
+
 // Matrix handler
 typedef struct matrix_handler
 {
-  Matrix  (*init)(uint8_t Rows, uint8_t Columns);            // Create Matrix
-  Matrix  (*eye)(uint8_t dimension);                         // Identity Matrix
-  Matrix  (*isNull)(Matrix M);                               // Null matrix?
-  uint8_t (*row)(Matrix M);                                  // Get #rows
-  uint8_t (*col)(Matrix M);                                  // Get #columns
+  Matrix  (*init)(size_t Rows, size_t Columns);              // Create Matrix
+  Matrix  (*eye)(size_t dimension);                          // Identity Matrix
+  uint8_t (*isNull)(Matrix M);                               // Null matrix?
+  size_t  (*row)(Matrix M);                                  // Get #rows
+  size_t  (*col)(Matrix M);                                  // Get #columns
+  uint8_t (*get)(Matrix M, size_t i, size_t j, Data* k);     // Get element
   uint8_t (*det)(Matrix M, double* detval);                  // Get determinant
-  uint8_t (*update)(Matrix M, Data k, uint8_t i, uint8_t j); // Update element
+  uint8_t (*update)(Matrix M, Data k, size_t i, size_t j);   // Update element
+  uint8_t (*touch)(Matrix M);                                // Mark modified
   uint8_t (*areEqual)(Matrix M1, Matrix M2);                 // M1 == M2?
   Matrix  (*sum)(Matrix M1, Matrix M2);                      // Matrix sum
+  uint8_t (*sumInto)(Matrix R, Matrix M1, Matrix M2);        // R = M1 + M2
   Matrix  (*scalar)(Data k, Matrix M);                       // Scalar product
+  uint8_t (*scalarInto)(Matrix R, Data k, Matrix M);         // R = k M
+  uint8_t (*axpby)(Matrix R, Data a, Matrix A, Data b, Matrix B); // R = aA + bB
   Matrix  (*product)(Matrix M1, Matrix M2);                  // Matrix product
-  Matrix  (*pow)(Matrix M, uint8_t n);                       // Matrix power
+  uint8_t (*gemm)(Data a, Matrix A, Matrix B, Data b, Matrix C); // C = aAB + bC
+  Matrix  (*pow)(Matrix M, uint64_t n);                      // Matrix power
   Matrix  (*eProduct)(Matrix M1, Matrix M2);                 // Element product
+  uint8_t (*eProductInto)(Matrix R, Matrix M1, Matrix M2);   // R = M1 .* M2
   Matrix  (*eDivision)(Matrix M1, Matrix M2);                // Element division
+  uint8_t (*eDivisionInto)(Matrix R, Matrix M1, Matrix M2);  // R = M1 ./ M2
   Matrix  (*ePow)(Matrix M, double n);                       // Element power
+  uint8_t (*ePowInto)(Matrix R, Matrix M, double n);         // R = M .^ n
   Matrix  (*inv)(Matrix M);                                  // Inverse matrix
+  Matrix  (*solve)(Matrix A, Matrix B);                      // X: A X = B
   Matrix  (*transp)(Matrix M);                               // Transpose
-  Matrix  (*minor)(Matrix M, uint8_t i, uint8_t j);          // Minor ij
-  uint8_t (*cof)(Matrix M, uint8_t i, uint8_t j, double* cf);// Cofactor ij
-  Matrix  (*diag)(Vector D)                                  // Diagonal matrix
+  uint8_t (*transpIP)(Matrix M);                             // Transpose in place
+  Matrix  (*transpView)(Matrix M);                           // Transposed view
+  Matrix  (*view)(Matrix M, size_t i, size_t j, size_t rows,  // Block view
+                  size_t columns, uint8_t trans);
+  uint8_t (*viewInto)(Matrix V, Matrix M, size_t i, size_t j, // Block view
+                      size_t rows, size_t columns, uint8_t trans); // in V
+  Matrix  (*minor)(Matrix M, size_t i, size_t j);            // Minor ij
+  uint8_t (*cof)(Matrix M, size_t i, size_t j, double* cf);  // Cofactor ij
+  Matrix  (*diag)(Vector D, size_t dimension);              // Diagonal matrix
+  Matrix  (*band)(size_t n, size_t kl, size_t ku);           // Banded matrix
+  Matrix  (*tri)(size_t n, uint8_t upper);                   // Triangular
+  Matrix  (*sym)(size_t n);                                  // Symmetric
+  Matrix  (*pack)(Matrix M, t_matrixStructure s, size_t kl, size_t ku); // Pack
+  Matrix  (*unpack)(Matrix M);                               // Dense copy
   uint8_t (*del)(Matrix M);                                  // Delete matrix
 }
 t_MatrixHandler;
 
 extern t_MatrixHandler Mx_Hdlr;
 
+// LU factorization handler
+typedef struct matrix_lu_handler
+{
+  MatrixLU (*init)(Matrix M);                                // Factorize
+  double   (*det)(MatrixLU F);                               // Determinant
+  uint8_t  (*solve)(MatrixLU F, Matrix B, Matrix X);         // A X = B
+  Matrix   (*inv)(MatrixLU F);                               // Inverse matrix
+  uint8_t  (*del)(MatrixLU F);                               // Delete factors
+}
+t_MatrixLUHandler;
+
+extern t_MatrixLUHandler MxLU_Hdlr;
+
 //----------------------------------------------------------------------------//
 //                              Public functions                              //
 //----------------------------------------------------------------------------//
@@ -95,15 +225,20 @@ extern t_MatrixHandler Mx_Hdlr;
 @param  rows: Number of rows
         columns: Number of columns
 @retval Pointer to new matrix
+@note   Elements live in one aligned buffer; rows are padded to whole cache
+        lines (stride ld) and M->matrix[i] points to row i inside it.
+        After writing through M->data or M->matrix once the determinant,
+        inverse or a solve was taken, call matrix_touch(M). Returns NULL on
+        zero dimensions or if the size overflows size_t
 */
-extern Matrix matrix_create(uint8_t rows, uint8_t columns);
+extern Matrix matrix_create(size_t rows, size_t columns);
 
 /**
 @brief  Allocates memory to create a new identity matrix.
 @param  dimension: Matrix dimension (n x n)
 @retval Pointer to new matrix
 */
-extern Matrix matrix_identity(uint8_t dimension);
+extern Matrix matrix_identity(size_t dimension);
 
 /**
 @brief  Verifies if matrix is null
@@ -117,20 +252,34 @@ extern uint8_t matrix_isNull(Matrix M);
 @param  M: Pointer to matrix
 @retval Number of rows
 */
-extern uint8_t matrix_getRows(Matrix M);
+extern size_t matrix_getRows(Matrix M);
 
 /**
 @brief  Gets number of columns of indicated matrix
 @param  M: Pointer to matrix
 @retval Number of columns
 */
-extern uint8_t matrix_getColumns(Matrix M);
+extern size_t matrix_getColumns(Matrix M);
+
+/**
+@brief  Gets an element of a matrix (any storage)
+@param  M: Pointer to matrix
+        i: Row index
+        j: Column index
+        k: Pointer to value (0 outside the structure)
+@retval TRUE if indices are valid, FALSE otherwise
+*/
+extern uint8_t matrix_get(Matrix M, size_t i, size_t j, Data* k);
 
 /**
 @brief  Gets determinant of matrix if defined
 @param  M: Pointer to matrix
         detval: Determinant value
 @retval TRUE if determinant exists, FALSE otherwise
+@note   Computed from an LU factorization, O(n^3), on the first call after a
+        modification; later calls return the cached value in O(1).
+        Diagonal and triangular: product of the diagonal, O(n); banded: band
+        LU, O(n kl (kl + ku))
 */
 extern uint8_t matrix_getDeterminant(Matrix M, double* detval);
 
@@ -140,9 +289,19 @@ extern uint8_t matrix_getDeterminant(Matrix M, double* detval);
         k: Data
         i: Row index
         j: Column index
-@retval TRUE if element was updated, FALSE otherwise
+@retval TRUE if element was updated, FALSE otherwise (out of range, or a
+        nonzero outside the structure; symmetric updates set (j, i) too)
+*/
+extern uint8_t matrix_update(Matrix M, Data k, size_t i, size_t j);
+
+/**
+@brief  Marks matrix as modified, dropping cached determinant and LU factors
+@param  M: Pointer to matrix
+@retval TRUE if matrix exists, FALSE otherwise
+@note   Needed only after writing elements through M->data or M->matrix;
+        every library function that modifies a matrix calls it
 */
-extern uint8_t matrix_update(Matrix M, Data k, uint8_t i, uint8_t j);
+extern uint8_t matrix_touch(Matrix M);
 
 /**
 @brief  Verifies if M1 and M2 are equal
@@ -161,31 +320,89 @@ extern uint8_t matrix_areEqual(Matrix M1, Matrix M2);
 */
 extern Matrix matrix_sum(Matrix M1, Matrix M2);
 
+/**
+@brief  Algebraic sum into an existing matrix: R = M1 + M2
+@param  R:  Pointer to result matrix (may be M1 or M2: in place)
+        M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if sum was computed, FALSE if dimensions do not match
+@note   No allocation: one streaming pass over the three matrices
+*/
+extern uint8_t matrix_sum_into(Matrix R, Matrix M1, Matrix M2);
+
 /**
 @brief  Obtains the multiplication of a matrix and a scalar factor
-@param  V: Pointer to matrix
-        k: Scalar factor
+@param  k: Scalar factor
+        M: Pointer to matrix
 @retval Pointer to scalated matrix
 */
 extern Matrix matrix_scalar(Data k, Matrix M);
 
+/**
+@brief  Scalar product into an existing matrix: R = k M
+@param  R: Pointer to result matrix (may be M: in place)
+        k: Scalar factor
+        M: Pointer to matrix
+@retval TRUE if product was computed, FALSE if dimensions do not match
+*/
+extern uint8_t matrix_scalar_into(Matrix R, Data k, Matrix M);
+
+/**
+@brief  Fused linear combination: R = a A + b B
+@param  R: Pointer to result matrix (may be A or B: in place)
+        a: Scale of A
+        A: Pointer to first matrix
+        b: Scale of B
+        B: Pointer to second matrix
+@retval TRUE if combination was computed, FALSE if dimensions do not match
+@note   One pass over memory instead of two scalings and a sum. As in every
+        element-wise operation, R may not be a transposed view of an operand.
+        Operands of one structure stream their packed storage when the
+        operation keeps zeros outside it (sums, scalings, products, positive
+        powers; anything for symmetric); a structured R must receive such a
+        result, other results are general
+*/
+extern uint8_t matrix_axpby(Matrix R, Data a, Matrix A, Data b, Matrix B);
+
 /**
 @brief  Obtains the algebraic multiplication of two matrices
 @param  M1: Pointer to first matrix
         M2: Pointer to second matrix
 @retval Pointer to product matrix
-@note If dimensions do not match, the function returns a NULL pointer
+@note If dimensions do not match, the function returns a NULL pointer.
+      Structured operands are multiplied over their stored rows only (O(n)
+      diagonal, O(n kl ku) banded); the result keeps the structure when it
+      is closed (diagonal with X: X, triangular, banded), else is general
 */
 extern Matrix matrix_product(Matrix M1, Matrix M2);
 
+/**
+@brief  General matrix product in place: C = alpha * A * B + beta * C
+@param  alpha: Scale of A * B
+        A:     Pointer to first matrix (m x k)
+        B:     Pointer to second matrix (k x n)
+        beta:  Scale of previous C (0: previous C is ignored, even NaN)
+        C:     Pointer to result matrix (m x n), storage disjoint from A, B
+@retval TRUE if product was computed, FALSE otherwise
+@note   Packed panels, cache blocking and a register-tiled micro-kernel;
+        row blocks run in parallel with OpenMP for large products. Any
+        operand may be a transposed view; it is read in place. Structured
+        A or B go through matrix_product; C must be general
+*/
+extern uint8_t matrix_gemm(Data alpha, Matrix A, Matrix B, Data beta, Matrix C);
+
 /**
 @brief  Obtains the algebraic integer power of a matrix
 @param  M: Pointer to matrix
-        n: Exponent
+        n: Exponent (M^0 = I)
 @retval Pointer to power matrix
-@note If dimensions do not match, the function returns a NULL pointer
+@note If dimensions do not match, the function returns a NULL pointer.
+      Binary exponentiation: at most 2 log2(n) products, computed by GEMM
+      into two scratch buffers. Diagonal matrices (identity included) take
+      O(dim) element powers instead. Triangular and symmetric powers are
+      packed again
 */
-extern Matrix matrix_power(Matrix M, uint8_t n);
+extern Matrix matrix_power(Matrix M, uint64_t n);
 
 /**
 @brief  Obtains the element-wise multiplication of two matrices
@@ -196,6 +413,15 @@ extern Matrix matrix_power(Matrix M, uint8_t n);
 */
 extern Matrix matrix_element_product(Matrix M1, Matrix M2);
 
+/**
+@brief  Element-wise multiplication into an existing matrix: R = M1 .* M2
+@param  R:  Pointer to result matrix (may be M1 or M2: in place)
+        M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if product was computed, FALSE if dimensions do not match
+*/
+extern uint8_t matrix_element_product_into(Matrix R, Matrix M1, Matrix M2);
+
 /**
 @brief  Obtains the element-wise division of two matrices
 @param  M1: Pointer to first matrix
@@ -205,29 +431,123 @@ extern Matrix matrix_element_product(Matrix M1, Matrix M2);
 */
 extern Matrix matrix_element_division(Matrix M1, Matrix M2);
 
+/**
+@brief  Element-wise division into an existing matrix: R = M1 ./ M2
+@param  R:  Pointer to result matrix (may be M1 or M2: in place)
+        M1: Pointer to first matrix
+        M2: Pointer to second matrix
+@retval TRUE if division was computed, FALSE if dimensions do not match
+@note   Zero divisors follow IEEE 754 (+-inf or NaN)
+*/
+extern uint8_t matrix_element_division_into(Matrix R, Matrix M1, Matrix M2);
+
 /**
 @brief  Obtains the element-wise power of a matrix
 @param  M: Pointer to matrix
         n: Exponent
 @retval Pointer to power matrix
+@note   Integer exponents up to MX_EW_POW_INT use vectorized repeated
+        squaring and n = 0.5 a square root; other exponents call pow
 */
 extern Matrix matrix_element_power(Matrix M, double n);
 
+/**
+@brief  Element-wise power into an existing matrix: R = M .^ n
+@param  R: Pointer to result matrix (may be M: in place)
+        M: Pointer to matrix
+        n: Exponent
+@retval TRUE if power was computed, FALSE if dimensions do not match
+*/
+extern uint8_t matrix_element_power_into(Matrix R, Matrix M, double n);
+
 /**
 @brief  Gets inverse matrix of M if existing
 @param  M: Pointer to matrix
 @retval Pointer to inverse matrix 
-@note Returns NULL if inverse matrix is undefined
+@note Returns NULL if inverse matrix is undefined. Diagonal, triangular and
+      symmetric inverses keep the structure; banded inverses are general
 */
 extern Matrix matrix_inverse(Matrix M);
 
+/**
+@brief  Solves the linear system A X = B
+@param  A: Pointer to square matrix (n x n)
+        B: Pointer to right-hand sides (n x r)
+@retval Pointer to solution matrix X (n x r)
+@note   Returns NULL if dimensions do not match or A is singular.
+        Diagonal and triangular A: substitution by rows; banded A: band LU
+        with partial pivoting, O(n kl (kl + ku)) per right-hand side
+*/
+extern Matrix matrix_solve(Matrix A, Matrix B);
+
 /**
 @brief  Transposes matrix M
 @param  M: Pointer to matrix
 @retval Pointer to transposed matrix
+@note   Cache-oblivious recursive blocking down to L1 tiles, which are
+        transposed in registers. Structured matrices keep their storage
+        (triangular: upper <-> lower, banded: kl <-> ku)
 */
 extern Matrix matrix_transpose(Matrix M);
 
+/**
+@brief  Transposes a square matrix in place
+@param  M: Pointer to square matrix
+@retval TRUE if matrix was transposed, FALSE if not square or packed
+        triangular / banded (diagonal and symmetric: nothing to do)
+@note   Tiles above the diagonal are swapped with their mirror tiles through
+        an L1-sized buffer; no second n x n matrix is allocated
+*/
+extern uint8_t matrix_transpose_inplace(Matrix M);
+
+/**
+@brief  Gets a transposed view of M (no element is copied)
+@param  M: Pointer to matrix
+@retval Pointer to view, NULL on memory error or structured M
+@note   The view shares storage with M: writes through either one are seen
+        by both. Raw writes through M->data / M->matrix need matrix_touch(M)
+        (views are refactorized on every call, so their caches never go
+        stale). matrix_product / matrix_gemm read it directly; delete the
+        view (with Mx_Hdlr.del) before M
+*/
+extern Matrix matrix_transpose_view(Matrix M);
+
+/**
+@brief  Gets a view of a block of M (no element is copied)
+@param  M:       Pointer to matrix (or view)
+        i, j:    First row and column of the block in M
+        rows:    Number of rows of the block
+        columns: Number of columns of the block
+        trans:   TRUE to view the block transposed (columns x rows)
+@retval Pointer to view, NULL on memory error, structured M or a block
+        outside M
+@note   The view keeps the row stride of M, so every operation accepts it
+        as a matrix. Writes through a view reach M; library writes drop its
+        cached determinant, raw writes through V->data / V->matrix need
+        matrix_touch(V), which touches M too. Operations writing a view
+        reject or copy operands whose storage overlaps it. Rows and columns are 1 x n and n x 1
+        views. Delete the view (with Mx_Hdlr.del) before M
+*/
+extern Matrix matrix_view(Matrix M, size_t i, size_t j, size_t rows,
+                          size_t columns, uint8_t trans);
+
+/**
+@brief  Sets up a view of a block of M in caller storage (no allocation)
+@param  V:       Pointer to matrix structure to fill (e.g. a local t_matrix)
+        M:       Pointer to matrix (or view)
+        i, j:    First row and column of the block in M
+        rows:    Number of rows of the block
+        columns: Number of columns of the block
+        trans:   TRUE to view the block transposed (columns x rows)
+@retval TRUE if view was set up, FALSE on structured M or a block outside M
+@note   As matrix_view, for block loops (raw writes through V need
+        matrix_touch(V) as well). V owns nothing and is not deleted; if its
+        determinant or inverse was taken, matrix_touch(V) frees the factors
+        cached in it
+*/
+extern uint8_t matrix_view_into(Matrix V, Matrix M, size_t i, size_t j,
+                                size_t rows, size_t columns, uint8_t trans);
+
 /**
 @brief  Gets minor ij of matrix M if existing
 @param  M: Pointer to matrix
@@ -236,7 +556,7 @@ extern Matrix matrix_transpose(Matrix M);
 @retval Pointer to minor 
 @note Returns NULL if minor is undefined
 */
-extern Matrix matrix_minor(Matrix M, uint8_t i, uint8_t j);
+extern Matrix matrix_minor(Matrix M, size_t i, size_t j);
 
 /**
 @brief  Gets cofactor ij of matrix M if existing
@@ -246,24 +566,57 @@ extern Matrix matrix_minor(Matrix M, uint8_t i, uint8_t j);
         cof: Pointer to cofactor value
 @retval TRUE if cofactor exists, FALSE otherwise
 */
-extern uint8_t matrix_cofactor(Matrix M, uint8_t i, uint8_t j, double* cf);
+extern uint8_t matrix_cofactor(Matrix M, size_t i, size_t j, double* cf);
 
 /**
-@brief  Gets minor ij of matrix M if existing
-@param  M: Pointer to matrix
-        i: Row index
-        j: Column index
-@retval Pointer to minor 
-@note Returns NULL if minor is undefined
+@brief  Gets a matrix with vector D as main diagonal (n values stored)
+@param  D:         Main diagonal (NULL: zeros)
+        dimension: Matrix dimension (n x n)
+@retval Pointer to matrix, NULL on zero dimension or memory error
+*/
+extern Matrix matrix_diagonal(Vector D, size_t dimension);
+
+/**
+@brief  Creates a null banded matrix
+@param  n:  Dimension (n x n)
+        kl: Sub-diagonals (< n)
+        ku: Super-diagonals (< n)
+@retval Pointer to matrix, NULL on invalid dimensions or memory error
+*/
+extern Matrix matrix_banded(size_t n, size_t kl, size_t ku);
+
+/**
+@brief  Creates a null triangular matrix (rows packed)
+@param  n:     Dimension (n x n)
+        upper: TRUE for upper, FALSE for lower triangular
+@retval Pointer to matrix, NULL on invalid dimensions or memory error
+*/
+extern Matrix matrix_triangular(size_t n, uint8_t upper);
+
+/**
+@brief  Creates a null symmetric matrix (lower triangle packed)
+@param  n: Dimension (n x n)
+@retval Pointer to matrix, NULL on invalid dimensions or memory error
 */
-extern Matrix matrix_minor(Matrix M, uint8_t i, uint8_t j);
+extern Matrix matrix_symmetric(size_t n);
 
 /**
-@brief  Gets a matrix with vector V as main diagonal
-@param  D: Main diagonal
-@retval Pointer to matrix 
+@brief  Copies the elements of M allowed by a structure into a new matrix
+@param  M:      Pointer to square matrix (any storage)
+        s:      Structure of the result
+        kl, ku: Sub- / super-diagonals (MX_BANDED only)
+@retval Pointer to new matrix, NULL if M is not square or kl, ku >= n
+@note   Elements outside the structure are dropped; MX_SYMMETRIC keeps the
+        lower triangle
 */
-extern Matrix matrix_diagonal(Vector D);
+extern Matrix matrix_pack(Matrix M, t_matrixStructure s, size_t kl, size_t ku);
+
+/**
+@brief  Copies a matrix into dense row-major storage
+@param  M: Pointer to matrix (any storage, or transposed view)
+@retval Pointer to new general matrix
+*/
+extern Matrix matrix_unpack(Matrix M);
 
 /**
 @brief  Deletes matrix and frees allocated memory
@@ -279,5 +632,50 @@ extern uint8_t matrix_delete(Matrix M);
 */
 extern uint8_t matrix_print(Matrix M);
 
+/**
+@brief  Computes the LU factorization with partial pivoting P M = L U
+@param  M: Pointer to square matrix (not modified)
+@retval Pointer to factorization, NULL if M is not square or on memory error
+@note   Blocked right-looking algorithm: MX_LU_NB-column panels are factored
+        and the trailing submatrix is updated with the GEMM kernel. A singular
+        matrix still yields a factorization with the singular flag set.
+        Singular means an exactly zero pivot column (the rule of the
+        structured solvers); nearly singular matrices are factored as they
+        are, so check the size of the pivots or the residual when
+        conditioning matters
+*/
+extern MatrixLU matrix_lu_create(Matrix M);
+
+/**
+@brief  Gets the determinant from an LU factorization
+@param  F: Pointer to factorization
+@retval Determinant (exactly 0 if singular), product of the pivots
+*/
+extern double matrix_lu_det(MatrixLU F);
+
+/**
+@brief  Solves A X = B using an LU factorization of A
+@param  F: Pointer to factorization
+        B: Pointer to right-hand sides (n x r)
+        X: Pointer to general solution (n x r), may be B itself (not a
+           transposed view)
+@retval TRUE if system was solved, FALSE if singular or dimensions differ
+*/
+extern uint8_t matrix_lu_solve(MatrixLU F, Matrix B, Matrix X);
+
+/**
+@brief  Gets the inverse matrix from an LU factorization
+@param  F: Pointer to factorization
+@retval Pointer to inverse matrix, NULL if singular
+*/
+extern Matrix matrix_lu_inverse(MatrixLU F);
+
+/**
+@brief  Deletes an LU factorization and frees allocated memory
+@param  F: Pointer to factorization
+@retval TRUE if factorization was deleted with no error, FALSE otherwise
+*/
+extern uint8_t matrix_lu_delete(MatrixLU F);
+
 #endif
 
@@ -0,0 +1,826 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixBatch.c
+ * Description   : Batches of small square matrices (structure of arrays).
+ *                 Library file.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_MatrixBatch.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Matrix batch handler
+t_MatrixBatchHandler MxB_Hdlr =
+{
+  matrix_batch_init,        // Create batch
+  matrix_batch_set,         // Store matrix
+  matrix_batch_get,         // Copy matrix
+  matrix_batch_product,     // Products
+  matrix_batch_inverse,     // Inverses
+  matrix_batch_det,         // Determinants
+  matrix_batch_del          // Delete batch
+};
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Products of one chunk of MXB_LANES matrices
+@param  n:  Dimension
+        s:  Plane stride of the operands
+        a:  Element (0, 0) of the first matrix of the chunk in A
+        b:  Element (0, 0) of the first matrix of the chunk in B
+        r:  Element (0, 0) of the first matrix of the chunk in the result
+        rs: Plane stride of the result
+@retval none
+@note   Every inner loop runs over the MXB_LANES matrices, so each SIMD lane
+        computes a different product
+*/
+MX_KERNEL_CLONES
+void matrix_batch_product_kernel(size_t n, size_t s, const Data* restrict a,
+                                 const Data* restrict b, Data* restrict r,
+                                 size_t rs)
+{
+  const Data* ak = NULL;
+  const Data* bk = NULL;
+  Data* c = NULL;
+  size_t i = 0, j = 0, k = 0, l = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    for(j = 0; j < n; j++)
+    {
+      c = &r[(i * n + j) * rs];
+      ak = &a[i * n * s];
+      bk = &b[j * s];
+
+      for(l = 0; l < MXB_LANES; l++)
+      {
+        c[l] = ak[l] * bk[l];
+      }
+
+      for(k = 1; k < n; k++)
+      {
+        ak = &a[(i * n + k) * s];
+        bk = &b[(k * n + j) * s];
+
+        for(l = 0; l < MXB_LANES; l++)
+        {
+          c[l] += ak[l] * bk[l];
+        }
+      }
+    }
+  }
+}
+
+/**
+@brief  Partial pivoting of column k in every lane: rows below k are swapped
+        with row k where their element is larger in magnitude, which leaves
+        the largest one on the diagonal
+@param  n:    Dimension
+        k:    Column
+        w:    Matrices being reduced (n * n planes of MXB_LANES)
+        x:    Matrices receiving the same swaps (NULL if none)
+        sign: Flipped per swap (NULL if not needed)
+        swap: Scratch (MXB_LANES)
+@retval none
+@note   Conditional moves instead of branches: lanes never diverge. Columns
+        before k are zero in rows k and below, so w is swapped from column k
+*/
+MX_KERNEL_CLONES
+void matrix_batch_pivot(size_t n, size_t k, Data* restrict w,
+                        Data* restrict x, Data* restrict sign,
+                        int64_t* restrict swap)
+{
+  Data* pk = NULL;
+  Data* pr = NULL;
+  Data t = 0;
+  size_t r = 0, j = 0, l = 0;
+
+  for(r = k + 1; r < n; r++)
+  {
+    pk = &w[(k * n + k) * MXB_LANES];
+    pr = &w[(r * n + k) * MXB_LANES];
+
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      swap[l] = fabs(pr[l]) > fabs(pk[l]);
+    }
+
+    for(j = k; j < n; j++)
+    {
+      pk = &w[(k * n + j) * MXB_LANES];
+      pr = &w[(r * n + j) * MXB_LANES];
+
+      for(l = 0; l < MXB_LANES; l++)
+      {
+        t = pk[l];
+        pk[l] = swap[l] ? pr[l] : t;
+        pr[l] = swap[l] ? t : pr[l];
+      }
+    }
+
+    for(j = 0; x != NULL && j < n; j++)
+    {
+      pk = &x[(k * n + j) * MXB_LANES];
+      pr = &x[(r * n + j) * MXB_LANES];
+
+      for(l = 0; l < MXB_LANES; l++)
+      {
+        t = pk[l];
+        pk[l] = swap[l] ? pr[l] : t;
+        pr[l] = swap[l] ? t : pr[l];
+      }
+    }
+
+    for(l = 0; sign != NULL && l < MXB_LANES; l++)
+    {
+      sign[l] = swap[l] ? -sign[l] : sign[l];
+    }
+  }
+}
+
+/**
+@brief  Inverses of one chunk of MXB_LANES matrices (Gauss-Jordan)
+@param  n:     Dimension
+        s:     Plane stride of the batches
+        a:     Element (0, 0) of the first matrix of the chunk in A
+        r:     Element (0, 0) of the first matrix of the chunk in R (may be a)
+        valid: Matrices of the chunk inside the batch (the rest is padding)
+        w:     Scratch (2 n^2 + 3 planes of MXB_LANES)
+@retval Number of singular matrices among the valid ones
+*/
+MX_KERNEL_CLONES
+size_t matrix_batch_inverse_kernel(size_t n, size_t s, const Data* a, Data* r,
+                                   size_t valid, Data* w)
+{
+  Data* x = &w[n * n * MXB_LANES];            // Right-hand side: I -> inv(A)
+  Data* piv = &x[n * n * MXB_LANES];          // Pivot reciprocals
+  Data* f = &piv[MXB_LANES];                  // Row factors
+  int64_t* bad = (int64_t*)&f[MXB_LANES];     // Singular lanes (pivot 0)
+  Data* wk = NULL;
+  Data* xk = NULL;
+  Data* wi = NULL;
+  Data* xi = NULL;
+  size_t i = 0, j = 0, k = 0, l = 0, singular = 0;
+
+  for(i = 0; i < n * n; i++)
+  {
+    memcpy(&w[i * MXB_LANES], &a[i * s], MXB_LANES * sizeof(Data));
+  }
+
+  memset(x, 0, n * n * MXB_LANES * sizeof(Data));
+  memset(bad, 0, MXB_LANES * sizeof(int64_t));
+
+  for(i = 0; i < n; i++)
+  {
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      x[(i * n + i) * MXB_LANES + l] = 1;
+    }
+  }
+
+  for(k = 0; k < n; k++)
+  {
+    matrix_batch_pivot(n, k, w, x, NULL, (int64_t*)f);
+
+    // Row k scaled by its pivot (1 in singular lanes, results discarded)
+    wk = &w[(k * n + k) * MXB_LANES];
+
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      bad[l] |= (wk[l] == 0);
+      piv[l] = 1 / ((wk[l] == 0) ? 1 : wk[l]);
+    }
+
+    for(j = k; j < n; j++)
+    {
+      wk = &w[(k * n + j) * MXB_LANES];
+
+      for(l = 0; l < MXB_LANES; l++)
+      {
+        wk[l] *= piv[l];
+      }
+    }
+
+    for(j = 0; j < n; j++)
+    {
+      xk = &x[(k * n + j) * MXB_LANES];
+
+      for(l = 0; l < MXB_LANES; l++)
+      {
+        xk[l] *= piv[l];
+      }
+    }
+
+    // Column k cleared in every other row
+    for(i = 0; i < n; i++)
+    {
+      if(i == k)
+      {
+        continue;
+      }
+
+      memcpy(f, &w[(i * n + k) * MXB_LANES], MXB_LANES * sizeof(Data));
+
+      for(j = k; j < n; j++)
+      {
+        wk = &w[(k * n + j) * MXB_LANES];
+        wi = &w[(i * n + j) * MXB_LANES];
+
+        for(l = 0; l < MXB_LANES; l++)
+        {
+          wi[l] -= f[l] * wk[l];
+        }
+      }
+
+      for(j = 0; j < n; j++)
+      {
+        xk = &x[(k * n + j) * MXB_LANES];
+        xi = &x[(i * n + j) * MXB_LANES];
+
+        for(l = 0; l < MXB_LANES; l++)
+        {
+          xi[l] -= f[l] * xk[l];
+        }
+      }
+    }
+  }
+
+  // Write-back: singular lanes are zero
+  for(i = 0; i < n * n; i++)
+  {
+    xi = &x[i * MXB_LANES];
+
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      r[i * s + l] = bad[l] ? 0 : xi[l];
+    }
+  }
+
+  for(l = 0; l < valid; l++)
+  {
+    singular += (bad[l] != 0);
+  }
+
+  return singular;
+}
+
+/**
+@brief  Determinants of one chunk of MXB_LANES matrices (Gaussian
+        elimination)
+@param  n:     Dimension
+        s:     Plane stride of the batch
+        a:     Element (0, 0) of the first matrix of the chunk
+        d:     Returns the determinants of the valid matrices
+        valid: Matrices of the chunk inside the batch (the rest is padding)
+        w:     Scratch (n^2 + 3 planes of MXB_LANES)
+@retval none
+*/
+MX_KERNEL_CLONES
+void matrix_batch_det_kernel(size_t n, size_t s, const Data* a, Data* d,
+                             size_t valid, Data* w)
+{
+  Data* det = &w[n * n * MXB_LANES];          // Running determinants
+  Data* piv = &det[MXB_LANES];                // Pivot reciprocals
+  Data* f = &piv[MXB_LANES];                  // Row factors
+  Data* wk = NULL;
+  Data* wi = NULL;
+  size_t i = 0, j = 0, k = 0, l = 0;
+
+  for(i = 0; i < n * n; i++)
+  {
+    memcpy(&w[i * MXB_LANES], &a[i * s], MXB_LANES * sizeof(Data));
+  }
+
+  for(l = 0; l < MXB_LANES; l++)
+  {
+    det[l] = 1;
+  }
+
+  for(k = 0; k < n; k++)
+  {
+    matrix_batch_pivot(n, k, w, NULL, det, (int64_t*)f);
+
+    // A zero pivot zeroes the determinant; its lane eliminates nothing
+    wk = &w[(k * n + k) * MXB_LANES];
+
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      det[l] *= wk[l];
+      piv[l] = (wk[l] == 0) ? 0 : 1 / wk[l];
+    }
+
+    for(i = k + 1; i < n; i++)
+    {
+      wi = &w[(i * n + k) * MXB_LANES];
+
+      for(l = 0; l < MXB_LANES; l++)
+      {
+        f[l] = wi[l] * piv[l];
+      }
+
+      for(j = k + 1; j < n; j++)
+      {
+        wk = &w[(k * n + j) * MXB_LANES];
+        wi = &w[(i * n + j) * MXB_LANES];
+
+        for(l = 0; l < MXB_LANES; l++)
+        {
+          wi[l] -= f[l] * wk[l];
+        }
+      }
+    }
+  }
+
+  memcpy(d, det, valid * sizeof(Data));
+}
+
+/**
+@brief  Inverses of one chunk of 2 x 2, 3 x 3 or 4 x 4 matrices (adjugate
+        over determinant)
+@param  n:     Dimension (2 to 4)
+        s:     Plane stride of the batches
+        a:     Element (0, 0) of the first matrix of the chunk in A
+        r:     Element (0, 0) of the first matrix of the chunk in R (may be a)
+        valid: Matrices of the chunk inside the batch (the rest is padding)
+@retval Number of singular matrices among the valid ones
+@note   One straight-line body per lane: the loop over lanes is the only
+        loop, so it vectorizes whole. Each lane reads its elements before
+        writing them (ivdep), which keeps R = A vectorized too
+*/
+MX_KERNEL_CLONES
+size_t matrix_batch_inverse_closed(size_t n, size_t s, const Data* a, Data* r,
+                                   size_t valid)
+{
+  Data c0 = 0, c1 = 0, c2 = 0, c3 = 0, c4 = 0, c5 = 0;
+  Data s0 = 0, s1 = 0, s2 = 0, s3 = 0, s4 = 0, s5 = 0, d = 0, q = 0;
+  Data a00 = 0, a01 = 0, a02 = 0, a03 = 0, a10 = 0, a11 = 0, a12 = 0;
+  Data a13 = 0, a20 = 0, a21 = 0, a22 = 0, a23 = 0, a30 = 0, a31 = 0;
+  Data a32 = 0, a33 = 0;
+  size_t l = 0, singular = 0;
+
+  if(n == 2)
+  {
+    #pragma GCC ivdep
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      a00 = a[l];         a01 = a[s + l];
+      a10 = a[2 * s + l]; a11 = a[3 * s + l];
+      d = a00 * a11 - a01 * a10;
+      q = (d != 0) / (d + (d == 0));       // 1 / d, 0 if singular
+      singular += (d == 0) & (l < valid);
+
+      r[l]         =  a11 * q;
+      r[s + l]     = -a01 * q;
+      r[2 * s + l] = -a10 * q;
+      r[3 * s + l] =  a00 * q;
+    }
+  }
+  else if(n == 3)
+  {
+    #pragma GCC ivdep
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      a00 = a[l];         a01 = a[s + l];     a02 = a[2 * s + l];
+      a10 = a[3 * s + l]; a11 = a[4 * s + l]; a12 = a[5 * s + l];
+      a20 = a[6 * s + l]; a21 = a[7 * s + l]; a22 = a[8 * s + l];
+      c0 = a11 * a22 - a12 * a21;
+      c1 = a12 * a20 - a10 * a22;
+      c2 = a10 * a21 - a11 * a20;
+      d = a00 * c0 + a01 * c1 + a02 * c2;
+      q = (d != 0) / (d + (d == 0));       // 1 / d, 0 if singular
+      singular += (d == 0) & (l < valid);
+
+      r[l]         = c0 * q;
+      r[s + l]     = (a02 * a21 - a01 * a22) * q;
+      r[2 * s + l] = (a01 * a12 - a02 * a11) * q;
+      r[3 * s + l] = c1 * q;
+      r[4 * s + l] = (a00 * a22 - a02 * a20) * q;
+      r[5 * s + l] = (a02 * a10 - a00 * a12) * q;
+      r[6 * s + l] = c2 * q;
+      r[7 * s + l] = (a01 * a20 - a00 * a21) * q;
+      r[8 * s + l] = (a00 * a11 - a01 * a10) * q;
+    }
+  }
+  else
+  {
+    // 2 x 2 minors s of rows 0-1 and c of rows 2-3 (Laplace expansion)
+    #pragma GCC ivdep
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      a00 = a[l];          a01 = a[s + l];
+      a02 = a[2 * s + l];  a03 = a[3 * s + l];
+      a10 = a[4 * s + l];  a11 = a[5 * s + l];
+      a12 = a[6 * s + l];  a13 = a[7 * s + l];
+      a20 = a[8 * s + l];  a21 = a[9 * s + l];
+      a22 = a[10 * s + l]; a23 = a[11 * s + l];
+      a30 = a[12 * s + l]; a31 = a[13 * s + l];
+      a32 = a[14 * s + l]; a33 = a[15 * s + l];
+      s0 = a00 * a11 - a10 * a01;  c5 = a22 * a33 - a32 * a23;
+      s1 = a00 * a12 - a10 * a02;  c4 = a21 * a33 - a31 * a23;
+      s2 = a00 * a13 - a10 * a03;  c3 = a21 * a32 - a31 * a22;
+      s3 = a01 * a12 - a11 * a02;  c2 = a20 * a33 - a30 * a23;
+      s4 = a01 * a13 - a11 * a03;  c1 = a20 * a32 - a30 * a22;
+      s5 = a02 * a13 - a12 * a03;  c0 = a20 * a31 - a30 * a21;
+      d = s0 * c5 - s1 * c4 + s2 * c3 + s3 * c2 - s4 * c1 + s5 * c0;
+      q = (d != 0) / (d + (d == 0));       // 1 / d, 0 if singular
+      singular += (d == 0) & (l < valid);
+
+      r[l]          = ( a11 * c5 - a12 * c4 + a13 * c3) * q;
+      r[s + l]      = (-a01 * c5 + a02 * c4 - a03 * c3) * q;
+      r[2 * s + l]  = ( a31 * s5 - a32 * s4 + a33 * s3) * q;
+      r[3 * s + l]  = (-a21 * s5 + a22 * s4 - a23 * s3) * q;
+      r[4 * s + l]  = (-a10 * c5 + a12 * c2 - a13 * c1) * q;
+      r[5 * s + l]  = ( a00 * c5 - a02 * c2 + a03 * c1) * q;
+      r[6 * s + l]  = (-a30 * s5 + a32 * s2 - a33 * s1) * q;
+      r[7 * s + l]  = ( a20 * s5 - a22 * s2 + a23 * s1) * q;
+      r[8 * s + l]  = ( a10 * c4 - a11 * c2 + a13 * c0) * q;
+      r[9 * s + l]  = (-a00 * c4 + a01 * c2 - a03 * c0) * q;
+      r[10 * s + l] = ( a30 * s4 - a31 * s2 + a33 * s0) * q;
+      r[11 * s + l] = (-a20 * s4 + a21 * s2 - a23 * s0) * q;
+      r[12 * s + l] = (-a10 * c3 + a11 * c1 - a12 * c0) * q;
+      r[13 * s + l] = ( a00 * c3 - a01 * c1 + a02 * c0) * q;
+      r[14 * s + l] = (-a30 * s3 + a31 * s1 - a32 * s0) * q;
+      r[15 * s + l] = ( a20 * s3 - a21 * s1 + a22 * s0) * q;
+    }
+  }
+
+  return singular;
+}
+
+/**
+@brief  Determinants of one chunk of 2 x 2, 3 x 3 or 4 x 4 matrices (closed
+        form, as in matrix_batch_inverse_closed)
+@param  n:     Dimension (2 to 4)
+        s:     Plane stride of the batch
+        a:     Element (0, 0) of the first matrix of the chunk
+        d:     Returns the determinants of the valid matrices
+        valid: Matrices of the chunk inside the batch (the rest is padding)
+@retval none
+*/
+MX_KERNEL_CLONES
+void matrix_batch_det_closed(size_t n, size_t s, const Data* restrict a,
+                             Data* restrict d, size_t valid)
+{
+  Data det[MXB_LANES];
+  size_t l = 0;
+
+  if(n == 2)
+  {
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      det[l] = a[l] * a[3 * s + l] - a[s + l] * a[2 * s + l];
+    }
+  }
+  else if(n == 3)
+  {
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      det[l] = a[l] * (a[4 * s + l] * a[8 * s + l] -
+                       a[5 * s + l] * a[7 * s + l]) +
+               a[s + l] * (a[5 * s + l] * a[6 * s + l] -
+                           a[3 * s + l] * a[8 * s + l]) +
+               a[2 * s + l] * (a[3 * s + l] * a[7 * s + l] -
+                               a[4 * s + l] * a[6 * s + l]);
+    }
+  }
+  else
+  {
+    for(l = 0; l < MXB_LANES; l++)
+    {
+      det[l] = (a[l] * a[5 * s + l] - a[4 * s + l] * a[s + l]) *
+               (a[10 * s + l] * a[15 * s + l] - a[14 * s + l] * a[11 * s + l])
+             - (a[l] * a[6 * s + l] - a[4 * s + l] * a[2 * s + l]) *
+               (a[9 * s + l] * a[15 * s + l] - a[13 * s + l] * a[11 * s + l])
+             + (a[l] * a[7 * s + l] - a[4 * s + l] * a[3 * s + l]) *
+               (a[9 * s + l] * a[14 * s + l] - a[13 * s + l] * a[10 * s + l])
+             + (a[s + l] * a[6 * s + l] - a[5 * s + l] * a[2 * s + l]) *
+               (a[8 * s + l] * a[15 * s + l] - a[12 * s + l] * a[11 * s + l])
+             - (a[s + l] * a[7 * s + l] - a[5 * s + l] * a[3 * s + l]) *
+               (a[8 * s + l] * a[14 * s + l] - a[12 * s + l] * a[10 * s + l])
+             + (a[2 * s + l] * a[7 * s + l] - a[6 * s + l] * a[3 * s + l]) *
+               (a[8 * s + l] * a[13 * s + l] - a[12 * s + l] * a[9 * s + l]);
+    }
+  }
+
+  memcpy(d, det, valid * sizeof(Data));
+}
+
+/**
+@brief  Checks that batches hold the same number of matrices of one size
+@param  A, B: Pointers to batches
+@retval TRUE if both are valid and match, FALSE otherwise
+*/
+uint8_t matrix_batch_match(MatrixBatch A, MatrixBatch B)
+{
+  return A != NULL && B != NULL && A->n == B->n && A->count == B->count;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates a batch of zero matrices
+@param  n:     Dimension of every matrix (n x n)
+        count: Number of matrices
+@retval Pointer to new batch, NULL if a size is zero or on memory error
+*/
+MatrixBatch matrix_batch_init(size_t n, size_t count)
+{
+  MatrixBatch B = NULL;
+
+  if(n == 0 || count == 0)
+  {
+    return NULL;
+  }
+
+  B = (MatrixBatch)malloc( sizeof(t_matrixBatch) );
+
+  if(B == NULL)
+  {
+    return NULL;
+  }
+
+  B->n = n;
+  B->count = count;
+  B->stride = (count + MXB_LANES - 1) / MXB_LANES * MXB_LANES;
+  B->data = (Data*)aligned_alloc( MX_ALIGN,
+                                  n * n * B->stride * sizeof(Data) );
+
+  if(B->data == NULL)
+  {
+    free(B);
+
+    return NULL;
+  }
+
+  memset(B->data, 0, n * n * B->stride * sizeof(Data));
+
+  return B;
+}
+
+/**
+@brief  Copies a matrix into the batch
+@param  B: Pointer to batch
+        t: Index of the matrix in the batch
+        M: Pointer to n x n matrix (any storage, or view)
+@retval TRUE if matrix was stored, FALSE if t or dimensions do not match
+*/
+uint8_t matrix_batch_set(MatrixBatch B, size_t t, Matrix M)
+{
+  size_t i = 0, j = 0;
+
+  if(B == NULL || M == NULL || t >= B->count || M->rows != B->n ||
+     M->columns != B->n)
+  {
+    return FALSE;
+  }
+
+  for(i = 0; i < B->n; i++)
+  {
+    for(j = 0; j < B->n; j++)
+    {
+      Mx_Hdlr.get(M, i, j, &B->data[(i * B->n + j) * B->stride + t]);
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Copies a matrix out of the batch
+@param  B: Pointer to batch
+        t: Index of the matrix in the batch
+@retval Pointer to new n x n matrix, NULL if t does not match or on memory
+        error
+*/
+Matrix matrix_batch_get(MatrixBatch B, size_t t)
+{
+  Matrix M = NULL;
+  size_t i = 0, j = 0;
+
+  if(B == NULL || t >= B->count)
+  {
+    return NULL;
+  }
+
+  M = Mx_Hdlr.init(B->n, B->n);
+
+  for(i = 0; M != NULL && i < B->n; i++)
+  {
+    for(j = 0; j < B->n; j++)
+    {
+      M->data[i * M->ld + j] = B->data[(i * B->n + j) * B->stride + t];
+    }
+  }
+
+  return M;
+}
+
+/**
+@brief  Products of matching matrices: R[t] = A[t] B[t]
+@param  R:    Pointer to result batch (may be A or B)
+        A, B: Pointers to operand batches
+@retval TRUE if products were computed, FALSE if sizes do not match or on
+        memory error
+@note   Each kernel call multiplies MXB_LANES matrices, one per SIMD lane.
+        Chunks are shared among OpenMP threads
+*/
+uint8_t matrix_batch_product(MatrixBatch R, MatrixBatch A, MatrixBatch B)
+{
+  uint8_t ok = TRUE, alias = FALSE;
+  size_t n = 0, s = 0;
+
+  if(!matrix_batch_match(A, B) || !matrix_batch_match(R, A))
+  {
+    return FALSE;
+  }
+
+  n = A->n;
+  s = A->stride;
+  alias = (R == A || R == B);
+
+  // Written in place, results go through per-thread scratch
+  #pragma omp parallel reduction(&&:ok) \
+                       if(A->count * n * n * n >= MX_PARALLEL_MIN)
+  {
+    Data* w = alias ? (Data*)aligned_alloc( MX_ALIGN, n * n * MXB_LANES *
+                                                      sizeof(Data) ) : NULL;
+    size_t c = 0, i = 0;
+
+    ok = !alias || w != NULL;
+
+    #pragma omp for schedule(static)
+    for(c = 0; c < s; c += MXB_LANES)
+    {
+      if(!alias)
+      {
+        matrix_batch_product_kernel(n, s, &A->data[c], &B->data[c],
+                                    &R->data[c], s);
+      }
+      else if(w != NULL)
+      {
+        matrix_batch_product_kernel(n, s, &A->data[c], &B->data[c], w,
+                                    MXB_LANES);
+
+        for(i = 0; i < n * n; i++)
+        {
+          memcpy(&R->data[i * s + c], &w[i * MXB_LANES],
+                 MXB_LANES * sizeof(Data));
+        }
+      }
+    }
+
+    free(w);
+  }
+
+  return ok;
+}
+
+/**
+@brief  Inverses: R[t] = inv(A[t])
+@param  R:        Pointer to result batch (may be A)
+        A:        Pointer to operand batch
+        singular: Returns the number of singular matrices (may be NULL)
+@retval TRUE if inverses were computed, FALSE if sizes do not match or on
+        memory error
+@note   Adjugate over determinant up to 4 x 4. Larger matrices use
+        Gauss-Jordan elimination with partial pivoting: each lane picks its
+        own pivot row by conditional swaps, so lanes never branch apart.
+        The inverse of a singular matrix is set to zero
+*/
+uint8_t matrix_batch_inverse(MatrixBatch R, MatrixBatch A, size_t* singular)
+{
+  uint8_t ok = TRUE, closed = FALSE;
+  size_t n = 0, s = 0, bad = 0;
+
+  if(!matrix_batch_match(R, A))
+  {
+    return FALSE;
+  }
+
+  n = A->n;
+  s = A->stride;
+  closed = (n >= 2 && n <= 4);
+
+  #pragma omp parallel reduction(&&:ok) reduction(+:bad) \
+                       if(A->count * n * n * n >= MX_PARALLEL_MIN)
+  {
+    Data* w = closed ? NULL : (Data*)aligned_alloc( MX_ALIGN,
+                              (2 * n * n + 3) * MXB_LANES * sizeof(Data) );
+    size_t c = 0, valid = 0;
+
+    ok = closed || w != NULL;
+
+    #pragma omp for schedule(static)
+    for(c = 0; c < s; c += MXB_LANES)
+    {
+      valid = (A->count - c < MXB_LANES) ? A->count - c : MXB_LANES;
+
+      if(closed)
+      {
+        bad += matrix_batch_inverse_closed(n, s, &A->data[c], &R->data[c],
+                                           valid);
+      }
+      else if(w != NULL)
+      {
+        bad += matrix_batch_inverse_kernel(n, s, &A->data[c], &R->data[c],
+                                           valid, w);
+      }
+    }
+
+    free(w);
+  }
+
+  if(singular != NULL)
+  {
+    *singular = bad;
+  }
+
+  return ok;
+}
+
+/**
+@brief  Determinants: d[t] = det(A[t])
+@param  A: Pointer to batch
+        d: Returns count determinants
+@retval TRUE if determinants were computed, FALSE on invalid arguments or
+        memory error
+@note   Closed form up to 4 x 4, Gaussian elimination with partial pivoting
+        above (pivots chosen as in matrix_batch_inverse)
+*/
+uint8_t matrix_batch_det(MatrixBatch A, Vector d)
+{
+  uint8_t ok = TRUE, closed = FALSE;
+  size_t n = 0, s = 0;
+
+  if(A == NULL || d == NULL)
+  {
+    return FALSE;
+  }
+
+  n = A->n;
+  s = A->stride;
+  closed = (n >= 2 && n <= 4);
+
+  #pragma omp parallel reduction(&&:ok) \
+                       if(A->count * n * n * n >= MX_PARALLEL_MIN)
+  {
+    Data* w = closed ? NULL : (Data*)aligned_alloc( MX_ALIGN,
+                              (n * n + 3) * MXB_LANES * sizeof(Data) );
+    size_t c = 0, valid = 0;
+
+    ok = closed || w != NULL;
+
+    #pragma omp for schedule(static)
+    for(c = 0; c < s; c += MXB_LANES)
+    {
+      valid = (A->count - c < MXB_LANES) ? A->count - c : MXB_LANES;
+
+      if(closed)
+      {
+        matrix_batch_det_closed(n, s, &A->data[c], &d[c], valid);
+      }
+      else if(w != NULL)
+      {
+        matrix_batch_det_kernel(n, s, &A->data[c], &d[c], valid, w);
+      }
+    }
+
+    free(w);
+  }
+
+  return ok;
+}
+
+/**
+@brief  Frees a batch
+@param  B: Pointer to batch
+@retval TRUE if batch was deleted, FALSE if B is NULL
+*/
+uint8_t matrix_batch_del(MatrixBatch B)
+{
+  if(B == NULL)
+  {
+    return FALSE;
+  }
+
+  free(B->data);
+  free(B);
+
+  return TRUE;
+}
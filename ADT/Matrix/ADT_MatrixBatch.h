@@ -0,0 +1,140 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixBatch.h
+ * Description   : Batches of small square matrices (structure of arrays).
+ *                 Header file.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _MATRIX_BATCH_H_
+#define _MATRIX_BATCH_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Matrix.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Matrices per kernel call (SIMD lanes run over them). Batches are padded to
+// a multiple, so every plane starts aligned and kernels have no edge case
+#define MXB_LANES (size_t)(64)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// count matrices of n x n in structure-of-arrays layout: element (i, j) of
+// every matrix is one plane of consecutive values, so element (i, j) of
+// matrix t is data[(i * n + j) * stride + t]
+typedef struct matrix_batch_struct
+{
+  size_t n;          // Dimension of every matrix
+  size_t count;      // Number of matrices
+  size_t stride;     // Elements per plane (count rounded up to MXB_LANES,
+                     // padding matrices are zero)
+  Data*  data;       // n * n planes
+}
+t_matrixBatch;
+
+// Matrix batch data type
+typedef t_matrixBatch* MatrixBatch;
+
+// Matrix batch handler
+typedef struct matrix_batch_handler
+{
+  MatrixBatch (*init)(size_t n, size_t count);                // Create batch
+  uint8_t (*set)(MatrixBatch B, size_t t, Matrix M);         // Store matrix t
+  Matrix  (*get)(MatrixBatch B, size_t t);                   // Copy matrix t
+  uint8_t (*product)(MatrixBatch R, MatrixBatch A, MatrixBatch B); // R = A B
+  uint8_t (*inverse)(MatrixBatch R, MatrixBatch A, size_t* singular); // Inv.
+  uint8_t (*det)(MatrixBatch A, Vector d);                   // Determinants
+  uint8_t (*del)(MatrixBatch B);                             // Delete batch
+}
+t_MatrixBatchHandler;
+
+extern t_MatrixBatchHandler MxB_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates a batch of zero matrices
+@param  n:     Dimension of every matrix (n x n)
+        count: Number of matrices
+@retval Pointer to new batch, NULL if a size is zero or on memory error
+*/
+extern MatrixBatch matrix_batch_init(size_t n, size_t count);
+
+/**
+@brief  Copies a matrix into the batch
+@param  B: Pointer to batch
+        t: Index of the matrix in the batch
+        M: Pointer to n x n matrix (any storage, or view)
+@retval TRUE if matrix was stored, FALSE if t or dimensions do not match
+*/
+extern uint8_t matrix_batch_set(MatrixBatch B, size_t t, Matrix M);
+
+/**
+@brief  Copies a matrix out of the batch
+@param  B: Pointer to batch
+        t: Index of the matrix in the batch
+@retval Pointer to new n x n matrix, NULL if t does not match or on memory
+        error
+*/
+extern Matrix matrix_batch_get(MatrixBatch B, size_t t);
+
+/**
+@brief  Products of matching matrices: R[t] = A[t] B[t]
+@param  R:    Pointer to result batch (may be A or B)
+        A, B: Pointers to operand batches
+@retval TRUE if products were computed, FALSE if sizes do not match or on
+        memory error
+@note   Each kernel call multiplies MXB_LANES matrices, one per SIMD lane.
+        Chunks are shared among OpenMP threads
+*/
+extern uint8_t matrix_batch_product(MatrixBatch R, MatrixBatch A,
+                                    MatrixBatch B);
+
+/**
+@brief  Inverses: R[t] = inv(A[t])
+@param  R:        Pointer to result batch (may be A)
+        A:        Pointer to operand batch
+        singular: Returns the number of singular matrices (may be NULL)
+@retval TRUE if inverses were computed, FALSE if sizes do not match or on
+        memory error
+@note   Adjugate over determinant up to 4 x 4. Larger matrices use
+        Gauss-Jordan elimination with partial pivoting: each lane picks its
+        own pivot row by conditional swaps, so lanes never branch apart.
+        The inverse of a singular matrix is set to zero
+*/
+extern uint8_t matrix_batch_inverse(MatrixBatch R, MatrixBatch A,
+                                    size_t* singular);
+
+/**
+@brief  Determinants: d[t] = det(A[t])
+@param  A: Pointer to batch
+        d: Returns count determinants
+@retval TRUE if determinants were computed, FALSE on invalid arguments or
+        memory error
+@note   Closed form up to 4 x 4, Gaussian elimination with partial pivoting
+        above (pivots chosen as in matrix_batch_inverse)
+*/
+extern uint8_t matrix_batch_det(MatrixBatch A, Vector d);
+
+/**
+@brief  Frees a batch
+@param  B: Pointer to batch
+@retval TRUE if batch was deleted, FALSE if B is NULL
+*/
+extern uint8_t matrix_batch_del(MatrixBatch B);
+
+#endif
@@ -0,0 +1,1184 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixEigen.c
+ * Description   : Symmetric eigen-decomposition and singular value
+ *                 decomposition. Library file.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<float.h>
+#include"ADT_MatrixEigen.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Eigen-decomposition / SVD handler
+t_MatrixEigenHandler MxE_Hdlr =
+{
+  matrix_eigen_sym,         // Symmetric eigen
+  matrix_eigen_delete,      // Delete eigen
+  matrix_svd,               // Thin SVD
+  matrix_svd_delete         // Delete SVD
+};
+
+// Plane rotations of one QL / QR sweep. Rotation k combines rows p[k] and
+// q[k] of the vectors: x_p = c x_p + s x_q, x_q = c x_q - s x_p
+typedef struct matrix_eigen_rotations
+{
+  size_t  count;     // Rotations recorded
+  size_t* p;         // First rows
+  size_t* q;         // Second rows
+  Data*   c;         // Cosines
+  Data*   s;         // Sines
+}
+t_matrixEigenRot;
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates a rotation list
+@param  R:        Pointer to list
+        capacity: Max. rotations per sweep
+@retval TRUE if list was allocated, FALSE on memory error
+*/
+uint8_t matrix_eigen_rot_init(t_matrixEigenRot* R, size_t capacity)
+{
+  R->count = 0;
+  R->p = (size_t*)malloc( capacity * sizeof(size_t) );
+  R->q = (size_t*)malloc( capacity * sizeof(size_t) );
+  R->c = (Data*)malloc( capacity * sizeof(Data) );
+  R->s = (Data*)malloc( capacity * sizeof(Data) );
+
+  return R->p != NULL && R->q != NULL && R->c != NULL && R->s != NULL;
+}
+
+/**
+@brief  Frees a rotation list
+@param  R: Pointer to list
+@retval none
+*/
+void matrix_eigen_rot_free(t_matrixEigenRot* R)
+{
+  free(R->p);
+  free(R->q);
+  free(R->c);
+  free(R->s);
+}
+
+/**
+@brief  Records one rotation
+@param  R:    Pointer to list
+        p, q: Rows combined
+        c, s: Cosine and sine
+@retval none
+*/
+void matrix_eigen_rot_push(t_matrixEigenRot* R, size_t p, size_t q, Data c,
+                           Data s)
+{
+  R->p[R->count] = p;
+  R->q[R->count] = q;
+  R->c[R->count] = c;
+  R->s[R->count] = s;
+  R->count++;
+}
+
+/**
+@brief  Applies the recorded rotations to the rows of Z and empties the list
+@param  Z: Pointer to dense matrix whose rows are the vectors (may be NULL)
+        R: Pointer to list
+@retval none
+@note   Columns are split in chunks of MXE_CHUNK; each OpenMP thread runs the
+        whole sweep over its chunks, which stay in cache across rotations
+*/
+MX_KERNEL_CLONES
+void matrix_eigen_rot_apply(Matrix Z, t_matrixEigenRot* R)
+{
+  size_t n = 0, chunks = 0, b = 0;
+
+  if(Z == NULL || R->count == 0)
+  {
+    R->count = 0;
+    return;
+  }
+
+  n = Z->columns;
+  chunks = (n + MXE_CHUNK - 1) / MXE_CHUNK;
+
+  #pragma omp parallel for schedule(static) \
+                           if(R->count * n >= MX_PARALLEL_MIN)
+  for(b = 0; b < chunks; b++)
+  {
+    size_t j0 = b * MXE_CHUNK;
+    size_t j1 = (n - j0 < MXE_CHUNK) ? n : j0 + MXE_CHUNK;
+    size_t j = 0, k = 0;
+
+    for(k = 0; k < R->count; k++)
+    {
+      Data* restrict x = &Z->data[R->p[k] * Z->ld];
+      Data* restrict y = &Z->data[R->q[k] * Z->ld];
+      Data c = R->c[k], s = R->s[k], t = 0;
+
+      for(j = j0; j < j1; j++)
+      {
+        t = x[j];
+        x[j] = c * t + s * y[j];
+        y[j] = c * y[j] - s * t;
+      }
+    }
+  }
+
+  R->count = 0;
+}
+
+/**
+@brief  Dot product of two vector segments
+@param  n:    Number of elements
+        x, v: Vectors
+@retval Sum of x[i] * v[i]
+@note   Eight independent partial sums: one SIMD accumulator
+*/
+MX_KERNEL_CLONES
+Data matrix_eigen_dot(size_t n, const Data* restrict x, const Data* restrict v)
+{
+  Data s[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  size_t i = 0, l = 0;
+
+  for(i = 0; i + 8 <= n; i += 8)
+  {
+    for(l = 0; l < 8; l++)
+    {
+      s[l] += x[i + l] * v[i + l];
+    }
+  }
+
+  for(; i < n; i++)
+  {
+    s[0] += x[i] * v[i];
+  }
+
+  return ((s[0] + s[4]) + (s[1] + s[5])) + ((s[2] + s[6]) + (s[3] + s[7]));
+}
+
+/**
+@brief  Dot product and update in one pass over x: y = y + a x
+@param  n: Number of elements
+        x: Vector
+        v: Vector dotted with x
+        a: Scale of x
+        y: Vector updated (disjoint from x and v)
+@retval Sum of x[i] * v[i]
+@note   Partial sums as in matrix_eigen_dot
+*/
+MX_KERNEL_CLONES
+Data matrix_eigen_dot_axpy(size_t n, const Data* restrict x,
+                           const Data* restrict v, Data a, Data* restrict y)
+{
+  Data s[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  size_t i = 0, l = 0;
+
+  for(i = 0; i + 8 <= n; i += 8)
+  {
+    for(l = 0; l < 8; l++)
+    {
+      s[l] += x[i + l] * v[i + l];
+      y[i + l] += a * x[i + l];
+    }
+  }
+
+  for(; i < n; i++)
+  {
+    s[0] += x[i] * v[i];
+    y[i] += a * x[i];
+  }
+
+  return ((s[0] + s[4]) + (s[1] + s[5])) + ((s[2] + s[6]) + (s[3] + s[7]));
+}
+
+/**
+@brief  Swaps two rows of a dense matrix
+@param  Z:    Pointer to matrix (may be NULL)
+        i, j: Rows
+@retval none
+*/
+void matrix_eigen_swap_rows(Matrix Z, size_t i, size_t j)
+{
+  Data* x = NULL;
+  Data* y = NULL;
+  Data t = 0;
+  size_t k = 0;
+
+  if(Z == NULL || i == j)
+  {
+    return;
+  }
+
+  x = &Z->data[i * Z->ld];
+  y = &Z->data[j * Z->ld];
+
+  for(k = 0; k < Z->columns; k++)
+  {
+    t = x[k];
+    x[k] = y[k];
+    y[k] = t;
+  }
+}
+
+/**
+@brief  Generates a Householder reflector H = I - tau v v^T with H x = beta e1
+@param  x:   Vector (n elements, inc apart); returns v, with v[0] = 1
+        n:   Number of elements
+        inc: Distance between elements
+        tau: Returns the reflector factor (0: H = I)
+@retval beta
+*/
+Data matrix_eigen_house(Data* x, size_t n, size_t inc, Data* tau)
+{
+  Data alpha = x[0], beta = 0, norm = 0, scale = 0;
+  size_t i = 0;
+
+  for(i = 1; i < n; i++)
+  {
+    norm += x[i * inc] * x[i * inc];
+  }
+
+  x[0] = 1;
+
+  if(norm == 0)
+  {
+    *tau = 0;
+
+    return alpha;
+  }
+
+  beta = -copysign(sqrt(alpha * alpha + norm), alpha);
+  *tau = (beta - alpha) / beta;
+  scale = 1 / (alpha - beta);
+
+  for(i = 1; i < n; i++)
+  {
+    x[i * inc] *= scale;
+  }
+
+  return beta;
+}
+
+/**
+@brief  Applies a sequence of reflectors: Y = H_0 H_1 ... H_(K-1) Y
+@param  Y:      Pointer to dense matrix (L x C)
+        v:      Reflector storage; element i of reflector k is
+                v[k * vk + i * vi], for i from off + k (implicit 1) to L - 1
+        vk, vi: Strides between reflectors and between elements
+        off:    Row of Y reached by the first element of reflector 0
+        K:      Number of reflectors
+        tau:    Reflector factors
+@retval TRUE if Y was transformed, FALSE on memory error
+@note   Blocks of MXE_NB reflectors, last block first, in compact WY form
+        H_k0 ... H_k1 = I - V T V^T (T upper triangular): each block costs
+        three matrix_gemm calls, W = V^T Y, W = T W, Y = Y - V W
+*/
+uint8_t matrix_eigen_backward(Matrix Y, const Data* v, size_t vk, size_t vi,
+                              size_t off, size_t K, const Data* tau)
+{
+  Matrix Vt = NULL, T = NULL, W = NULL, TW = NULL;
+  t_matrix Vv, Ys, Wv, Tv, TWv;
+  Data z[MXE_NB];
+  Data* row = NULL;
+  Data* ti = NULL;
+  size_t L = Y->rows, C = Y->columns;
+  size_t k0 = 0, nb = 0, r0 = 0, len = 0, i = 0, j = 0, l = 0;
+  uint8_t ok = TRUE;
+
+  if(K == 0)
+  {
+    return TRUE;
+  }
+
+  Vt = Mx_Hdlr.init(MXE_NB, L);
+  T = Mx_Hdlr.init(MXE_NB, MXE_NB);
+  W = Mx_Hdlr.init(MXE_NB, C);
+  TW = Mx_Hdlr.init(MXE_NB, C);
+  ok = Vt != NULL && T != NULL && W != NULL && TW != NULL;
+
+  for(k0 = (K - 1) / MXE_NB * MXE_NB; ok; k0 -= MXE_NB)
+  {
+    nb = (K - k0 < MXE_NB) ? K - k0 : MXE_NB;
+    r0 = off + k0;
+    len = L - r0;
+
+    // Block reflectors as rows over rows r0.. of Y, zeros made explicit
+    for(i = 0; i < nb; i++)
+    {
+      row = &Vt->data[i * Vt->ld];
+
+      for(j = 0; j < len; j++)
+      {
+        row[j] = (j < i) ? 0 :
+                 (j == i) ? 1 : v[(k0 + i) * vk + (r0 + j) * vi];
+      }
+    }
+
+    // Column i of T: tau_i T(0:i, 0:i) (-V(:, 0:i)^T v_i)
+    for(i = 0; i < nb; i++)
+    {
+      ti = &Vt->data[i * Vt->ld];
+
+      for(j = 0; j < i; j++)
+      {
+        row = &Vt->data[j * Vt->ld];
+        z[j] = 0;
+
+        for(l = i; l < len; l++)
+        {
+          z[j] += row[l] * ti[l];
+        }
+
+        z[j] *= -tau[k0 + i];
+      }
+
+      for(j = 0; j < i; j++)
+      {
+        row = &T->data[j * T->ld];
+        row[i] = 0;
+
+        for(l = j; l < i; l++)
+        {
+          row[i] += row[l] * z[l];
+        }
+      }
+
+      T->data[i * T->ld + i] = tau[k0 + i];
+    }
+
+    ok = Mx_Hdlr.viewInto(&Vv, Vt, 0, 0, nb, len, FALSE) &&
+         Mx_Hdlr.viewInto(&Ys, Y, r0, 0, len, C, FALSE) &&
+         Mx_Hdlr.viewInto(&Wv, W, 0, 0, nb, C, FALSE) &&
+         Mx_Hdlr.viewInto(&Tv, T, 0, 0, nb, nb, FALSE) &&
+         Mx_Hdlr.viewInto(&TWv, TW, 0, 0, nb, C, FALSE) &&
+         Mx_Hdlr.gemm(1, &Vv, &Ys, 0, &Wv) &&
+         Mx_Hdlr.gemm(1, &Tv, &Wv, 0, &TWv) &&
+         Mx_Hdlr.viewInto(&Vv, Vt, 0, 0, nb, len, TRUE) &&
+         Mx_Hdlr.gemm(-1, &Vv, &TWv, 1, &Ys);
+
+    if(k0 == 0)
+    {
+      break;
+    }
+  }
+
+  Mx_Hdlr.del(Vt);
+  Mx_Hdlr.del(T);
+  Mx_Hdlr.del(W);
+  Mx_Hdlr.del(TW);
+
+  return ok;
+}
+
+/**
+@brief  Householder reduction of a symmetric matrix to tridiagonal form
+@param  A:   Pointer to dense n x n symmetric matrix (both triangles, n >= 2);
+             returns reflector j in row j, columns j + 1 to n - 1
+        d:   Returns the diagonal (n elements)
+        e:   Returns the sub-diagonal (n - 1 elements)
+        tau: Returns the reflector factors (n - 1 elements)
+@retval TRUE if A was reduced, FALSE on memory error
+@note   A = Q T Q^T, Q = H_0 ... H_(n-2). Panels of MXE_NB reflectors only
+        bring their own rows up to date; the panel keeps V and W such that
+        the trailing matrix is A - V W^T - W V^T, applied with two
+        matrix_gemm calls at the end of the panel. The matrix-vector
+        product of every step reads the lower triangle once; rows are split
+        among OpenMP threads with private accumulators
+*/
+uint8_t matrix_eigen_tridiag(Matrix A, Vector d, Vector e, Vector tau)
+{
+  Matrix V = NULL, W = NULL;
+  t_matrix Av, Vv, Wv;
+  Data* a = A->data;
+  Data* vb = NULL;
+  Data* wb = NULL;
+  Data* x = NULL;
+  Data* y = NULL;
+  Data* v = NULL;
+  Data u = 0;
+  size_t n = A->rows, ld = A->ld, lv = 0;
+  size_t k0 = 0, k1 = 0, i = 0, p = 0, r = 0, t = 0;
+  uint8_t ok = TRUE;
+
+  V = Mx_Hdlr.init(n, MXE_NB);
+  W = Mx_Hdlr.init(n, MXE_NB);
+  x = (Data*)malloc( 2 * MXE_NB * sizeof(Data) );
+  y = (Data*)malloc( n * sizeof(Data) );
+  ok = V != NULL && W != NULL && x != NULL && y != NULL;
+
+  for(k0 = 0; ok && k0 + 1 < n; k0 = k1)
+  {
+    k1 = (n - 1 - k0 < MXE_NB) ? n - 1 : k0 + MXE_NB;
+    vb = V->data;
+    wb = W->data;
+    lv = V->ld;
+
+    for(i = k0; i < k1; i++)
+    {
+      p = i - k0;
+
+      // Row i up to date with the reflectors of the panel
+      for(r = i; r < n; r++)
+      {
+        for(t = 0, u = 0; t < p; t++)
+        {
+          u += vb[r * lv + t] * wb[i * lv + t] +
+               wb[r * lv + t] * vb[i * lv + t];
+        }
+
+        a[i * ld + r] -= u;
+      }
+
+      d[i] = a[i * ld + i];
+      v = &a[i * ld + i + 1];
+      e[i] = matrix_eigen_house(v, n - i - 1, 1, &tau[i]);
+
+      for(r = k0; r <= i; r++)
+      {
+        vb[r * lv + p] = 0;
+        wb[r * lv + p] = 0;
+      }
+
+      for(r = i + 1; r < n; r++)
+      {
+        vb[r * lv + p] = v[r - i - 1];
+      }
+
+      // x = W^T v, x + MXE_NB = V^T v (rows i + 1 to n - 1)
+      for(t = 0; t < p; t++)
+      {
+        x[t] = 0;
+        x[MXE_NB + t] = 0;
+
+        for(r = i + 1; r < n; r++)
+        {
+          x[t] += wb[r * lv + t] * v[r - i - 1];
+          x[MXE_NB + t] += vb[r * lv + t] * v[r - i - 1];
+        }
+      }
+
+      // y = A v from the lower triangle of A as of the start of the panel:
+      // row r adds A(r, i+1:r) v to y[r] and v[r] A(r, i+1:r) to y(i+1:r);
+      // threads accumulate privately
+      for(r = i + 1; r < n; r++)
+      {
+        y[r] = 0;
+      }
+
+      #pragma omp parallel reduction(&&:ok) \
+                           if((n - i) * (n - i) >= 2 * MX_PARALLEL_MIN)
+      {
+        Data* yt = (Data*)calloc( n, sizeof(Data) );
+        size_t j = 0;
+
+        ok = yt != NULL;
+
+        #pragma omp for schedule(static, 16)
+        for(j = i + 1; j < n; j++)
+        {
+          if(yt != NULL)
+          {
+            yt[j] += matrix_eigen_dot_axpy(j - i - 1, &a[j * ld + i + 1], v,
+                                           v[j - i - 1], &yt[i + 1]) +
+                     a[j * ld + j] * v[j - i - 1];
+          }
+        }
+
+        #pragma omp critical
+        for(j = i + 1; yt != NULL && j < n; j++)
+        {
+          y[j] += yt[j];
+        }
+
+        free(yt);
+      }
+
+      // w = tau (A v - V W^T v - W V^T v)
+      for(r = i + 1; r < n; r++)
+      {
+        for(t = 0, u = y[r]; t < p; t++)
+        {
+          u -= vb[r * lv + t] * x[t] + wb[r * lv + t] * x[MXE_NB + t];
+        }
+
+        wb[r * lv + p] = tau[i] * u;
+      }
+
+      // w = w - (tau / 2) (w^T v) v
+      for(r = i + 1, u = 0; r < n; r++)
+      {
+        u += wb[r * lv + p] * v[r - i - 1];
+      }
+
+      u *= -0.5 * tau[i];
+
+      for(r = i + 1; r < n; r++)
+      {
+        wb[r * lv + p] += u * v[r - i - 1];
+      }
+    }
+
+    // Trailing matrix: A = A - V W^T - W V^T
+    ok = Mx_Hdlr.viewInto(&Av, A, k1, k1, n - k1, n - k1, FALSE) &&
+         Mx_Hdlr.viewInto(&Vv, V, k1, 0, n - k1, k1 - k0, FALSE) &&
+         Mx_Hdlr.viewInto(&Wv, W, k1, 0, n - k1, k1 - k0, TRUE) &&
+         Mx_Hdlr.gemm(-1, &Vv, &Wv, 1, &Av) &&
+         Mx_Hdlr.viewInto(&Vv, W, k1, 0, n - k1, k1 - k0, FALSE) &&
+         Mx_Hdlr.viewInto(&Wv, V, k1, 0, n - k1, k1 - k0, TRUE) &&
+         Mx_Hdlr.gemm(-1, &Vv, &Wv, 1, &Av);
+  }
+
+  d[n - 1] = a[(n - 1) * ld + n - 1];
+
+  Mx_Hdlr.del(V);
+  Mx_Hdlr.del(W);
+  free(x);
+  free(y);
+
+  return ok;
+}
+
+/**
+@brief  Implicit QL iteration on a symmetric tridiagonal matrix
+@param  d: Diagonal (n elements); returns the eigenvalues (unsorted)
+        e: Sub-diagonal (n elements, e[n - 1] is workspace); destroyed
+        n: Dimension
+        Z: Pointer to dense matrix whose rows are rotated along (may be NULL)
+        R: Pointer to rotation list (capacity n)
+@retval TRUE if every eigenvalue converged within MXE_MAX_ITER iterations
+@note   Wilkinson shift from the leading 2 x 2 block of each unreduced
+        block; e[m] is negligible below DBL_EPSILON times the largest
+        |d| + |e|. The rotations of a sweep depend on d and e only, so they
+        are recorded and applied to Z in one pass per sweep
+*/
+uint8_t matrix_eigen_tql(Vector d, Vector e, size_t n, Matrix Z,
+                         t_matrixEigenRot* R)
+{
+  Data tol = 0, f = 0, g = 0, b = 0, r = 0, c = 0, s = 0, p = 0;
+  size_t l = 0, m = 0, i = 0, iter = 0;
+  uint8_t under = FALSE;
+
+  e[n - 1] = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    tol = fmax(tol, fabs(d[i]) + fabs(e[i]));
+  }
+
+  tol *= DBL_EPSILON;
+
+  for(l = 0; l < n; l++)
+  {
+    for(iter = 0; ; iter++)
+    {
+      // Smallest m >= l with a negligible e[m]
+      for(m = l; m + 1 < n; m++)
+      {
+        if(fabs(e[m]) <= tol)
+        {
+          break;
+        }
+      }
+
+      if(m == l)
+      {
+        break;
+      }
+
+      if(iter == MXE_MAX_ITER)
+      {
+        return FALSE;
+      }
+
+      g = (d[l + 1] - d[l]) / (2 * e[l]);
+      r = hypot(g, 1);
+      g = d[m] - d[l] + e[l] / (g + copysign(r, g));
+      s = 1;
+      c = 1;
+      p = 0;
+      under = FALSE;
+
+      for(i = m; i-- > l; )
+      {
+        f = s * e[i];
+        b = c * e[i];
+        r = hypot(f, g);
+        e[i + 1] = r;
+
+        // Underflow: e[i + 1] splits the block, restart the sweep
+        if(r == 0)
+        {
+          d[i + 1] -= p;
+          e[m] = 0;
+          under = TRUE;
+          break;
+        }
+
+        s = f / r;
+        c = g / r;
+        g = d[i + 1] - p;
+        r = (d[i] - g) * s + 2 * c * b;
+        p = s * r;
+        d[i + 1] = g + p;
+        g = c * r - b;
+        matrix_eigen_rot_push(R, i + 1, i, c, s);
+      }
+
+      matrix_eigen_rot_apply(Z, R);
+
+      if(!under)
+      {
+        d[l] -= p;
+        e[l] = g;
+        e[m] = 0;
+      }
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Householder reduction to upper bidiagonal form, B = Q B' P^T
+@param  X:    Pointer to dense N x M matrix, X = B^T for a tall M x N matrix
+              B (N <= M); returns left reflector k in row k, columns k to
+              M - 1, and right reflector k in column k, rows k + 1 to N - 1
+        d:    Returns the diagonal (N elements)
+        f:    Returns the super-diagonal (N - 1 elements)
+        taul: Returns the left reflector factors (N elements)
+        taur: Returns the right reflector factors (N - 1 elements)
+@retval none
+@note   Working on B^T makes every left reflector a row and every update a
+        sequence of contiguous dot products / axpys. Left updates are split
+        among OpenMP threads by rows, right updates by column chunks
+*/
+MX_KERNEL_CLONES
+void matrix_eigen_bidiag(Matrix X, Vector d, Vector f, Vector taul,
+                         Vector taur)
+{
+  Data* x = X->data;
+  Data* v = NULL;
+  size_t N = X->rows, M = X->columns, ld = X->ld;
+  size_t k = 0, r = 0, b = 0, chunks = 0;
+
+  for(k = 0; k < N; k++)
+  {
+    // Column k of B: H_k B(k:M, k+1:N), rows k + 1 to N - 1 of X
+    v = &x[k * ld + k];
+    d[k] = matrix_eigen_house(v, M - k, 1, &taul[k]);
+
+    #pragma omp parallel for schedule(static) \
+                             if((N - k) * (M - k) >= MX_PARALLEL_MIN)
+    for(r = k + 1; r < N; r++)
+    {
+      Data* xr = &x[r * ld + k];
+      Data u = taul[k] * matrix_eigen_dot(M - k, xr, v);
+      size_t j = 0;
+
+      for(j = 0; j < M - k; j++)
+      {
+        xr[j] -= u * v[j];
+      }
+    }
+
+    if(k + 1 == N)
+    {
+      break;
+    }
+
+    // Row k of B: B(k+1:M, k+1:N) G_k, rows k + 1 to N - 1 of X
+    f[k] = matrix_eigen_house(&x[(k + 1) * ld + k], N - k - 1, ld, &taur[k]);
+    chunks = (M - k - 1 + MXE_CHUNK - 1) / MXE_CHUNK;
+
+    #pragma omp parallel for schedule(static) \
+                             if((N - k) * (M - k) >= MX_PARALLEL_MIN)
+    for(b = 0; b < chunks; b++)
+    {
+      Data w[MXE_CHUNK];
+      Data* xr = NULL;
+      Data u = 0;
+      size_t c0 = k + 1 + b * MXE_CHUNK;
+      size_t c1 = (M - c0 < MXE_CHUNK) ? M : c0 + MXE_CHUNK;
+      size_t i = 0, c = 0;
+
+      for(c = c0; c < c1; c++)
+      {
+        w[c - c0] = 0;
+      }
+
+      for(i = k + 1; i < N; i++)
+      {
+        xr = &x[i * ld];
+        u = xr[k];
+
+        for(c = c0; c < c1; c++)
+        {
+          w[c - c0] += u * xr[c];
+        }
+      }
+
+      for(i = k + 1; i < N; i++)
+      {
+        xr = &x[i * ld];
+        u = taur[k] * xr[k];
+
+        for(c = c0; c < c1; c++)
+        {
+          xr[c] -= u * w[c - c0];
+        }
+      }
+    }
+  }
+}
+
+/**
+@brief  Golub-Kahan implicit QR iteration on an upper bidiagonal matrix
+@param  d: Diagonal (N elements); returns the singular values (unsorted,
+           nonnegative)
+        e: Super-diagonal shifted by one: e[i] couples d[i - 1] and d[i],
+           e[0] = 0 (N elements); destroyed
+        N: Dimension
+        U: Pointer to dense matrix whose rows are the left vectors (may be
+           NULL)
+        V: Pointer to dense matrix whose rows are the right vectors (may be
+           NULL)
+        R: Pointer to rotation lists, R[0] for U (capacity 2 N), R[1] for V
+           (capacity N)
+@retval TRUE if every singular value converged within MXE_MAX_ITER
+        iterations
+@note   Shift from the trailing 2 x 2 block; a negligible diagonal element
+        first cancels its super-diagonal with rotations from the left.
+        Negligible means below DBL_EPSILON times the largest |d| + |e|
+*/
+uint8_t matrix_eigen_bdqr(Vector d, Vector e, size_t N, Matrix U, Matrix V,
+                          t_matrixEigenRot* R)
+{
+  Data anorm = 0, tol = 0, c = 0, s = 0, f = 0, g = 0, h = 0;
+  Data x = 0, y = 0, z = 0;
+  size_t k = 0, l = 0, nm = 0, i = 0, j = 0, iter = 0;
+  uint8_t cancel = FALSE;
+
+  for(i = 0; i < N; i++)
+  {
+    anorm = fmax(anorm, fabs(d[i]) + fabs(e[i]));
+  }
+
+  tol = DBL_EPSILON * anorm;
+
+  for(k = N; k-- > 0; )
+  {
+    for(iter = 0; ; iter++)
+    {
+      // Largest l <= k with a negligible e[l] or d[l - 1]
+      for(l = k; ; l--)
+      {
+        if(l == 0 || fabs(e[l]) <= tol)
+        {
+          cancel = FALSE;
+          break;
+        }
+
+        if(fabs(d[l - 1]) <= tol)
+        {
+          cancel = TRUE;
+          break;
+        }
+      }
+
+      // d[l - 1] = 0: rotate e[l] to zero along row l - 1
+      if(cancel)
+      {
+        nm = l - 1;
+        c = 0;
+        s = 1;
+
+        for(i = l; i <= k; i++)
+        {
+          f = s * e[i];
+          e[i] = c * e[i];
+
+          if(fabs(f) <= tol)
+          {
+            break;
+          }
+
+          g = d[i];
+          h = hypot(f, g);
+          d[i] = h;
+          c = g / h;
+          s = -f / h;
+          matrix_eigen_rot_push(&R[0], nm, i, c, s);
+        }
+
+        matrix_eigen_rot_apply(U, &R[0]);
+      }
+
+      z = d[k];
+
+      if(l == k)
+      {
+        if(z < 0)
+        {
+          d[k] = -z;
+
+          for(j = 0; V != NULL && j < V->columns; j++)
+          {
+            V->data[k * V->ld + j] = -V->data[k * V->ld + j];
+          }
+        }
+
+        break;
+      }
+
+      if(iter == MXE_MAX_ITER)
+      {
+        return FALSE;
+      }
+
+      // Shift from the trailing 2 x 2 block of B'^T B'
+      x = d[l];
+      nm = k - 1;
+      y = d[nm];
+      g = e[nm];
+      h = e[k];
+      f = ((y - z) * (y + z) + (g - h) * (g + h)) / (2 * h * y);
+      g = hypot(f, 1);
+      f = ((x - z) * (x + z) + h * (y / (f + copysign(g, f)) - h)) / x;
+      c = 1;
+      s = 1;
+
+      // Chase the bulge from l to k
+      for(j = l; j < k; j++)
+      {
+        i = j + 1;
+        g = e[i];
+        y = d[i];
+        h = s * g;
+        g = c * g;
+        z = hypot(f, h);
+        e[j] = z;
+        c = f / z;
+        s = h / z;
+        f = x * c + g * s;
+        g = g * c - x * s;
+        h = y * s;
+        y *= c;
+        matrix_eigen_rot_push(&R[1], j, i, c, s);
+        z = hypot(f, h);
+        d[j] = z;
+
+        if(z != 0)
+        {
+          c = f / z;
+          s = h / z;
+        }
+
+        f = c * g + s * y;
+        x = c * y - s * g;
+        matrix_eigen_rot_push(&R[0], j, i, c, s);
+      }
+
+      e[l] = 0;
+      e[k] = f;
+      d[k] = x;
+      matrix_eigen_rot_apply(U, &R[0]);
+      matrix_eigen_rot_apply(V, &R[1]);
+    }
+  }
+
+  return TRUE;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Eigenvalues and eigenvectors of a symmetric matrix
+@param  A:       Pointer to symmetric matrix (any storage, or view; only its
+                 lower triangle is read)
+        vectors: TRUE to compute the eigenvectors
+@retval Pointer to decomposition, NULL if A is not square, QL does not
+        converge or on memory error
+@note   Blocked Householder tridiagonalization (panels of MXE_NB reflectors,
+        GEMM trailing updates), implicit QL with Wilkinson shifts on the
+        tridiagonal matrix, then the reflectors are applied to its
+        eigenvectors in compact WY blocks. Each QL sweep of rotations is
+        applied to the eigenvectors by OpenMP threads over column chunks.
+        Eigenvalues are accurate relative to the largest one. O(n^3);
+        eigenvalues only: 4/3 n^3 plus O(n^2)
+*/
+MatrixEigen matrix_eigen_sym(Matrix A, uint8_t vectors)
+{
+  MatrixEigen E = NULL;
+  Matrix W = NULL, Z = NULL;
+  t_matrixEigenRot R = {0, NULL, NULL, NULL, NULL};
+  Vector e = NULL, tau = NULL;
+  Data t = 0;
+  size_t n = 0, i = 0, j = 0, m = 0;
+  uint8_t ok = FALSE;
+
+  if(A == NULL || A->rows != A->columns)
+  {
+    return NULL;
+  }
+
+  n = A->rows;
+  E = (MatrixEigen)malloc( sizeof(t_matrixEigen) );
+
+  if(E == NULL)
+  {
+    return NULL;
+  }
+
+  E->n = n;
+  E->values = (Vector)malloc( n * sizeof(Data) );
+  E->vectors = NULL;
+  e = (Vector)malloc( n * sizeof(Data) );
+  tau = (Vector)malloc( n * sizeof(Data) );
+  W = Mx_Hdlr.unpack(A);
+  Z = vectors ? Mx_Hdlr.eye(n) : NULL;
+  ok = E->values != NULL && e != NULL && tau != NULL && W != NULL &&
+       (!vectors || Z != NULL) && matrix_eigen_rot_init(&R, n);
+
+  // Upper triangle from the lower one
+  for(i = 0; ok && i < n; i++)
+  {
+    for(j = i + 1; j < n; j++)
+    {
+      W->data[i * W->ld + j] = W->data[j * W->ld + i];
+    }
+  }
+
+  if(ok && n == 1)
+  {
+    E->values[0] = W->data[0];
+  }
+  else if(ok)
+  {
+    ok = matrix_eigen_tridiag(W, E->values, e, tau) &&
+         matrix_eigen_tql(E->values, e, n, Z, &R);
+  }
+
+  // Ascending order, rows of Z along
+  for(i = 0; ok && i + 1 < n; i++)
+  {
+    for(j = i + 1, m = i; j < n; j++)
+    {
+      m = (E->values[j] < E->values[m]) ? j : m;
+    }
+
+    t = E->values[i];
+    E->values[i] = E->values[m];
+    E->values[m] = t;
+    matrix_eigen_swap_rows(Z, i, m);
+  }
+
+  // Eigenvectors of A = Q (eigenvectors of the tridiagonal matrix)
+  if(ok && vectors)
+  {
+    E->vectors = Mx_Hdlr.transp(Z);
+    ok = E->vectors != NULL &&
+         matrix_eigen_backward(E->vectors, W->data, W->ld, 1, 1, n - 1, tau);
+  }
+
+  matrix_eigen_rot_free(&R);
+  Mx_Hdlr.del(W);
+  Mx_Hdlr.del(Z);
+  free(e);
+  free(tau);
+
+  if(!ok)
+  {
+    matrix_eigen_delete(E);
+
+    return NULL;
+  }
+
+  return E;
+}
+
+/**
+@brief  Frees an eigen-decomposition
+@param  E: Pointer to decomposition
+@retval TRUE if decomposition was deleted, FALSE if E is NULL
+*/
+uint8_t matrix_eigen_delete(MatrixEigen E)
+{
+  if(E == NULL)
+  {
+    return FALSE;
+  }
+
+  free(E->values);
+  Mx_Hdlr.del(E->vectors);
+  free(E);
+
+  return TRUE;
+}
+
+/**
+@brief  Thin singular value decomposition
+@param  A:       Pointer to m x n matrix (any storage, or view)
+        vectors: TRUE to compute the singular vectors
+@retval Pointer to decomposition, NULL if QR iteration does not converge
+        or on memory error
+@note   Householder bidiagonalization of the tall one of A, A^T, then
+        Golub-Kahan implicit QR with shifts on the bidiagonal matrix;
+        singular vectors are back-transformed as in matrix_eigen_sym.
+        Singular values are accurate relative to the largest one
+*/
+MatrixSVD matrix_svd(Matrix A, uint8_t vectors)
+{
+  MatrixSVD S = NULL;
+  Matrix X = NULL, UB = NULL, VB = NULL, U = NULL, V = NULL, D = NULL;
+  t_matrixEigenRot R[2] = {{0, NULL, NULL, NULL, NULL},
+                           {0, NULL, NULL, NULL, NULL}};
+  Vector e = NULL, taul = NULL, taur = NULL;
+  Data t = 0;
+  size_t M = 0, N = 0, i = 0, j = 0, m = 0;
+  uint8_t wide = FALSE, ok = FALSE;
+
+  if(A == NULL)
+  {
+    return NULL;
+  }
+
+  // X = B^T, B = A (tall) or A^T (wide)
+  wide = A->rows < A->columns;
+  M = wide ? A->columns : A->rows;
+  N = wide ? A->rows : A->columns;
+  D = Mx_Hdlr.unpack(A);
+  X = (D == NULL || wide) ? D : Mx_Hdlr.transp(D);
+
+  if(X != D)
+  {
+    Mx_Hdlr.del(D);
+  }
+
+  S = (MatrixSVD)malloc( sizeof(t_matrixSVD) );
+
+  if(S == NULL || X == NULL)
+  {
+    Mx_Hdlr.del(X);
+    free(S);
+
+    return NULL;
+  }
+
+  S->k = N;
+  S->s = (Vector)malloc( N * sizeof(Data) );
+  S->U = NULL;
+  S->V = NULL;
+  e = (Vector)malloc( N * sizeof(Data) );
+  taul = (Vector)malloc( N * sizeof(Data) );
+  taur = (Vector)malloc( N * sizeof(Data) );
+  UB = vectors ? Mx_Hdlr.eye(N) : NULL;
+  VB = vectors ? Mx_Hdlr.eye(N) : NULL;
+  ok = S->s != NULL && e != NULL && taul != NULL && taur != NULL &&
+       (!vectors || (UB != NULL && VB != NULL)) &&
+       matrix_eigen_rot_init(&R[0], 2 * N) &&
+       matrix_eigen_rot_init(&R[1], N);
+
+  if(ok)
+  {
+    matrix_eigen_bidiag(X, S->s, &e[1], taul, taur);
+    e[0] = 0;
+    ok = matrix_eigen_bdqr(S->s, e, N, UB, VB, R);
+  }
+
+  // Descending order, rows of UB and VB along
+  for(i = 0; ok && i + 1 < N; i++)
+  {
+    for(j = i + 1, m = i; j < N; j++)
+    {
+      m = (S->s[j] > S->s[m]) ? j : m;
+    }
+
+    t = S->s[i];
+    S->s[i] = S->s[m];
+    S->s[m] = t;
+    matrix_eigen_swap_rows(UB, i, m);
+    matrix_eigen_swap_rows(VB, i, m);
+  }
+
+  // U = Q [UB^T; 0] (M x N), V = P VB^T (N x N)
+  if(ok && vectors)
+  {
+    U = Mx_Hdlr.init(M, N);
+    V = Mx_Hdlr.transp(VB);
+    ok = U != NULL && V != NULL;
+
+    for(i = 0; ok && i < N; i++)
+    {
+      for(j = 0; j < N; j++)
+      {
+        U->data[i * U->ld + j] = UB->data[j * UB->ld + i];
+      }
+    }
+
+    ok = ok &&
+         matrix_eigen_backward(U, X->data, X->ld, 1, 0, N, taul) &&
+         matrix_eigen_backward(V, X->data, 1, X->ld, 1, N - 1, taur);
+    S->U = wide ? V : U;
+    S->V = wide ? U : V;
+  }
+
+  matrix_eigen_rot_free(&R[0]);
+  matrix_eigen_rot_free(&R[1]);
+  Mx_Hdlr.del(X);
+  Mx_Hdlr.del(UB);
+  Mx_Hdlr.del(VB);
+  free(e);
+  free(taul);
+  free(taur);
+
+  if(!ok)
+  {
+    if(S->U == NULL)
+    {
+      Mx_Hdlr.del(U);
+      Mx_Hdlr.del(V);
+    }
+
+    matrix_svd_delete(S);
+
+    return NULL;
+  }
+
+  return S;
+}
+
+/**
+@brief  Frees a singular value decomposition
+@param  S: Pointer to decomposition
+@retval TRUE if decomposition was deleted, FALSE if S is NULL
+*/
+uint8_t matrix_svd_delete(MatrixSVD S)
+{
+  if(S == NULL)
+  {
+    return FALSE;
+  }
+
+  Mx_Hdlr.del(S->U);
+  free(S->s);
+  Mx_Hdlr.del(S->V);
+  free(S);
+
+  return TRUE;
+}
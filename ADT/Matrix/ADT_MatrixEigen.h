@@ -0,0 +1,126 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixEigen.h
+ * Description   : Symmetric eigen-decomposition and singular value
+ *                 decomposition. Header file.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _MATRIX_EIGEN_H_
+#define _MATRIX_EIGEN_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Matrix.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Householder reflectors per block: reduction panels (rank-2 MXE_NB trailing
+// update) and back-transformation blocks (compact WY, three GEMMs)
+#define MXE_NB (size_t)(64)
+
+// Columns per thread when a sweep of plane rotations is applied to vectors
+#define MXE_CHUNK (size_t)(256)
+
+// Max. QL / QR iterations per eigenvalue or singular value
+#define MXE_MAX_ITER (size_t)(60)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Symmetric eigen-decomposition A = V diag(values) V^T
+typedef struct matrix_eigen
+{
+  size_t n;          // Dimension
+  Vector values;     // Eigenvalues in ascending order
+  Matrix vectors;    // Orthonormal eigenvectors, column j for values[j]
+                     // (NULL if not requested)
+}
+t_matrixEigen;
+
+// Eigen-decomposition data type
+typedef t_matrixEigen* MatrixEigen;
+
+// Thin singular value decomposition A = U diag(s) V^T, A m x n, k = min(m, n)
+typedef struct matrix_svd
+{
+  size_t k;          // Number of singular values
+  Matrix U;          // Left singular vectors (m x k, orthonormal columns)
+  Vector s;          // Singular values in descending order
+  Matrix V;          // Right singular vectors (n x k, orthonormal columns)
+}
+t_matrixSVD;
+
+// Singular value decomposition data type
+typedef t_matrixSVD* MatrixSVD;
+
+// Eigen-decomposition / SVD handler
+typedef struct matrix_eigen_handler
+{
+  MatrixEigen (*sym)(Matrix A, uint8_t vectors);       // Symmetric eigen
+  uint8_t     (*delEig)(MatrixEigen E);                // Delete eigen
+  MatrixSVD   (*svd)(Matrix A, uint8_t vectors);       // Thin SVD
+  uint8_t     (*delSVD)(MatrixSVD S);                  // Delete SVD
+}
+t_MatrixEigenHandler;
+
+extern t_MatrixEigenHandler MxE_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Eigenvalues and eigenvectors of a symmetric matrix
+@param  A:       Pointer to symmetric matrix (any storage, or view; only its
+                 lower triangle is read)
+        vectors: TRUE to compute the eigenvectors
+@retval Pointer to decomposition, NULL if A is not square, QL does not
+        converge or on memory error
+@note   Blocked Householder tridiagonalization (panels of MXE_NB reflectors,
+        GEMM trailing updates), implicit QL with Wilkinson shifts on the
+        tridiagonal matrix, then the reflectors are applied to its
+        eigenvectors in compact WY blocks. Each QL sweep of rotations is
+        applied to the eigenvectors by OpenMP threads over column chunks.
+        Eigenvalues are accurate relative to the largest one. O(n^3);
+        eigenvalues only: 4/3 n^3 plus O(n^2)
+*/
+extern MatrixEigen matrix_eigen_sym(Matrix A, uint8_t vectors);
+
+/**
+@brief  Frees an eigen-decomposition
+@param  E: Pointer to decomposition
+@retval TRUE if decomposition was deleted, FALSE if E is NULL
+*/
+extern uint8_t matrix_eigen_delete(MatrixEigen E);
+
+/**
+@brief  Thin singular value decomposition
+@param  A:       Pointer to m x n matrix (any storage, or view)
+        vectors: TRUE to compute the singular vectors
+@retval Pointer to decomposition, NULL if QR iteration does not converge
+        or on memory error
+@note   Householder bidiagonalization of the tall one of A, A^T, then
+        Golub-Kahan implicit QR with shifts on the bidiagonal matrix;
+        singular vectors are back-transformed as in matrix_eigen_sym.
+        Singular values are accurate relative to the largest one
+*/
+extern MatrixSVD matrix_svd(Matrix A, uint8_t vectors);
+
+/**
+@brief  Frees a singular value decomposition
+@param  S: Pointer to decomposition
+@retval TRUE if decomposition was deleted, FALSE if S is NULL
+*/
+extern uint8_t matrix_svd_delete(MatrixSVD S);
+
+#endif
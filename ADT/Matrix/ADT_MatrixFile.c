@@ -0,0 +1,802 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixFile.c
+ * Description   : Binary matrix files, memory-mapped loading. Library file.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+// POSIX declarations (open, mmap) under strict ISO C builds
+#define _POSIX_C_SOURCE 200809L
+
+#include"ADT_MatrixFile.h"
+
+#ifdef MXF_MMAP
+#include<fcntl.h>
+#include<unistd.h>
+#include<sys/mman.h>
+#endif
+
+#ifdef MXF_PREFETCH
+#include<pthread.h>
+#endif
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Matrix whose elements live in a file mapping. The matrix comes first, so
+// Mx_Hdlr.del releases the mapping (release hook) and frees the whole record
+typedef struct matrix_file_map
+{
+  t_matrix M;               // Matrix over the mapping
+  void*    map;             // Mapping base (header included)
+  size_t   length;          // Mapping length
+}
+t_matrixFileMap;
+
+// Out-of-core product: tiles A(i, p) and B(p, j) to read into memory
+typedef struct matrix_file_tiles
+{
+  FILE* fa;                      // First operand file
+  FILE* fb;                      // Second operand file
+  const t_matrixFileHeader* Ha;  // First operand header
+  const t_matrixFileHeader* Hb;  // Second operand header
+  size_t i, p, j;                // Tile origins
+  size_t tr, tk, tc;             // Tile sizes (clipped to the matrices)
+  Data* a;                       // A tile buffer (NULL: A tile unchanged)
+  Data* b;                       // B tile buffer
+  size_t lda, ldb;               // Buffer leading dimensions
+  uint8_t ok;                    // Read status
+}
+t_matrixFileTiles;
+
+// Matrix file handler
+t_MatrixFileHandler MxF_Hdlr =
+{
+  matrix_file_save,         // Write file
+  matrix_file_map,          // Map file
+  matrix_file_load,         // Read file
+  matrix_file_info,         // Header
+  matrix_file_verify,       // Checksum
+  matrix_file_product       // File product
+};
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Checksum state: 64-bit FNV-1a in four interleaved lanes
+@param  h: Lane states (output)
+@retval none
+*/
+void matrix_file_hash_init(uint64_t h[4])
+{
+  size_t l = 0;
+
+  for(l = 0; l < 4; l++)
+  {
+    h[l] = MXF_FNV_BASIS + l;
+  }
+}
+
+/**
+@brief  Adds 8-byte words to a checksum state
+@param  h: Lane states
+        p: Words
+        n: Number of words
+@retval none
+@note   Word t goes to lane t % 4, the last n % 4 words to lane 0: blocks of
+        a multiple of 4 words can be added one after another. Independent
+        lanes keep four multiplies in flight instead of one dependency chain
+*/
+void matrix_file_hash(uint64_t h[4], const void* p, size_t n)
+{
+  const unsigned char* b = (const unsigned char*)p;
+  uint64_t w = 0;
+  size_t i = 0, l = 0;
+
+  for(i = 0; i + 4 <= n; i += 4)
+  {
+    for(l = 0; l < 4; l++)
+    {
+      memcpy(&w, &b[(i + l) * sizeof(w)], sizeof(w));
+      h[l] = (h[l] ^ w) * MXF_FNV_PRIME;
+    }
+  }
+
+  for(; i < n; i++)
+  {
+    memcpy(&w, &b[i * sizeof(w)], sizeof(w));
+    h[0] = (h[0] ^ w) * MXF_FNV_PRIME;
+  }
+}
+
+/**
+@brief  Folds the lanes of a checksum state
+@param  h: Lane states
+        n: Total number of words added
+@retval Checksum
+*/
+uint64_t matrix_file_hash_fold(const uint64_t h[4], uint64_t n)
+{
+  uint64_t r = MXF_FNV_BASIS;
+  size_t l = 0;
+
+  for(l = 0; l < 4; l++)
+  {
+    r = (r ^ h[l]) * MXF_FNV_PRIME;
+  }
+
+  return r ^ n;
+}
+
+/**
+@brief  Payload checksum
+@param  p: Payload
+        n: Number of 8-byte words
+@retval Checksum
+@note   Any single corrupted word changes the result
+*/
+uint64_t matrix_file_checksum(const void* p, size_t n)
+{
+  uint64_t h[4];
+
+  matrix_file_hash_init(h);
+  matrix_file_hash(h, p, n);
+
+  return matrix_file_hash_fold(h, n);
+}
+
+/**
+@brief  Payload size implied by the dimensions and storage of a header
+@param  H: Pointer to header
+@retval Bytes, 0 if the dimensions are inconsistent or overflow
+*/
+uint64_t matrix_file_bytes(const t_matrixFileHeader* H)
+{
+  uint64_t n = H->rows, e = 0;
+
+  if(n == 0 || H->columns == 0 || (H->structure != MX_GENERAL &&
+     H->columns != n) || (H->structure != MX_BANDED && (H->kl != 0 ||
+     H->ku != 0)))
+  {
+    return 0;
+  }
+
+  switch(H->structure)
+  {
+    case MX_GENERAL:
+      e = (H->ld >= H->columns && n <= UINT64_MAX / H->ld) ? n * H->ld : 0;
+      break;
+
+    case MX_DIAGONAL:
+      e = (H->ld == 1) ? n : 0;
+      break;
+
+    case MX_BANDED:
+      e = (H->kl < n && H->ku < n && H->ld == H->kl + H->ku + 1) ? n * H->ld :
+          0;
+      break;
+
+    case MX_UPPER:
+    case MX_LOWER:
+    case MX_SYMMETRIC:
+      e = (H->ld == 1 && n < UINT32_MAX) ? n * (n + 1) / 2 : 0;
+      break;
+
+    default:
+      e = 0;
+      break;
+  }
+
+  // The payload must also be addressable on this host
+  return (e <= SIZE_MAX / sizeof(Data)) ? e * sizeof(Data) : 0;
+}
+
+/**
+@brief  Sets up a matrix over a payload in memory
+@param  M:    Pointer to matrix structure to fill
+        H:    Pointer to validated header
+        data: Payload (NULL on a failed allocation)
+@retval TRUE if matrix was set up, FALSE if data is NULL or on memory error
+        (M can still be deleted with Mx_Hdlr.del)
+*/
+uint8_t matrix_file_wrap(Matrix M, const t_matrixFileHeader* H, Data* data)
+{
+  size_t i = 0;
+
+  M->rows = H->rows;
+  M->columns = H->columns;
+  M->ld = H->ld;
+  M->structure = (t_matrixStructure)H->structure;
+  M->kl = H->kl;
+  M->ku = H->ku;
+  M->determinant = 0;
+  M->dirty = TRUE;
+  M->lu = NULL;
+  M->transposed = FALSE;
+  M->base = NULL;
+  M->data = data;
+  M->matrix = NULL;
+  M->release = NULL;
+
+  if(data == NULL)
+  {
+    return FALSE;
+  }
+
+  // Row pointers: the only memory proportional to the matrix size
+  if(M->structure == MX_GENERAL)
+  {
+    M->matrix = (Array)malloc( M->rows * sizeof(Vector) );
+
+    if(M->matrix == NULL)
+    {
+      return FALSE;
+    }
+
+    for(i = 0; i < M->rows; i++)
+    {
+      M->matrix[i] = data + i * M->ld;
+    }
+  }
+
+  return TRUE;
+}
+
+#ifdef MXF_MMAP
+/**
+@brief  Releases the file mapping of a mapped matrix (release hook)
+@param  M: Pointer to matrix created by matrix_file_map
+@retval none
+*/
+void matrix_file_unmap(Matrix M)
+{
+  t_matrixFileMap* R = (t_matrixFileMap*)M;
+
+  munmap(R->map, R->length);
+}
+#endif
+
+/**
+@brief  Sets up a general matrix over a buffer (tile of an out-of-core
+        product), without row pointers
+@param  T:       Pointer to matrix structure to fill
+        data:    Buffer
+        rows:    Number of rows
+        columns: Number of columns
+        ld:      Leading dimension of the buffer
+@retval none
+*/
+void matrix_file_tile(Matrix T, Data* data, size_t rows, size_t columns,
+                      size_t ld)
+{
+  T->rows = rows;
+  T->columns = columns;
+  T->ld = ld;
+  T->structure = MX_GENERAL;
+  T->kl = 0;
+  T->ku = 0;
+  T->determinant = 0;
+  T->dirty = TRUE;
+  T->lu = NULL;
+  T->transposed = FALSE;
+  T->base = NULL;
+  T->data = data;
+  T->matrix = NULL;
+  T->release = NULL;
+}
+
+/**
+@brief  Reads a block of a general matrix file
+@param  f:       Open file
+        H:       Pointer to validated header
+        i, j:    Block origin
+        rows:    Number of rows
+        columns: Number of columns
+        dst:     Buffer
+        ld:      Leading dimension of the buffer
+@retval TRUE if block was read, FALSE on I/O error
+@note   One read per row: whole rows of the file when the block spans them
+*/
+uint8_t matrix_file_read(FILE* f, const t_matrixFileHeader* H, size_t i,
+                         size_t j, size_t rows, size_t columns, Data* dst,
+                         size_t ld)
+{
+  size_t r = 0;
+
+  for(r = 0; r < rows; r++)
+  {
+    // Offsets fit in long: they are below the file size given by ftell
+    if(fseek(f, (long)(H->offset + ((i + r) * H->ld + j) * sizeof(Data)),
+             SEEK_SET) != 0 ||
+       fread(&dst[r * ld], sizeof(Data), columns, f) != columns)
+    {
+      return FALSE;
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Reads the tiles of one step of an out-of-core product (prefetch
+        thread body)
+@param  job: Pointer to tiles (t_matrixFileTiles)
+@retval NULL
+*/
+void* matrix_file_prefetch(void* job)
+{
+  t_matrixFileTiles* J = (t_matrixFileTiles*)job;
+
+  J->ok = (J->a == NULL || matrix_file_read(J->fa, J->Ha, J->i, J->p, J->tr,
+                                            J->tk, J->a, J->lda)) &&
+          matrix_file_read(J->fb, J->Hb, J->p, J->j, J->tk, J->tc, J->b,
+                           J->ldb);
+
+  return NULL;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Writes a matrix to a binary file
+@param  M:    Pointer to matrix (any storage, or view)
+        path: File name (overwritten)
+@retval TRUE if file was written, FALSE on I/O or memory error
+*/
+uint8_t matrix_file_save(Matrix M, const char* path)
+{
+  static const char zero[MXF_OFFSET] = {0};     // Header padding
+  t_matrixFileHeader H;
+  Matrix U = NULL;                              // Row-major storage of M
+  FILE* f = NULL;
+  uint8_t ok = FALSE;
+
+  if(M == NULL || path == NULL)
+  {
+    return FALSE;
+  }
+
+  // Views: storage shared with other elements, written as a new matrix
+  U = (M->base != NULL) ? Mx_Hdlr.unpack(M) : M;
+
+  if(U == NULL)
+  {
+    return FALSE;
+  }
+
+  memset(&H, 0, sizeof(H));
+  memcpy(H.magic, MXF_MAGIC, sizeof(H.magic));
+  H.version = MXF_VERSION;
+  H.endian = MXF_ENDIAN;
+  H.dtype = MXF_FLOAT64;
+  H.structure = (uint32_t)U->structure;
+  H.rows = U->rows;
+  H.columns = U->columns;
+  H.ld = U->ld;
+  H.kl = U->kl;
+  H.ku = U->ku;
+  H.offset = MXF_OFFSET;
+  H.bytes = matrix_file_bytes(&H);
+  H.checksum = matrix_file_checksum(U->data, H.bytes / sizeof(Data));
+
+  f = fopen(path, "wb");
+  ok = (f != NULL && H.bytes != 0 && fwrite(&H, sizeof(H), 1, f) == 1 &&
+        fwrite(zero, 1, MXF_OFFSET - sizeof(H), f) == MXF_OFFSET - sizeof(H)
+        && fwrite(U->data, 1, H.bytes, f) == H.bytes);
+
+  if(f != NULL && fclose(f) != 0)
+  {
+    ok = FALSE;
+  }
+
+  if(U != M)
+  {
+    Mx_Hdlr.del(U);
+  }
+
+  return ok;
+}
+
+/**
+@brief  Maps a binary file as a matrix, without copying its elements
+@param  path:   File name
+        verify: TRUE to check the payload checksum (reads every page)
+@retval Pointer to matrix, NULL if the file is missing, malformed,
+        truncated, fails verification or on memory error
+*/
+Matrix matrix_file_map(const char* path, uint8_t verify)
+{
+#ifdef MXF_MMAP
+  t_matrixFileHeader H;
+  t_matrixFileMap* R = NULL;
+  void* map = MAP_FAILED;
+  size_t length = 0;
+  uint8_t ok = FALSE;
+  int fd = -1;
+
+  if(!matrix_file_info(path, &H) || H.offset > SIZE_MAX - H.bytes)
+  {
+    return NULL;
+  }
+
+  length = H.offset + H.bytes;
+  fd = open(path, O_RDONLY);
+
+  if(fd < 0)
+  {
+    return NULL;
+  }
+
+  // Private mapping: clean pages are those of the page cache, shared with
+  // every process mapping the file; a write copies its page
+  map = mmap(NULL, length, PROT_READ | PROT_WRITE, MAP_PRIVATE, fd, 0);
+  close(fd);
+
+  if(map == MAP_FAILED)
+  {
+    return NULL;
+  }
+
+  R = (t_matrixFileMap*)malloc( sizeof(t_matrixFileMap) );
+
+  if(R == NULL)
+  {
+    munmap(map, length);
+
+    return NULL;
+  }
+
+  R->map = map;
+  R->length = length;
+  ok = matrix_file_wrap(&R->M, &H, (Data*)((char*)map + H.offset));
+  R->M.release = matrix_file_unmap;
+
+  if(!ok || (verify && !matrix_file_verify(&R->M, &H)))
+  {
+    Mx_Hdlr.del(&R->M);
+
+    return NULL;
+  }
+
+  return &R->M;
+#else
+  (void)verify;
+
+  return matrix_file_load(path);
+#endif
+}
+
+/**
+@brief  Reads a binary file into a heap-allocated matrix
+@param  path: File name
+@retval Pointer to matrix, NULL if the file is missing, malformed,
+        truncated, fails verification or on memory error
+*/
+Matrix matrix_file_load(const char* path)
+{
+  t_matrixFileHeader H;
+  Matrix M = NULL;
+  FILE* f = NULL;
+  uint8_t ok = FALSE;
+
+  if(!matrix_file_info(path, &H) || H.bytes > SIZE_MAX - MX_ALIGN)
+  {
+    return NULL;
+  }
+
+  M = (Matrix)malloc( sizeof(t_matrix) );
+
+  if(M == NULL)
+  {
+    return NULL;
+  }
+
+  // aligned_alloc takes whole multiples of the alignment
+  ok = matrix_file_wrap(M, &H, (Data*)aligned_alloc( MX_ALIGN,
+                        (H.bytes + MX_ALIGN - 1) / MX_ALIGN * MX_ALIGN ));
+  f = ok ? fopen(path, "rb") : NULL;
+  ok = (f != NULL && fseek(f, (long)H.offset, SEEK_SET) == 0 &&
+        fread(M->data, 1, H.bytes, f) == H.bytes &&
+        matrix_file_verify(M, &H));
+
+  if(f != NULL)
+  {
+    fclose(f);
+  }
+
+  if(!ok)
+  {
+    Mx_Hdlr.del(M);
+    M = NULL;
+  }
+
+  return M;
+}
+
+/**
+@brief  Reads and validates the header of a binary file
+@param  path: File name
+        H:    Pointer to header (output)
+@retval TRUE if header is valid and the file holds the whole payload,
+        FALSE otherwise
+*/
+uint8_t matrix_file_info(const char* path, t_matrixFileHeader* H)
+{
+  FILE* f = NULL;
+  long size = -1;                    // File size
+  uint8_t ok = FALSE;
+
+  if(path == NULL || H == NULL)
+  {
+    return FALSE;
+  }
+
+  f = fopen(path, "rb");
+
+  if(f == NULL)
+  {
+    return FALSE;
+  }
+
+  ok = (fread(H, sizeof(*H), 1, f) == 1 && fseek(f, 0, SEEK_END) == 0);
+  size = ok ? ftell(f) : -1;
+  fclose(f);
+
+  // Signature, byte order and element type first: the rest is only
+  // meaningful if they match
+  return ok && size >= 0 && memcmp(H->magic, MXF_MAGIC, sizeof(H->magic)) == 0
+         && H->version == MXF_VERSION && H->endian == MXF_ENDIAN &&
+         H->dtype == MXF_FLOAT64 && sizeof(Data) == sizeof(double) &&
+         H->offset >= sizeof(*H) && H->offset % MX_ALIGN == 0 &&
+         H->bytes != 0 && H->bytes == matrix_file_bytes(H) &&
+         H->offset <= (uint64_t)size && H->bytes <= (uint64_t)size - H->offset;
+}
+
+/**
+@brief  Checks a matrix against the payload checksum of a file header
+@param  M: Pointer to matrix read from the file (not a view)
+        H: Pointer to header
+@retval TRUE if dimensions and checksum match, FALSE otherwise
+*/
+uint8_t matrix_file_verify(Matrix M, const t_matrixFileHeader* H)
+{
+  if(M == NULL || H == NULL || M->transposed || M->rows != H->rows ||
+     M->columns != H->columns || M->ld != H->ld ||
+     (uint32_t)M->structure != H->structure || H->bytes == 0 ||
+     H->bytes != matrix_file_bytes(H))
+  {
+    return FALSE;
+  }
+
+  return matrix_file_checksum(M->data, H->bytes / sizeof(Data)) ==
+         H->checksum;
+}
+
+/**
+@brief  Out-of-core product of two matrix files: C = A * B
+@param  pathA:  File of first matrix (m x k, general storage)
+        pathB:  File of second matrix (k x n, general storage)
+        pathC:  Result file (overwritten, distinct from the operands)
+        budget: Memory budget in bytes for all tiles and buffers
+@retval TRUE if product was written, FALSE if an operand is missing,
+        malformed or structured, dimensions mismatch, the budget cannot hold
+        one row of C or on I/O or memory error
+*/
+uint8_t matrix_file_product(const char* pathA, const char* pathB,
+                            const char* pathC, size_t budget)
+{
+  static const char zero[MXF_OFFSET] = {0};     // Header padding
+  t_matrixFileHeader Ha, Hb, Hc;
+  t_matrixFileTiles cur, next;                  // Tiles in use, prefetched
+  t_matrix At, Bt, Ct;                          // Tile views
+  Data *Cp = NULL, *Ab[2] = {NULL, NULL}, *Bb[2] = {NULL, NULL};
+  FILE *fa = NULL, *fb = NULL, *fc = NULL;
+  uint64_t h[4];                                // Checksum of C
+  size_t m = 0, k = 0, n = 0, T = MXF_TILE;
+  size_t tr = 0, tk = 0, tc = 0;                // Tile sizes
+  size_t ldc = 0, lda = 0, ldb = 0, words = 0;
+  uint8_t ok = FALSE, more = FALSE, async = FALSE, ca = 0, cb = 0;
+#ifdef MXF_PREFETCH
+  pthread_t loader;
+#endif
+
+  if(pathA == NULL || pathB == NULL || pathC == NULL ||
+     strcmp(pathC, pathA) == 0 || strcmp(pathC, pathB) == 0 ||
+     !matrix_file_info(pathA, &Ha) || !matrix_file_info(pathB, &Hb) ||
+     Ha.structure != MX_GENERAL || Hb.structure != MX_GENERAL ||
+     Ha.columns != Hb.rows)
+  {
+    return FALSE;
+  }
+
+  m = Ha.rows;
+  k = Ha.columns;
+  n = Hb.columns;
+
+  // Tiles of A and B, double-buffered, take at most half of the budget;
+  // the rest holds the tallest block of rows of C that fits
+  while(T > MX_PAD && 4 * T * T * sizeof(Data) > budget / 2)
+  {
+    T /= 2;
+  }
+
+  tk = (k < T) ? k : T;
+  tc = (n < T) ? n : T;
+  lda = (tk + MX_PAD - 1) / MX_PAD * MX_PAD;
+  ldb = (tc + MX_PAD - 1) / MX_PAD * MX_PAD;
+  ldc = (n + MX_PAD - 1) / MX_PAD * MX_PAD;
+  tr = (budget / sizeof(Data) > 2 * tk * ldb) ?
+       (budget / sizeof(Data) - 2 * tk * ldb) / (ldc + 2 * lda) : 0;
+  tr = (tr < m) ? tr : m;
+
+  if(tr == 0)
+  {
+    return FALSE;
+  }
+
+  // Row padding of C stays zero: products only write the first n columns
+  Cp = (Data*)aligned_alloc( MX_ALIGN, tr * ldc * sizeof(Data) );
+  Ab[0] = (Data*)aligned_alloc( MX_ALIGN, tr * lda * sizeof(Data) );
+  Ab[1] = (Data*)aligned_alloc( MX_ALIGN, tr * lda * sizeof(Data) );
+  Bb[0] = (Data*)aligned_alloc( MX_ALIGN, tk * ldb * sizeof(Data) );
+  Bb[1] = (Data*)aligned_alloc( MX_ALIGN, tk * ldb * sizeof(Data) );
+  fa = fopen(pathA, "rb");
+  fb = fopen(pathB, "rb");
+
+  memset(&Hc, 0, sizeof(Hc));
+  memcpy(Hc.magic, MXF_MAGIC, sizeof(Hc.magic));
+  Hc.version = MXF_VERSION;
+  Hc.endian = MXF_ENDIAN;
+  Hc.dtype = MXF_FLOAT64;
+  Hc.structure = MX_GENERAL;
+  Hc.rows = m;
+  Hc.columns = n;
+  Hc.ld = ldc;
+  Hc.offset = MXF_OFFSET;
+  Hc.bytes = matrix_file_bytes(&Hc);
+
+  if(Cp != NULL)
+  {
+    memset(Cp, 0, tr * ldc * sizeof(Data));
+  }
+
+  // Header is written again with the checksum once C is complete
+  ok = (Cp != NULL && Ab[0] != NULL && Ab[1] != NULL && Bb[0] != NULL &&
+        Bb[1] != NULL && fa != NULL && fb != NULL && Hc.bytes != 0);
+  fc = ok ? fopen(pathC, "wb") : NULL;
+  ok = (fc != NULL && fwrite(&Hc, sizeof(Hc), 1, fc) == 1 &&
+        fwrite(zero, 1, MXF_OFFSET - sizeof(Hc), fc) == MXF_OFFSET -
+        sizeof(Hc));
+
+  // First step read in place
+  cur.fa = fa;
+  cur.fb = fb;
+  cur.Ha = &Ha;
+  cur.Hb = &Hb;
+  cur.i = cur.p = cur.j = 0;
+  cur.tr = tr;
+  cur.tk = tk;
+  cur.tc = tc;
+  cur.a = Ab[0];
+  cur.b = Bb[0];
+  cur.lda = lda;
+  cur.ldb = ldb;
+  cur.ok = FALSE;
+
+  if(ok)
+  {
+    matrix_file_prefetch(&cur);
+    ok = cur.ok;
+  }
+
+  matrix_file_hash_init(h);
+
+  while(ok)
+  {
+    // Next step: along the columns of B, then the depth, then the rows of C
+    next = cur;
+    next.j += tc;
+
+    if(next.j >= n)
+    {
+      next.j = 0;
+      next.p += tk;
+
+      if(next.p >= k)
+      {
+        next.p = 0;
+        next.i += tr;
+      }
+    }
+
+    more = (next.i < m);
+    next.tr = (m - next.i < tr) ? m - next.i : tr;
+    next.tk = (k - next.p < tk) ? k - next.p : tk;
+    next.tc = (n - next.j < tc) ? n - next.j : tc;
+    next.a = (next.j == 0) ? Ab[ca ^ 1] : NULL;
+    next.b = Bb[cb ^ 1];
+    next.ok = FALSE;
+
+#ifdef MXF_PREFETCH
+    async = more && pthread_create(&loader, NULL, matrix_file_prefetch,
+                                   &next) == 0;
+#endif
+
+    // C(i, j) = A(i, p) * B(p, j) + C(i, j) within the block of rows
+    matrix_file_tile(&At, Ab[ca], cur.tr, cur.tk, lda);
+    matrix_file_tile(&Bt, Bb[cb], cur.tk, cur.tc, ldb);
+    matrix_file_tile(&Ct, &Cp[cur.j], cur.tr, cur.tc, ldc);
+    ok = Mx_Hdlr.gemm(1, &At, &Bt, (cur.p == 0) ? 0 : 1, &Ct);
+
+    // Block of rows complete: append it to C (ldc is a multiple of 4 words,
+    // so blocks hash as one payload)
+    if(ok && cur.p + cur.tk >= k && cur.j + cur.tc >= n)
+    {
+      words = cur.tr * ldc;
+      matrix_file_hash(h, Cp, words);
+      ok = (fwrite(Cp, sizeof(Data), words, fc) == words);
+    }
+
+#ifdef MXF_PREFETCH
+    if(async)
+    {
+      pthread_join(loader, NULL);
+    }
+#endif
+
+    if(more && !async)
+    {
+      matrix_file_prefetch(&next);
+    }
+
+    if(!more)
+    {
+      break;
+    }
+
+    ok = ok && next.ok;
+    ca ^= (next.a != NULL);
+    cb ^= 1;
+    cur = next;
+  }
+
+  Hc.checksum = matrix_file_hash_fold(h, m * ldc);
+  ok = ok && fseek(fc, 0, SEEK_SET) == 0 && fwrite(&Hc, sizeof(Hc), 1, fc) == 1;
+
+  if(fc != NULL && (fclose(fc) != 0 || !ok))
+  {
+    ok = FALSE;
+    remove(pathC);
+  }
+
+  if(fa != NULL)
+  {
+    fclose(fa);
+  }
+
+  if(fb != NULL)
+  {
+    fclose(fb);
+  }
+
+  free(Cp);
+  free(Ab[0]);
+  free(Ab[1]);
+  free(Bb[0]);
+  free(Bb[1]);
+
+  return ok;
+}
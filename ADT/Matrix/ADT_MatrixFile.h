@@ -0,0 +1,167 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixFile.h
+ * Description   : Binary matrix files, memory-mapped loading. Header file.
+ * Version       : 01.00
+ * Revision      : 03
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _MATRIX_FILE_H_
+#define _MATRIX_FILE_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Matrix.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// File signature and format version
+#define MXF_MAGIC   "ADTMATRX"
+#define MXF_VERSION (uint32_t)(1)
+
+// Byte order marker: read back with another value on a foreign-endian host
+#define MXF_ENDIAN (uint32_t)(0x01020304)
+
+// Element types
+#define MXF_FLOAT64 (uint32_t)(1)
+
+// Payload checksum: 64-bit FNV-1a offset basis and prime
+#define MXF_FNV_BASIS (uint64_t)(0xcbf29ce484222325ULL)
+#define MXF_FNV_PRIME (uint64_t)(0x00000100000001b3ULL)
+
+// Payload offset written by matrix_file_save: the header padded to one page,
+// so the elements start page (and cache line) aligned in the mapping
+#define MXF_OFFSET (uint64_t)(4096)
+
+// Out-of-core product: largest tile side (columns of A, rows and columns
+// of B). Smaller memory budgets shrink it by halves
+#define MXF_TILE (size_t)(1024)
+
+// POSIX: memory mapping and tile prefetch thread available; elsewhere files
+// are read into the heap and tiles are read synchronously
+#if defined(__unix__) || defined(__APPLE__)
+#define MXF_MMAP
+#define MXF_PREFETCH
+#endif
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// File header (fixed-width fields, host byte order). The payload is the
+// storage of the matrix as kept in memory: rows * ld elements with row
+// padding for general matrices, the packed elements for structured ones
+typedef struct matrix_file_header
+{
+  char     magic[8];     // MXF_MAGIC (not terminated)
+  uint32_t version;      // MXF_VERSION
+  uint32_t endian;       // MXF_ENDIAN as written by the host
+  uint32_t dtype;        // Element type (MXF_FLOAT64)
+  uint32_t structure;    // t_matrixStructure of the payload
+  uint64_t rows;         // Number of rows
+  uint64_t columns;      // Number of columns
+  uint64_t ld;           // Row stride (general), band row width (banded)
+  uint64_t kl;           // Banded: sub-diagonals
+  uint64_t ku;           // Banded: super-diagonals
+  uint64_t offset;       // Payload offset from the file start (MX_ALIGN
+                         // multiple)
+  uint64_t bytes;        // Payload size
+  uint64_t checksum;     // Checksum of the payload
+}
+t_matrixFileHeader;
+
+// Matrix file handler
+typedef struct matrix_file_handler
+{
+  uint8_t (*save)(Matrix M, const char* path);                  // Write file
+  Matrix  (*map)(const char* path, uint8_t verify);             // Map file
+  Matrix  (*load)(const char* path);                            // Read file
+  uint8_t (*info)(const char* path, t_matrixFileHeader* H);     // Header
+  uint8_t (*verify)(Matrix M, const t_matrixFileHeader* H);     // Checksum
+  uint8_t (*product)(const char* pathA, const char* pathB,      // File
+                     const char* pathC, size_t budget);         // product
+}
+t_MatrixFileHandler;
+
+extern t_MatrixFileHandler MxF_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Writes a matrix to a binary file
+@param  M:    Pointer to matrix (any storage, or view)
+        path: File name (overwritten)
+@retval TRUE if file was written, FALSE on I/O or memory error
+@note   Views are written as the matrix they show, in row-major order
+*/
+extern uint8_t matrix_file_save(Matrix M, const char* path);
+
+/**
+@brief  Maps a binary file as a matrix, without copying its elements
+@param  path:   File name
+        verify: TRUE to check the payload checksum (reads every page)
+@retval Pointer to matrix, NULL if the file is missing, malformed,
+        truncated, fails verification or on memory error
+@note   Elements are read from the page cache on first touch, so opening
+        costs O(1) plus the row pointers, and processes mapping the same
+        file share its pages. The mapping is private: the file is never
+        modified, writes to the matrix stay in the process (raw writes
+        through M->data / M->matrix need matrix_touch, as for any matrix).
+        Delete the matrix with Mx_Hdlr.del (the mapping is released with
+        it). Without MXF_MMAP the file is read into the heap
+*/
+extern Matrix matrix_file_map(const char* path, uint8_t verify);
+
+/**
+@brief  Reads a binary file into a heap-allocated matrix
+@param  path: File name
+@retval Pointer to matrix, NULL if the file is missing, malformed,
+        truncated, fails verification or on memory error
+@note   One sequential read plus the checksum
+*/
+extern Matrix matrix_file_load(const char* path);
+
+/**
+@brief  Reads and validates the header of a binary file
+@param  path: File name
+        H:    Pointer to header (output)
+@retval TRUE if header is valid and the file holds the whole payload,
+        FALSE otherwise
+*/
+extern uint8_t matrix_file_info(const char* path, t_matrixFileHeader* H);
+
+/**
+@brief  Checks a matrix against the payload checksum of a file header
+@param  M: Pointer to matrix read from the file (not a view)
+        H: Pointer to header
+@retval TRUE if dimensions and checksum match, FALSE otherwise
+*/
+extern uint8_t matrix_file_verify(Matrix M, const t_matrixFileHeader* H);
+
+/**
+@brief  Out-of-core product of two matrix files: C = A * B
+@param  pathA:  File of first matrix (m x k, general storage)
+        pathB:  File of second matrix (k x n, general storage)
+        pathC:  Result file (overwritten)
+        budget: Memory budget in bytes for all tiles and buffers
+@retval TRUE if product was written, FALSE if an operand is missing,
+        malformed or structured, dimensions mismatch, the budget cannot hold
+        one row of C or on I/O or memory error
+@note   C is computed one block of rows at a time, as tall as the budget
+        allows; A and B are streamed in tiles of at most MXF_TILE sides
+        while the next tiles are read by a prefetch thread. B is read once
+        per block of rows of C. Operands need not fit in memory
+*/
+extern uint8_t matrix_file_product(const char* pathA, const char* pathB,
+                                   const char* pathC, size_t budget);
+
+#endif
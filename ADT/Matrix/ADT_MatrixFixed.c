@@ -0,0 +1,48 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixFixed.c
+ * Description   : Fixed-size square matrices (2 x 2 to 8 x 8). Library file.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_MatrixFixed.h"
+
+//----------------------------------------------------------------------------//
+//                              Instantiations                                //
+//----------------------------------------------------------------------------//
+
+#define MF_N 2
+#include"ADT_MatrixFixedTemplate.inc"
+#undef MF_N
+
+#define MF_N 3
+#include"ADT_MatrixFixedTemplate.inc"
+#undef MF_N
+
+#define MF_N 4
+#include"ADT_MatrixFixedTemplate.inc"
+#undef MF_N
+
+#define MF_N 5
+#include"ADT_MatrixFixedTemplate.inc"
+#undef MF_N
+
+#define MF_N 6
+#include"ADT_MatrixFixedTemplate.inc"
+#undef MF_N
+
+#define MF_N 7
+#include"ADT_MatrixFixedTemplate.inc"
+#undef MF_N
+
+#define MF_N 8
+#include"ADT_MatrixFixedTemplate.inc"
+#undef MF_N
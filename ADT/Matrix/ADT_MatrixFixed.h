@@ -0,0 +1,64 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixFixed.h
+ * Description   : Fixed-size square matrices (2 x 2 to 8 x 8). Header file.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _MATRIX_FIXED_H_
+#define _MATRIX_FIXED_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Matrix.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Name generation: MF_N is the dimension (t_mat3, mat3_product...)
+#define MF_CAT_(a, b, c) a##b##c
+#define MF_CAT(a, b, c)  MF_CAT_(a, b, c)
+#define MF_T             MF_CAT(t_mat, MF_N, )
+#define MF_FN(name)      MF_CAT(mat, MF_N, _##name)
+
+//----------------------------------------------------------------------------//
+//                              Instantiations                                //
+//----------------------------------------------------------------------------//
+
+// t_mat2 ... t_mat8 and their functions mat2_* ... mat8_*
+#define MF_N 2
+#include"ADT_MatrixFixedTemplate.h"
+#undef MF_N
+
+#define MF_N 3
+#include"ADT_MatrixFixedTemplate.h"
+#undef MF_N
+
+#define MF_N 4
+#include"ADT_MatrixFixedTemplate.h"
+#undef MF_N
+
+#define MF_N 5
+#include"ADT_MatrixFixedTemplate.h"
+#undef MF_N
+
+#define MF_N 6
+#include"ADT_MatrixFixedTemplate.h"
+#undef MF_N
+
+#define MF_N 7
+#include"ADT_MatrixFixedTemplate.h"
+#undef MF_N
+
+#define MF_N 8
+#include"ADT_MatrixFixedTemplate.h"
+#undef MF_N
+
+#endif
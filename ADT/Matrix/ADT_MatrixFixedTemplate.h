@@ -0,0 +1,60 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_MatrixFixedTemplate.h
+ * Description   : Fixed-size square matrices. Declaration template.
+ * Version       : 01.00
+ * Revision      : 00
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+// No include guard: instantiated once per size by ADT_MatrixFixed.h with
+// MF_N (dimension) defined.
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// MF_N x MF_N matrix held by value (row-major, no padding, no allocation)
+typedef struct
+{
+  Data m[MF_N][MF_N];   // Elements (row, column)
+}
+MF_T;
+
+//----------------------------------------------------------------------------//
+//                         Public functions (by value)                        //
+//----------------------------------------------------------------------------//
+
+// Operands and results are passed by value; every loop runs MF_N times, so
+// the compiler unrolls it completely. inv returns FALSE (and R untouched)
+// for a singular matrix; det and inv are closed-form up to 4 x 4, Gaussian
+// elimination with partial pivoting above
+extern MF_T    MF_FN(zero)(void);
+extern MF_T    MF_FN(eye)(void);
+extern uint8_t MF_FN(areEqual)(MF_T A, MF_T B);
+extern MF_T    MF_FN(sum)(MF_T A, MF_T B);
+extern MF_T    MF_FN(scalar)(Data k, MF_T A);
+extern MF_T    MF_FN(product)(MF_T A, MF_T B);
+extern void    MF_FN(apply)(MF_T A, const Data* x, Data* y);       // y = A x
+extern MF_T    MF_FN(transp)(MF_T A);
+extern Data    MF_FN(det)(MF_T A);
+extern uint8_t MF_FN(inv)(MF_T A, MF_T* R);
+
+// Conversions with t_matrix (any storage or view of matching dimensions)
+extern uint8_t MF_FN(from_matrix)(Matrix M, MF_T* R);
+extern Matrix  MF_FN(to_matrix)(MF_T A);
+
+//----------------------------------------------------------------------------//
+//                        Public functions (batches)                          //
+//----------------------------------------------------------------------------//
+
+// Element-wise over arrays of count matrices: R[t] = op(A[t], B[t]). One call
+// per array instead of per matrix; results may overwrite an operand array.
+// batch_inv returns the number of singular matrices (their inverse is zero)
+extern void    MF_FN(batch_product)(const MF_T* A, const MF_T* B, MF_T* R,
+                                    size_t count);
+extern void    MF_FN(batch_transp)(const MF_T* A, MF_T* R, size_t count);
+extern void    MF_FN(batch_det)(const MF_T* A, Data* d, size_t count);
+extern size_t  MF_FN(batch_inv)(const MF_T* A, MF_T* R, size_t count);
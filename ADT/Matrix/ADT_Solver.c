@@ -0,0 +1,996 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_Solver.c
+ * Description   : Iterative solvers for linear systems. Library file.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Solver.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Solver handler
+t_SolverHandler Slv_Hdlr =
+{
+  solver_dense,             // Dense system
+  solver_sparse,            // Sparse system
+  solver_setTolerance,      // Tolerance and iteration limit
+  solver_setRestart,        // GMRES restart length
+  solver_setPrecond,        // Preconditioner
+  solver_cg,                // Conjugate gradient
+  solver_bicgstab,          // BiCGSTAB
+  solver_gmres,             // GMRES(m)
+  solver_getIterations,     // Iterations
+  solver_getResidual,       // Residual
+  solver_getHistory,        // Residual history
+  solver_delete             // Delete solver
+};
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Dot product of two vector segments
+@param  n:    Number of elements
+        x, y: Vectors
+@retval Sum of x[i] * y[i]
+@note   Eight independent partial sums: one SIMD accumulator
+*/
+MX_KERNEL_CLONES
+Data solver_dot_kernel(size_t n, const Data* restrict x, const Data* restrict y)
+{
+  Data s[8] = {0, 0, 0, 0, 0, 0, 0, 0};
+  size_t i = 0, l = 0;
+
+  for(i = 0; i + 8 <= n; i += 8)
+  {
+    for(l = 0; l < 8; l++)
+    {
+      s[l] += x[i + l] * y[i + l];
+    }
+  }
+
+  for(; i < n; i++)
+  {
+    s[0] += x[i] * y[i];
+  }
+
+  return ((s[0] + s[4]) + (s[1] + s[5])) + ((s[2] + s[6]) + (s[3] + s[7]));
+}
+
+/**
+@brief  Vector update segment y = a x + b y
+@param  n:    Number of elements
+        a, b: Scales
+        x, y: Vectors (may be the same)
+@retval none
+*/
+MX_KERNEL_CLONES
+void solver_update_kernel(size_t n, Data a, const Data* x, Data b, Data* y)
+{
+  size_t i = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    y[i] = a * x[i] + b * y[i];
+  }
+}
+
+/**
+@brief  Dot product, chunks in parallel
+@param  n:    Number of elements
+        x, y: Vectors
+@retval x . y
+*/
+Data solver_dot(size_t n, const Data* x, const Data* y)
+{
+  Data s = 0;
+  size_t i = 0;
+
+  #pragma omp parallel for reduction(+:s) schedule(static) \
+                           if(n >= SLV_PARALLEL_MIN)
+  for(i = 0; i < n; i += SLV_CHUNK)
+  {
+    s += solver_dot_kernel((n - i < SLV_CHUNK) ? n - i : SLV_CHUNK,
+                           &x[i], &y[i]);
+  }
+
+  return s;
+}
+
+/**
+@brief  Vector update y = a x + b y, chunks in parallel
+@param  n:    Number of elements
+        a, b: Scales
+        x, y: Vectors (may be the same)
+@retval none
+*/
+void solver_update(size_t n, Data a, const Data* x, Data b, Data* y)
+{
+  size_t i = 0;
+
+  #pragma omp parallel for schedule(static) if(n >= SLV_PARALLEL_MIN)
+  for(i = 0; i < n; i += SLV_CHUNK)
+  {
+    solver_update_kernel((n - i < SLV_CHUNK) ? n - i : SLV_CHUNK,
+                         a, &x[i], b, &y[i]);
+  }
+}
+
+/**
+@brief  Operator product y = A x
+@param  L: Pointer to solver
+        x: Input vector
+        y: Output vector, distinct from x
+@retval none
+*/
+void solver_matvec(Solver L, const Data* x, Data* y)
+{
+  size_t i = 0;
+
+  if(L->S != NULL)
+  {
+    smatrix_spmv(1.0, L->S, (Vector)x, 0.0, y);
+    return;
+  }
+
+  #pragma omp parallel for schedule(static) \
+                           if(L->n * L->n >= SLV_PARALLEL_MIN)
+  for(i = 0; i < L->n; i++)
+  {
+    y[i] = solver_dot_kernel(L->n, &L->A->data[i * L->A->ld], x);
+  }
+}
+
+/**
+@brief  Preconditioner application z = M^-1 r
+@param  L: Pointer to solver
+        r: Input vector
+        z: Output vector, distinct from r
+@retval none
+@note   ILU(0) triangular solves are sequential by nature
+*/
+void solver_apply(Solver L, const Data* r, Data* z)
+{
+  SMatrix F = L->ilu;
+  size_t i = 0, p = 0;
+  Data s = 0;
+
+  switch(L->precond)
+  {
+    case SLV_JACOBI:
+      #pragma omp parallel for schedule(static) if(L->n >= SLV_PARALLEL_MIN)
+      for(i = 0; i < L->n; i++)
+      {
+        z[i] = L->dinv[i] * r[i];
+      }
+      break;
+
+    case SLV_ILU0:
+      // L z = r (unit diagonal)
+      for(i = 0; i < L->n; i++)
+      {
+        for(p = F->row[i], s = r[i]; p < L->diag[i]; p++)
+        {
+          s -= F->val[p] * z[F->col[p]];
+        }
+
+        z[i] = s;
+      }
+
+      // U z = z
+      for(i = L->n; i-- > 0; )
+      {
+        for(p = L->diag[i] + 1, s = z[i]; p < F->row[i + 1]; p++)
+        {
+          s -= F->val[p] * z[F->col[p]];
+        }
+
+        z[i] = s / F->val[L->diag[i]];
+      }
+      break;
+
+    default:
+      memcpy(z, r, L->n * sizeof(Data));
+      break;
+  }
+}
+
+/**
+@brief  Residual r = b - A x
+@param  L: Pointer to solver
+        b: Right-hand side
+        x: Current solution
+        r: Residual (output)
+@retval |r|
+*/
+double solver_residual(Solver L, const Data* b, const Data* x, Data* r)
+{
+  solver_matvec(L, x, r);
+  solver_update(L->n, 1.0, b, -1.0, r);
+
+  return sqrt(solver_dot(L->n, r, r));
+}
+
+/**
+@brief  Allocates k work vectors of n elements in one block
+@param  n: Vector length
+        k: Number of vectors
+@retval Pointer to work block, NULL on memory error
+*/
+Data* solver_work(size_t n, size_t k)
+{
+  if(n > SIZE_MAX / sizeof(Data) / k)
+  {
+    return NULL;
+  }
+
+  return (Data*)calloc(n * k, sizeof(Data));
+}
+
+/**
+@brief  Starts a run: resets the report and handles a zero right-hand side
+@param  L: Pointer to solver
+        b: Right-hand side
+        x: Solution vector
+@retval |b|, 0 if there is nothing to iterate (invalid arguments or b = 0,
+        in which case x = 0 and the run has converged)
+*/
+double solver_start(Solver L, Vector b, Vector x)
+{
+  double bn = 0;
+
+  if(L == NULL)
+  {
+    return 0;
+  }
+
+  L->iterations = 0;
+  L->residual = 0;
+  L->converged = FALSE;
+  L->history[0] = 0;
+
+  if(b == NULL || x == NULL || b == x)
+  {
+    return 0;
+  }
+
+  bn = sqrt(solver_dot(L->n, b, b));
+
+  if(bn == 0)
+  {
+    memset(x, 0, L->n * sizeof(Data));
+    L->converged = TRUE;
+  }
+
+  return bn;
+}
+
+/**
+@brief  Computes the ILU(0) factors of the operator
+@param  L: Pointer to solver
+@retval TRUE if factors exist, FALSE on a missing diagonal or zero pivot
+@note   Row-by-row (IKJ) elimination restricted to the pattern of A
+*/
+uint8_t solver_ilu0(Solver L)
+{
+  SMatrix F = NULL;
+  size_t *d = NULL, *iw = NULL;
+  size_t n = L->n, i = 0, k = 0, p = 0, q = 0;
+  uint8_t ok = TRUE;
+
+  F = (L->S != NULL) ? smatrix_toCSR(L->S) : smatrix_fromDense(L->A);
+  d = (size_t*)malloc( n * sizeof(size_t) );
+  iw = (size_t*)malloc( n * sizeof(size_t) );
+
+  if(F == NULL || d == NULL || iw == NULL)
+  {
+    smatrix_delete(F);
+    free(d);
+    free(iw);
+
+    return FALSE;
+  }
+
+  for(i = 0; i < n; i++)
+  {
+    iw[i] = SIZE_MAX;
+    d[i] = SIZE_MAX;
+
+    for(p = F->row[i]; p < F->row[i + 1]; p++)
+    {
+      d[i] = (F->col[p] == i) ? p : d[i];
+    }
+
+    ok = ok && (d[i] != SIZE_MAX);
+  }
+
+  for(i = 0; i < n && ok; i++)
+  {
+    // Position of every column of row i
+    for(p = F->row[i]; p < F->row[i + 1]; p++)
+    {
+      iw[F->col[p]] = p;
+    }
+
+    // Eliminates columns k < i with the rows already factored
+    for(p = F->row[i]; p < d[i]; p++)
+    {
+      k = F->col[p];
+      F->val[p] /= F->val[d[k]];
+
+      for(q = d[k] + 1; q < F->row[k + 1]; q++)
+      {
+        if(iw[F->col[q]] != SIZE_MAX)
+        {
+          F->val[iw[F->col[q]]] -= F->val[p] * F->val[q];
+        }
+      }
+    }
+
+    for(p = F->row[i]; p < F->row[i + 1]; p++)
+    {
+      iw[F->col[p]] = SIZE_MAX;
+    }
+
+    ok = (F->val[d[i]] != 0);
+  }
+
+  free(iw);
+
+  if(!ok)
+  {
+    smatrix_delete(F);
+    free(d);
+
+    return FALSE;
+  }
+
+  L->ilu = F;
+  L->diag = d;
+
+  return TRUE;
+}
+
+/**
+@brief  Allocates a solver with default controls
+@param  n: System dimension
+@retval Pointer to new solver, NULL on memory error
+*/
+Solver solver_alloc(size_t n)
+{
+  Solver L = (Solver)malloc( sizeof(t_solver) );
+
+  if(L == NULL)
+  {
+    return NULL;
+  }
+
+  L->n = n;
+  L->A = NULL;
+  L->S = NULL;
+  L->owner = FALSE;
+  L->precond = SLV_NONE;
+  L->dinv = NULL;
+  L->ilu = NULL;
+  L->diag = NULL;
+  L->tol = SLV_TOL;
+  L->maxIter = SLV_MAX_ITER;
+  L->restart = SLV_RESTART;
+  L->iterations = 0;
+  L->residual = 0;
+  L->converged = FALSE;
+  L->history = (Vector)malloc( (SLV_MAX_ITER + 1) * sizeof(Data) );
+
+  if(L->history == NULL)
+  {
+    free(L);
+
+    return NULL;
+  }
+
+  L->history[0] = 0;
+
+  return L;
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Creates a solver for a dense system A x = b
+@param  A: Pointer to square matrix (or view, any storage)
+@retval Pointer to new solver, NULL if A is not square or on memory error
+@note   A is referenced, not copied (transposed views and structured storage
+        are materialized): it must outlive the solver, and a new
+        preconditioner must be set after it changes
+*/
+Solver solver_dense(Matrix A)
+{
+  Solver L = NULL;
+
+  if(A == NULL || A->rows != A->columns)
+  {
+    return NULL;
+  }
+
+  L = solver_alloc(A->rows);
+
+  if(L == NULL)
+  {
+    return NULL;
+  }
+
+  // Row-major operator: transposed views and packed storage are copied
+  // once; block views are read in place
+  if(A->transposed || A->structure != MX_GENERAL)
+  {
+    L->A = Mx_Hdlr.unpack(A);
+    L->owner = TRUE;
+  }
+  else
+  {
+    L->A = A;
+  }
+
+  if(L->A == NULL)
+  {
+    solver_delete(L);
+
+    return NULL;
+  }
+
+  return L;
+}
+
+/**
+@brief  Creates a solver for a sparse system A x = b
+@param  A: Pointer to square sparse matrix (any format)
+@retval Pointer to new solver, NULL if A is not square or on memory error
+@note   The solver keeps a CSR copy of A
+*/
+Solver solver_sparse(SMatrix A)
+{
+  Solver L = NULL;
+
+  if(A == NULL || A->rows != A->columns)
+  {
+    return NULL;
+  }
+
+  L = solver_alloc(A->rows);
+
+  if(L != NULL)
+  {
+    L->S = smatrix_toCSR(A);
+
+    if(L->S == NULL)
+    {
+      solver_delete(L);
+      L = NULL;
+    }
+  }
+
+  return L;
+}
+
+/**
+@brief  Sets the tolerance and the iteration limit
+@param  L:       Pointer to solver
+        tol:     Relative residual |b - A x| / |b| to reach (> 0)
+        maxIter: Max. iterations (> 0)
+@retval TRUE if controls were set, FALSE otherwise
+*/
+uint8_t solver_setTolerance(Solver L, double tol, size_t maxIter)
+{
+  Vector h = NULL;
+
+  if(L == NULL || !(tol > 0) || maxIter == 0 ||
+     maxIter >= SIZE_MAX / sizeof(Data))
+  {
+    return FALSE;
+  }
+
+  h = (Vector)realloc(L->history, (maxIter + 1) * sizeof(Data));
+
+  if(h == NULL)
+  {
+    return FALSE;
+  }
+
+  L->history = h;
+  L->tol = tol;
+  L->maxIter = maxIter;
+  L->iterations = 0;
+
+  return TRUE;
+}
+
+/**
+@brief  Sets the GMRES restart length
+@param  L:       Pointer to solver
+        restart: Krylov vectors kept between restarts (> 0)
+@retval TRUE if restart was set, FALSE otherwise
+*/
+uint8_t solver_setRestart(Solver L, size_t restart)
+{
+  if(L == NULL || restart == 0 || restart >= SIZE_MAX / sizeof(Data) / 4)
+  {
+    return FALSE;
+  }
+
+  L->restart = restart;
+
+  return TRUE;
+}
+
+/**
+@brief  Builds a preconditioner
+@param  L:       Pointer to solver
+        precond: SLV_NONE, SLV_JACOBI or SLV_ILU0
+@retval TRUE if preconditioner was built, FALSE on a zero diagonal / pivot
+        (the solver is left without preconditioner)
+@note   ILU(0) keeps the sparsity pattern of A (dense systems: the pattern
+        of their nonzeros)
+*/
+uint8_t solver_setPrecond(Solver L, t_solverPrecond precond)
+{
+  size_t i = 0;
+  Data a = 0;
+  uint8_t ok = TRUE;
+
+  if(L == NULL)
+  {
+    return FALSE;
+  }
+
+  // Drops the previous preconditioner
+  free(L->dinv);
+  smatrix_delete(L->ilu);
+  free(L->diag);
+  L->dinv = NULL;
+  L->ilu = NULL;
+  L->diag = NULL;
+  L->precond = SLV_NONE;
+
+  if(precond == SLV_JACOBI)
+  {
+    L->dinv = (Vector)malloc( L->n * sizeof(Data) );
+    ok = (L->dinv != NULL);
+
+    for(i = 0; i < L->n && ok; i++)
+    {
+      if(L->S != NULL)
+      {
+        smatrix_get(L->S, i, i, &a);
+      }
+      else
+      {
+        a = L->A->data[i * L->A->ld + i];
+      }
+
+      ok = (a != 0);
+      L->dinv[i] = ok ? 1.0 / a : 0;
+    }
+
+    if(!ok)
+    {
+      free(L->dinv);
+      L->dinv = NULL;
+    }
+  }
+  else if(precond == SLV_ILU0)
+  {
+    ok = solver_ilu0(L);
+  }
+
+  L->precond = ok ? precond : SLV_NONE;
+
+  return ok;
+}
+
+/**
+@brief  Preconditioned conjugate gradient (A symmetric positive definite)
+@param  L: Pointer to solver
+        b: Right-hand side (n elements)
+        x: Initial guess on input, solution on output (n elements)
+@retval TRUE if the tolerance was reached, FALSE otherwise
+@note   The preconditioner must be symmetric: Jacobi, or ILU(0) of a
+        symmetric A (L D L^T, i.e. incomplete Cholesky)
+*/
+uint8_t solver_cg(Solver L, Vector b, Vector x)
+{
+  Data *w = NULL, *r = NULL, *z = NULL, *p = NULL, *q = NULL;
+  double bn = 0, res = 0, rz = 0, rzOld = 0, pq = 0, alpha = 0;
+  size_t n = 0, it = 0;
+
+  bn = solver_start(L, b, x);
+
+  if(bn == 0)
+  {
+    return (L != NULL) ? L->converged : FALSE;
+  }
+
+  n = L->n;
+  w = solver_work(n, 4);
+
+  if(w == NULL)
+  {
+    return FALSE;
+  }
+
+  r = w;
+  z = w + n;
+  p = w + 2 * n;
+  q = w + 3 * n;
+
+  res = solver_residual(L, b, x, r) / bn;
+  L->history[0] = res;
+  solver_apply(L, r, z);
+  memcpy(p, z, n * sizeof(Data));
+  rz = solver_dot(n, r, z);
+
+  while(it < L->maxIter && res > L->tol)
+  {
+    solver_matvec(L, p, q);
+    pq = solver_dot(n, p, q);
+
+    // Breakdown: A (or M) is not positive definite
+    if(pq == 0)
+    {
+      break;
+    }
+
+    alpha = rz / pq;
+    solver_update(n, alpha, p, 1.0, x);
+    solver_update(n, -alpha, q, 1.0, r);
+    res = sqrt(solver_dot(n, r, r)) / bn;
+    L->history[++it] = res;
+
+    if(res <= L->tol)
+    {
+      break;
+    }
+
+    // p = z + (rz_new / rz) p
+    solver_apply(L, r, z);
+    rzOld = rz;
+    rz = solver_dot(n, r, z);
+    solver_update(n, 1.0, z, rz / rzOld, p);
+  }
+
+  L->iterations = it;
+  L->converged = (res <= L->tol);
+  L->residual = solver_residual(L, b, x, r) / bn;
+  free(w);
+
+  return L->converged;
+}
+
+/**
+@brief  BiCGSTAB, right preconditioned (general nonsymmetric A)
+@param  L: Pointer to solver
+        b: Right-hand side (n elements)
+        x: Initial guess on input, solution on output (n elements)
+@retval TRUE if the tolerance was reached, FALSE otherwise (including
+        breakdown)
+*/
+uint8_t solver_bicgstab(Solver L, Vector b, Vector x)
+{
+  Data *w = NULL, *r = NULL, *rh = NULL, *p = NULL, *v = NULL, *ph = NULL,
+       *sh = NULL, *t = NULL;
+  double bn = 0, res = 0, rho = 1, rhoOld = 1, alpha = 1, omega = 1,
+         beta = 0, rv = 0, tt = 0;
+  size_t n = 0, it = 0;
+
+  bn = solver_start(L, b, x);
+
+  if(bn == 0)
+  {
+    return (L != NULL) ? L->converged : FALSE;
+  }
+
+  n = L->n;
+  w = solver_work(n, 7);
+
+  if(w == NULL)
+  {
+    return FALSE;
+  }
+
+  r = w;
+  rh = w + n;
+  p = w + 2 * n;
+  v = w + 3 * n;
+  ph = w + 4 * n;
+  sh = w + 5 * n;
+  t = w + 6 * n;
+
+  res = solver_residual(L, b, x, r) / bn;
+  L->history[0] = res;
+  memcpy(rh, r, n * sizeof(Data));
+
+  while(it < L->maxIter && res > L->tol)
+  {
+    rho = solver_dot(n, rh, r);
+
+    // Breakdown: r orthogonal to the shadow residual
+    if(rho == 0)
+    {
+      break;
+    }
+
+    // p = r + beta (p - omega v)
+    beta = (rho / rhoOld) * (alpha / omega);
+    solver_update(n, -omega, v, 1.0, p);
+    solver_update(n, 1.0, r, beta, p);
+
+    solver_apply(L, p, ph);
+    solver_matvec(L, ph, v);
+    rv = solver_dot(n, rh, v);
+
+    if(rv == 0)
+    {
+      break;
+    }
+
+    // s = r - alpha v (kept in r)
+    alpha = rho / rv;
+    solver_update(n, -alpha, v, 1.0, r);
+    solver_update(n, alpha, ph, 1.0, x);
+    res = sqrt(solver_dot(n, r, r)) / bn;
+
+    if(res <= L->tol)
+    {
+      L->history[++it] = res;
+      break;
+    }
+
+    solver_apply(L, r, sh);
+    solver_matvec(L, sh, t);
+    tt = solver_dot(n, t, t);
+    omega = (tt != 0) ? solver_dot(n, t, r) / tt : 0;
+
+    // r = s - omega t
+    solver_update(n, omega, sh, 1.0, x);
+    solver_update(n, -omega, t, 1.0, r);
+    res = sqrt(solver_dot(n, r, r)) / bn;
+    L->history[++it] = res;
+    rhoOld = rho;
+
+    // Breakdown: no progress in the stabilization step
+    if(omega == 0)
+    {
+      break;
+    }
+  }
+
+  L->iterations = it;
+  L->converged = (res <= L->tol);
+  L->residual = solver_residual(L, b, x, r) / bn;
+  free(w);
+
+  return L->converged;
+}
+
+/**
+@brief  Restarted GMRES(m), right preconditioned (general nonsymmetric A)
+@param  L: Pointer to solver
+        b: Right-hand side (n elements)
+        x: Initial guess on input, solution on output (n elements)
+@retval TRUE if the tolerance was reached, FALSE otherwise
+@note   Modified Gram-Schmidt with Givens rotations: the residual of every
+        inner iteration is known without forming x
+*/
+uint8_t solver_gmres(Solver L, Vector b, Vector x)
+{
+  Data *w = NULL, *V = NULL, *z = NULL, *r = NULL, *H = NULL, *cs = NULL,
+       *sn = NULL, *g = NULL, *y = NULL;
+  double bn = 0, res = 0, beta = 0, h = 0, d = 0;
+  size_t n = 0, m = 0, it = 0, i = 0, j = 0, k = 0;
+  uint8_t stall = FALSE;
+
+  bn = solver_start(L, b, x);
+
+  if(bn == 0)
+  {
+    return (L != NULL) ? L->converged : FALSE;
+  }
+
+  n = L->n;
+  m = L->restart;
+  w = solver_work(n, m + 3);
+
+  // Hessenberg matrix H(i, j) = H[i + j (m + 1)], rotations, g and y
+  H = (Data*)calloc((m + 1) * (m + 4), sizeof(Data));
+
+  if(w == NULL || H == NULL)
+  {
+    free(w);
+    free(H);
+
+    return FALSE;
+  }
+
+  V = w;
+  z = w + (m + 1) * n;
+  r = w + (m + 2) * n;
+  cs = H + (m + 1) * m;
+  sn = cs + (m + 1);
+  g = sn + (m + 1);
+  y = g + (m + 1);
+
+  // Each cycle starts from the true residual
+  res = solver_residual(L, b, x, V) / bn;
+  L->history[0] = res;
+
+  while(it < L->maxIter && res > L->tol && !stall)
+  {
+    beta = res * bn;
+    solver_update(n, 1.0 / beta, V, 0.0, V);
+    memset(g, 0, (m + 1) * sizeof(Data));
+    g[0] = beta;
+
+    for(j = 0, k = 0; j < m && it < L->maxIter; j++)
+    {
+      // w = A M^-1 v_j, orthogonalized against v_0..v_j
+      solver_apply(L, &V[j * n], z);
+      solver_matvec(L, z, &V[(j + 1) * n]);
+
+      for(i = 0; i <= j; i++)
+      {
+        h = solver_dot(n, &V[(j + 1) * n], &V[i * n]);
+        H[i + j * (m + 1)] = h;
+        solver_update(n, -h, &V[i * n], 1.0, &V[(j + 1) * n]);
+      }
+
+      h = sqrt(solver_dot(n, &V[(j + 1) * n], &V[(j + 1) * n]));
+      H[j + 1 + j * (m + 1)] = h;
+
+      if(h != 0)
+      {
+        solver_update(n, 1.0 / h, &V[(j + 1) * n], 0.0, &V[(j + 1) * n]);
+      }
+
+      // Previous rotations on column j, then the one zeroing H(j + 1, j)
+      for(i = 0; i < j; i++)
+      {
+        d = cs[i] * H[i + j * (m + 1)] + sn[i] * H[i + 1 + j * (m + 1)];
+        H[i + 1 + j * (m + 1)] = -sn[i] * H[i + j * (m + 1)] +
+                                  cs[i] * H[i + 1 + j * (m + 1)];
+        H[i + j * (m + 1)] = d;
+      }
+
+      d = hypot(H[j + j * (m + 1)], h);
+      it++;
+
+      // Singular Hessenberg matrix: no further progress possible
+      if(d == 0)
+      {
+        stall = TRUE;
+        L->history[it] = res;
+        break;
+      }
+
+      cs[j] = H[j + j * (m + 1)] / d;
+      sn[j] = h / d;
+      H[j + j * (m + 1)] = d;
+      H[j + 1 + j * (m + 1)] = 0;
+      g[j + 1] = -sn[j] * g[j];
+      g[j] = cs[j] * g[j];
+
+      res = fabs(g[j + 1]) / bn;
+      L->history[it] = res;
+      k = j + 1;
+
+      // Converged or invariant subspace found (exact solution)
+      if(res <= L->tol || h == 0)
+      {
+        break;
+      }
+    }
+
+    // H(0:k, 0:k) y = g, then x = x + M^-1 V y
+    for(i = k; i-- > 0; )
+    {
+      for(j = i + 1, d = g[i]; j < k; j++)
+      {
+        d -= H[i + j * (m + 1)] * y[j];
+      }
+
+      y[i] = d / H[i + i * (m + 1)];
+    }
+
+    memset(z, 0, n * sizeof(Data));
+
+    for(i = 0; i < k; i++)
+    {
+      solver_update(n, y[i], &V[i * n], 1.0, z);
+    }
+
+    solver_apply(L, z, r);
+    solver_update(n, 1.0, r, 1.0, x);
+
+    // Restart from the true residual
+    res = solver_residual(L, b, x, V) / bn;
+    L->history[it] = res;
+  }
+
+  L->iterations = it;
+  L->residual = res;
+  L->converged = (res <= L->tol);
+  free(w);
+  free(H);
+
+  return L->converged;
+}
+
+/**
+@brief  Gets the iterations of the last run
+@param  L: Pointer to solver
+@retval Number of iterations
+*/
+size_t solver_getIterations(Solver L)
+{
+  return (L != NULL) ? L->iterations : 0;
+}
+
+/**
+@brief  Gets the true relative residual |b - A x| / |b| of the last run
+@param  L: Pointer to solver
+@retval Relative residual
+*/
+double solver_getResidual(Solver L)
+{
+  return (L != NULL) ? L->residual : 0;
+}
+
+/**
+@brief  Gets the residual history of the last run
+@param  L: Pointer to solver
+@retval Relative residual per iteration (iterations + 1 elements, owned by
+        the solver)
+*/
+Vector solver_getHistory(Solver L)
+{
+  return (L != NULL) ? L->history : NULL;
+}
+
+/**
+@brief  Deletes solver and frees allocated memory
+@param  L: Pointer to solver
+@retval TRUE if solver was deleted with no error, FALSE otherwise
+*/
+uint8_t solver_delete(Solver L)
+{
+  if(L != NULL)
+  {
+    if(L->owner)
+    {
+      Mx_Hdlr.del(L->A);
+    }
+
+    smatrix_delete(L->S);
+    smatrix_delete(L->ilu);
+    free(L->dinv);
+    free(L->diag);
+    free(L->history);
+    free(L);
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
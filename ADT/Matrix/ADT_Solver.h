@@ -0,0 +1,205 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_Solver.h
+ * Description   : Iterative solvers for linear systems. Header file.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _SOLVER_H_
+#define _SOLVER_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_SparseMatrix.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Default relative residual |b - A x| / |b| and iteration limit
+#define SLV_TOL      (double)(1e-8)
+#define SLV_MAX_ITER (size_t)(1000)
+
+// Default GMRES restart length (Krylov vectors kept)
+#define SLV_RESTART (size_t)(30)
+
+// Min. vector length to run dot products and updates with OpenMP threads
+#define SLV_PARALLEL_MIN (size_t)(1 << 15)
+
+// Vector elements per OpenMP chunk
+#define SLV_CHUNK (size_t)(4096)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Preconditioners
+typedef enum
+{
+  SLV_NONE,                 // Identity
+  SLV_JACOBI,               // Inverse diagonal
+  SLV_ILU0                  // Incomplete LU on the pattern of A
+}
+t_solverPrecond;
+
+// Iterative solver: operator, preconditioner, controls and last run report
+typedef struct solver_struct
+{
+  size_t  n;                 // System dimension
+  Matrix  A;                 // Dense operator (NULL if sparse)
+  SMatrix S;                 // Sparse operator in CSR (NULL if dense)
+  uint8_t owner;             // TRUE if A is a private copy
+  t_solverPrecond precond;   // Preconditioner
+  Vector  dinv;              // Jacobi: inverse diagonal
+  SMatrix ilu;               // ILU(0): L (unit, below diag.) and U in CSR
+  size_t* diag;              // ILU(0): position of each diagonal entry
+  double  tol;               // Relative residual tolerance
+  size_t  maxIter;           // Iteration limit
+  size_t  restart;           // GMRES restart length
+  size_t  iterations;        // Iterations of the last run
+  double  residual;          // True relative residual of the last run
+  uint8_t converged;         // TRUE if the last run reached tol
+  Vector  history;           // Relative residual per iteration (0..iterations)
+}
+t_solver;
+
+typedef t_solver* Solver;
+
+// Solver handler
+typedef struct solver_handler
+{
+  Solver  (*dense)(Matrix A);                                   // Dense system
+  Solver  (*sparse)(SMatrix A);                                 // Sparse system
+  uint8_t (*setTol)(Solver L, double tol, size_t maxIter);      // Controls
+  uint8_t (*setRestart)(Solver L, size_t restart);              // GMRES(m)
+  uint8_t (*setPrecond)(Solver L, t_solverPrecond precond);     // Precond.
+  uint8_t (*cg)(Solver L, Vector b, Vector x);                  // CG
+  uint8_t (*bicgstab)(Solver L, Vector b, Vector x);            // BiCGSTAB
+  uint8_t (*gmres)(Solver L, Vector b, Vector x);               // GMRES(m)
+  size_t  (*iter)(Solver L);                                    // Iterations
+  double  (*res)(Solver L);                                     // Residual
+  Vector  (*history)(Solver L);                                 // History
+  uint8_t (*del)(Solver L);                                     // Delete
+}
+t_SolverHandler;
+
+extern t_SolverHandler Slv_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Creates a solver for a dense system A x = b
+@param  A: Pointer to square matrix (or view, any storage)
+@retval Pointer to new solver, NULL if A is not square or on memory error
+@note   A is referenced, not copied (transposed views and structured storage
+        are materialized): it must outlive the solver, and a new
+        preconditioner must be set after it changes
+*/
+extern Solver solver_dense(Matrix A);
+
+/**
+@brief  Creates a solver for a sparse system A x = b
+@param  A: Pointer to square sparse matrix (any format)
+@retval Pointer to new solver, NULL if A is not square or on memory error
+@note   The solver keeps a CSR copy of A
+*/
+extern Solver solver_sparse(SMatrix A);
+
+/**
+@brief  Sets the tolerance and the iteration limit
+@param  L:       Pointer to solver
+        tol:     Relative residual |b - A x| / |b| to reach (> 0)
+        maxIter: Max. iterations (> 0)
+@retval TRUE if controls were set, FALSE otherwise
+*/
+extern uint8_t solver_setTolerance(Solver L, double tol, size_t maxIter);
+
+/**
+@brief  Sets the GMRES restart length
+@param  L:       Pointer to solver
+        restart: Krylov vectors kept between restarts (> 0)
+@retval TRUE if restart was set, FALSE otherwise
+*/
+extern uint8_t solver_setRestart(Solver L, size_t restart);
+
+/**
+@brief  Builds a preconditioner
+@param  L:       Pointer to solver
+        precond: SLV_NONE, SLV_JACOBI or SLV_ILU0
+@retval TRUE if preconditioner was built, FALSE on a zero diagonal / pivot
+        (the solver is left without preconditioner)
+@note   ILU(0) keeps the sparsity pattern of A (dense systems: the pattern
+        of their nonzeros)
+*/
+extern uint8_t solver_setPrecond(Solver L, t_solverPrecond precond);
+
+/**
+@brief  Preconditioned conjugate gradient (A symmetric positive definite)
+@param  L: Pointer to solver
+        b: Right-hand side (n elements)
+        x: Initial guess on input, solution on output (n elements)
+@retval TRUE if the tolerance was reached, FALSE otherwise
+@note   The preconditioner must be symmetric: Jacobi, or ILU(0) of a
+        symmetric A (L D L^T, i.e. incomplete Cholesky)
+*/
+extern uint8_t solver_cg(Solver L, Vector b, Vector x);
+
+/**
+@brief  BiCGSTAB, right preconditioned (general nonsymmetric A)
+@param  L: Pointer to solver
+        b: Right-hand side (n elements)
+        x: Initial guess on input, solution on output (n elements)
+@retval TRUE if the tolerance was reached, FALSE otherwise (including
+        breakdown)
+*/
+extern uint8_t solver_bicgstab(Solver L, Vector b, Vector x);
+
+/**
+@brief  Restarted GMRES(m), right preconditioned (general nonsymmetric A)
+@param  L: Pointer to solver
+        b: Right-hand side (n elements)
+        x: Initial guess on input, solution on output (n elements)
+@retval TRUE if the tolerance was reached, FALSE otherwise
+@note   Modified Gram-Schmidt with Givens rotations: the residual of every
+        inner iteration is known without forming x
+*/
+extern uint8_t solver_gmres(Solver L, Vector b, Vector x);
+
+/**
+@brief  Gets the iterations of the last run
+@param  L: Pointer to solver
+@retval Number of iterations
+*/
+extern size_t solver_getIterations(Solver L);
+
+/**
+@brief  Gets the true relative residual |b - A x| / |b| of the last run
+@param  L: Pointer to solver
+@retval Relative residual
+*/
+extern double solver_getResidual(Solver L);
+
+/**
+@brief  Gets the residual history of the last run
+@param  L: Pointer to solver
+@retval Relative residual per iteration (iterations + 1 elements, owned by
+        the solver)
+*/
+extern Vector solver_getHistory(Solver L);
+
+/**
+@brief  Deletes solver and frees allocated memory
+@param  L: Pointer to solver
+@retval TRUE if solver was deleted with no error, FALSE otherwise
+*/
+extern uint8_t solver_delete(Solver L);
+
+#endif
@@ -0,0 +1,1197 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_SparseMatrix.c
+ * Description   : Abstract Data Type for sparse matrices. Library file.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_SparseMatrix.h"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Sparse matrix handler
+t_SMatrixHandler SMx_Hdlr =
+{
+  smatrix_create,           // Create (COO)
+  smatrix_add,              // Add entry
+  smatrix_get,              // Get element
+  smatrix_isNull,           // Null matrix?
+  smatrix_getRows,          // Get #rows
+  smatrix_getColumns,       // Get #columns
+  smatrix_getNnz,           // Stored entries
+  smatrix_toCOO,            // COO copy
+  smatrix_toCSR,            // CSR copy
+  smatrix_toCSC,            // CSC copy
+  smatrix_fromDense,        // Dense to CSR
+  smatrix_toDense,          // Sparse to dense
+  smatrix_spmv,             // y = aAx + by
+  smatrix_spmm,             // Sparse product
+  smatrix_product,          // Sparse * dense
+  smatrix_transpose,        // Transpose
+  smatrix_delete            // Delete matrix
+};
+
+//----------------------------------------------------------------------------//
+//                              Private functions                             //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Allocates a sparse matrix with room for nnz entries
+@param  rows:    Number of rows
+        columns: Number of columns
+        format:  Storage format
+        nnz:     Entries to allocate (at least one is allocated)
+@retval Pointer to new matrix (no entries stored), NULL on memory error
+*/
+SMatrix smatrix_alloc(size_t rows, size_t columns, t_smatrixFormat format,
+                      size_t nnz)
+{
+  SMatrix S = NULL;
+  size_t nr = 0, nc = 0;
+
+  if(rows == 0 || columns == 0 || rows == SIZE_MAX || columns == SIZE_MAX)
+  {
+    return NULL;
+  }
+
+  nnz = (nnz == 0) ? 1 : nnz;
+
+  // Index arrays: entries, or pointers for the compressed dimension
+  nr = (format == SMX_CSR) ? rows + 1 : nnz;
+  nc = (format == SMX_CSC) ? columns + 1 : nnz;
+
+  if(nnz > SIZE_MAX / sizeof(Data) || nr > SIZE_MAX / sizeof(size_t) ||
+     nc > SIZE_MAX / sizeof(size_t))
+  {
+    return NULL;
+  }
+
+  S = (SMatrix)malloc( sizeof(t_smatrix) );
+
+  if(S == NULL)
+  {
+    return NULL;
+  }
+
+  S->rows = rows;
+  S->columns = columns;
+  S->nnz = 0;
+  S->capacity = nnz;
+  S->format = format;
+  S->row = (size_t*)malloc( nr * sizeof(size_t) );
+  S->col = (size_t*)malloc( nc * sizeof(size_t) );
+  S->val = (Data*)malloc( nnz * sizeof(Data) );
+
+  if(S->row == NULL || S->col == NULL || S->val == NULL)
+  {
+    free(S->row);
+    free(S->col);
+    free(S->val);
+    free(S);
+
+    return NULL;
+  }
+
+  // Empty compressed dimension
+  if(format == SMX_CSR)
+  {
+    memset(S->row, 0, nr * sizeof(size_t));
+  }
+  else if(format == SMX_CSC)
+  {
+    memset(S->col, 0, nc * sizeof(size_t));
+  }
+
+  return S;
+}
+
+/**
+@brief  Writes the coordinates of every stored entry (storage order)
+@param  S: Pointer to matrix
+        r: Row indices (nnz elements)
+        c: Column indices (nnz elements)
+@retval none
+*/
+void smatrix_expand(SMatrix S, size_t* r, size_t* c)
+{
+  size_t i = 0, p = 0;
+
+  switch(S->format)
+  {
+    case SMX_CSR:
+      for(i = 0; i < S->rows; i++)
+      {
+        for(p = S->row[i]; p < S->row[i + 1]; p++)
+        {
+          r[p] = i;
+        }
+      }
+
+      memcpy(c, S->col, S->nnz * sizeof(size_t));
+      break;
+
+    case SMX_CSC:
+      for(i = 0; i < S->columns; i++)
+      {
+        for(p = S->col[i]; p < S->col[i + 1]; p++)
+        {
+          c[p] = i;
+        }
+      }
+
+      memcpy(r, S->row, S->nnz * sizeof(size_t));
+      break;
+
+    default:
+      memcpy(r, S->row, S->nnz * sizeof(size_t));
+      memcpy(c, S->col, S->nnz * sizeof(size_t));
+      break;
+  }
+}
+
+/**
+@brief  Compresses a list of coordinates into CSR or CSC
+@param  rows:    Number of rows
+        columns: Number of columns
+        nnz:     Number of entries
+        r, c, v: Coordinates and values of the entries (any order)
+        format:  SMX_CSR or SMX_CSC
+@retval Pointer to new matrix, NULL on memory error
+@note   Two stable counting sorts (minor index, then major index) leave the
+        entries sorted in O(nnz + rows + columns); duplicates are then
+        adjacent and added up, zero sums are dropped
+*/
+SMatrix smatrix_compress(size_t rows, size_t columns, size_t nnz,
+                         const size_t* r, const size_t* c, const Data* v,
+                         t_smatrixFormat format)
+{
+  SMatrix S = NULL;
+  const size_t* major = (format == SMX_CSR) ? r : c;
+  const size_t* minor = (format == SMX_CSR) ? c : r;
+  size_t nMajor = (format == SMX_CSR) ? rows : columns;
+  size_t nMinor = (format == SMX_CSR) ? columns : rows;
+  size_t *count = NULL, *t1 = NULL, *t2 = NULL, *ptr = NULL, *idx = NULL;
+  size_t p = 0, q = 0, k = 0, m = 0;
+  Data s = 0;
+
+  S = smatrix_alloc(rows, columns, format, nnz);
+  count = (size_t*)malloc( ((nMajor > nMinor ? nMajor : nMinor) + 1) *
+                           sizeof(size_t) );
+  t1 = (size_t*)malloc( (nnz + 1) * sizeof(size_t) );
+  t2 = (size_t*)malloc( (nnz + 1) * sizeof(size_t) );
+
+  if(S == NULL || count == NULL || t1 == NULL || t2 == NULL)
+  {
+    smatrix_delete(S);
+    free(count);
+    free(t1);
+    free(t2);
+
+    return NULL;
+  }
+
+  // Sort by minor index
+  memset(count, 0, (nMinor + 1) * sizeof(size_t));
+
+  for(p = 0; p < nnz; p++)
+  {
+    count[minor[p] + 1]++;
+  }
+
+  for(m = 0; m < nMinor; m++)
+  {
+    count[m + 1] += count[m];
+  }
+
+  for(p = 0; p < nnz; p++)
+  {
+    t1[count[minor[p]]++] = p;
+  }
+
+  // Stable sort by major index
+  memset(count, 0, (nMajor + 1) * sizeof(size_t));
+
+  for(p = 0; p < nnz; p++)
+  {
+    count[major[p] + 1]++;
+  }
+
+  for(m = 0; m < nMajor; m++)
+  {
+    count[m + 1] += count[m];
+  }
+
+  for(q = 0; q < nnz; q++)
+  {
+    p = t1[q];
+    t2[count[major[p]]++] = p;
+  }
+
+  // Merges duplicates and builds the pointers
+  ptr = (format == SMX_CSR) ? S->row : S->col;
+  idx = (format == SMX_CSR) ? S->col : S->row;
+
+  for(m = 0, q = 0; m < nMajor; m++)
+  {
+    ptr[m] = k;
+
+    while(q < nnz && major[t2[q]] == m)
+    {
+      p = t2[q++];
+      s = v[p];
+
+      while(q < nnz && major[t2[q]] == m && minor[t2[q]] == minor[p])
+      {
+        s += v[t2[q++]];
+      }
+
+      if(s != 0)
+      {
+        idx[k] = minor[p];
+        S->val[k] = s;
+        k++;
+      }
+    }
+  }
+
+  ptr[nMajor] = k;
+  S->nnz = k;
+
+  free(count);
+  free(t1);
+  free(t2);
+
+  return S;
+}
+
+/**
+@brief  Converts a matrix to CSR or CSC
+@param  S:      Pointer to matrix (any format)
+        format: SMX_CSR or SMX_CSC
+@retval Pointer to new matrix, NULL on memory error
+*/
+SMatrix smatrix_convert(SMatrix S, t_smatrixFormat format)
+{
+  SMatrix T = NULL;
+  size_t *r = NULL, *c = NULL;
+
+  if(S == NULL)
+  {
+    return NULL;
+  }
+
+  // Same compressed format: plain copy
+  if(S->format == format)
+  {
+    T = smatrix_alloc(S->rows, S->columns, format, S->nnz);
+
+    if(T != NULL)
+    {
+      T->nnz = S->nnz;
+      memcpy(T->val, S->val, S->nnz * sizeof(Data));
+
+      if(format == SMX_CSR)
+      {
+        memcpy(T->row, S->row, (S->rows + 1) * sizeof(size_t));
+        memcpy(T->col, S->col, S->nnz * sizeof(size_t));
+      }
+      else
+      {
+        memcpy(T->col, S->col, (S->columns + 1) * sizeof(size_t));
+        memcpy(T->row, S->row, S->nnz * sizeof(size_t));
+      }
+    }
+
+    return T;
+  }
+
+  // COO entries are already coordinates
+  if(S->format == SMX_COO)
+  {
+    return smatrix_compress(S->rows, S->columns, S->nnz,
+                            S->row, S->col, S->val, format);
+  }
+
+  r = (size_t*)malloc( (S->nnz + 1) * sizeof(size_t) );
+  c = (size_t*)malloc( (S->nnz + 1) * sizeof(size_t) );
+
+  if(r != NULL && c != NULL)
+  {
+    smatrix_expand(S, r, c);
+    T = smatrix_compress(S->rows, S->columns, S->nnz, r, c, S->val, format);
+  }
+
+  free(r);
+  free(c);
+
+  return T;
+}
+
+/**
+@brief  CSR product on a block of rows: y = a A x + b y
+@param  A:      Pointer to CSR matrix
+        i0, i1: Rows [i0, i1)
+        a, b:   Scales (b = 0: previous y is not read)
+        x, y:   Input and output vectors
+@retval none
+@note   One call per block keeps short rows free of dispatch overhead; four
+        partial sums break the dependency chain of long rows
+*/
+MX_KERNEL_CLONES
+void smatrix_spmv_rows(SMatrix A, size_t i0, size_t i1, Data a,
+                       const Data* restrict x, Data b, Data* restrict y)
+{
+  const size_t* restrict c = A->col;
+  const Data* restrict v = A->val;
+  Data s0 = 0, s1 = 0, s2 = 0, s3 = 0;
+  size_t i = 0, p = 0, end = 0;
+
+  for(i = i0; i < i1; i++)
+  {
+    s0 = s1 = s2 = s3 = 0;
+    end = A->row[i + 1];
+
+    for(p = A->row[i]; p + 4 <= end; p += 4)
+    {
+      s0 += v[p] * x[c[p]];
+      s1 += v[p + 1] * x[c[p + 1]];
+      s2 += v[p + 2] * x[c[p + 2]];
+      s3 += v[p + 3] * x[c[p + 3]];
+    }
+
+    for(; p < end; p++)
+    {
+      s0 += v[p] * x[c[p]];
+    }
+
+    s0 = a * ((s0 + s1) + (s2 + s3));
+    y[i] = (b == 0) ? s0 : s0 + b * y[i];
+  }
+}
+
+/**
+@brief  Row update c = c + a b
+@param  n: Number of elements
+        a: Scale
+        b: Source row
+        c: Destination row
+@retval none
+*/
+MX_KERNEL_CLONES
+void smatrix_axpy(size_t n, Data a, const Data* restrict b, Data* restrict c)
+{
+  size_t j = 0;
+
+  for(j = 0; j < n; j++)
+  {
+    c[j] += a * b[j];
+  }
+}
+
+/**
+@brief  Compares two indices (qsort)
+@param  a, b: Pointers to indices
+@retval <0, 0, >0
+*/
+int smatrix_cmp(const void* a, const void* b)
+{
+  size_t x = *(const size_t*)a, y = *(const size_t*)b;
+
+  return (x > y) - (x < y);
+}
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Creates an empty sparse matrix in COO format (for assembly)
+@param  rows:    Number of rows
+        columns: Number of columns
+@retval Pointer to new matrix, NULL on zero dimensions or memory error
+*/
+SMatrix smatrix_create(size_t rows, size_t columns)
+{
+  return smatrix_alloc(rows, columns, SMX_COO, SMX_COO_MIN);
+}
+
+/**
+@brief  Adds an entry to a COO matrix
+@param  S: Pointer to COO matrix
+        k: Value
+        i: Row index
+        j: Column index
+@retval TRUE if entry was stored, FALSE otherwise
+@note   Entries at the same position are added up on compression
+*/
+uint8_t smatrix_add(SMatrix S, Data k, size_t i, size_t j)
+{
+  size_t cap = 0;
+  size_t *r = NULL, *c = NULL;
+  Data* v = NULL;
+
+  if(S == NULL || S->format != SMX_COO || i >= S->rows || j >= S->columns)
+  {
+    return FALSE;
+  }
+
+  // Doubles capacity when full
+  if(S->nnz == S->capacity)
+  {
+    if(S->capacity > SIZE_MAX / 2 / sizeof(size_t))
+    {
+      return FALSE;
+    }
+
+    cap = 2 * S->capacity;
+    r = (size_t*)realloc(S->row, cap * sizeof(size_t));
+
+    if(r != NULL)
+    {
+      S->row = r;
+    }
+
+    c = (size_t*)realloc(S->col, cap * sizeof(size_t));
+
+    if(c != NULL)
+    {
+      S->col = c;
+    }
+
+    v = (Data*)realloc(S->val, cap * sizeof(Data));
+
+    if(v != NULL)
+    {
+      S->val = v;
+    }
+
+    // Arrays that grew keep their size: capacity stays consistent
+    if(r == NULL || c == NULL || v == NULL)
+    {
+      return FALSE;
+    }
+
+    S->capacity = cap;
+  }
+
+  S->row[S->nnz] = i;
+  S->col[S->nnz] = j;
+  S->val[S->nnz] = k;
+  S->nnz++;
+
+  return TRUE;
+}
+
+/**
+@brief  Gets an element of a sparse matrix
+@param  S: Pointer to matrix
+        i: Row index
+        j: Column index
+        k: Pointer to value (0 if not stored)
+@retval TRUE if indices are valid, FALSE otherwise
+@note   Binary search in CSR / CSC, linear scan in COO
+*/
+uint8_t smatrix_get(SMatrix S, size_t i, size_t j, Data* k)
+{
+  size_t lo = 0, hi = 0, mid = 0, key = 0, p = 0;
+  const size_t* idx = NULL;
+
+  if(S == NULL || k == NULL || i >= S->rows || j >= S->columns)
+  {
+    return FALSE;
+  }
+
+  *k = 0;
+
+  if(S->format == SMX_COO)
+  {
+    for(p = 0; p < S->nnz; p++)
+    {
+      if(S->row[p] == i && S->col[p] == j)
+      {
+        *k += S->val[p];
+      }
+    }
+
+    return TRUE;
+  }
+
+  // Sorted minor indices of row i (CSR) or column j (CSC)
+  lo = (S->format == SMX_CSR) ? S->row[i] : S->col[j];
+  hi = (S->format == SMX_CSR) ? S->row[i + 1] : S->col[j + 1];
+  idx = (S->format == SMX_CSR) ? S->col : S->row;
+  key = (S->format == SMX_CSR) ? j : i;
+
+  while(lo < hi)
+  {
+    mid = lo + (hi - lo) / 2;
+
+    if(idx[mid] < key)
+    {
+      lo = mid + 1;
+    }
+    else
+    {
+      hi = mid;
+    }
+  }
+
+  if(lo < ((S->format == SMX_CSR) ? S->row[i + 1] : S->col[j + 1]) &&
+     idx[lo] == key)
+  {
+    *k = S->val[lo];
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Verifies if matrix is null
+@param  S: Pointer to matrix
+@retval TRUE if matrix is null, FALSE otherwise
+@note   O(nnz) instead of O(rows * columns)
+*/
+uint8_t smatrix_isNull(SMatrix S)
+{
+  SMatrix T = NULL;
+  uint8_t null = TRUE;
+  size_t p = 0;
+
+  if(S == NULL)
+  {
+    return FALSE;
+  }
+
+  for(p = 0; p < S->nnz && null; p++)
+  {
+    null = (S->val[p] == 0);
+  }
+
+  // COO duplicates may cancel out: compress to decide
+  if(!null && S->format == SMX_COO)
+  {
+    T = smatrix_convert(S, SMX_CSR);
+
+    if(T != NULL)
+    {
+      null = (T->nnz == 0);
+      smatrix_delete(T);
+    }
+  }
+
+  return null;
+}
+
+/**
+@brief  Gets number of rows of indicated matrix
+@param  S: Pointer to matrix
+@retval Number of rows
+*/
+size_t smatrix_getRows(SMatrix S)
+{
+  return (S != NULL) ? S->rows : 0;
+}
+
+/**
+@brief  Gets number of columns of indicated matrix
+@param  S: Pointer to matrix
+@retval Number of columns
+*/
+size_t smatrix_getColumns(SMatrix S)
+{
+  return (S != NULL) ? S->columns : 0;
+}
+
+/**
+@brief  Gets number of stored entries
+@param  S: Pointer to matrix
+@retval Number of stored entries
+*/
+size_t smatrix_getNnz(SMatrix S)
+{
+  return (S != NULL) ? S->nnz : 0;
+}
+
+/**
+@brief  Copies a sparse matrix in COO format
+@param  S: Pointer to matrix (any format)
+@retval Pointer to new matrix
+*/
+SMatrix smatrix_toCOO(SMatrix S)
+{
+  SMatrix T = NULL;
+
+  if(S == NULL)
+  {
+    return NULL;
+  }
+
+  T = smatrix_alloc(S->rows, S->columns, SMX_COO,
+                    (S->nnz > SMX_COO_MIN) ? S->nnz : SMX_COO_MIN);
+
+  if(T != NULL)
+  {
+    smatrix_expand(S, T->row, T->col);
+    memcpy(T->val, S->val, S->nnz * sizeof(Data));
+    T->nnz = S->nnz;
+  }
+
+  return T;
+}
+
+/**
+@brief  Copies a sparse matrix in CSR format
+@param  S: Pointer to matrix (any format)
+@retval Pointer to new matrix
+@note   Two stable counting sorts (by column, then by row): O(nnz + rows +
+        columns). Duplicates are added up and zeros dropped
+*/
+SMatrix smatrix_toCSR(SMatrix S)
+{
+  return smatrix_convert(S, SMX_CSR);
+}
+
+/**
+@brief  Copies a sparse matrix in CSC format
+@param  S: Pointer to matrix (any format)
+@retval Pointer to new matrix
+*/
+SMatrix smatrix_toCSC(SMatrix S)
+{
+  return smatrix_convert(S, SMX_CSC);
+}
+
+/**
+@brief  Converts a dense matrix to CSR
+@param  M: Pointer to dense matrix (or transposed view, any storage)
+@retval Pointer to new sparse matrix
+*/
+SMatrix smatrix_fromDense(Matrix M)
+{
+  SMatrix S = NULL;
+  Matrix U = NULL;
+  size_t i = 0, j = 0, p = 0, nnz = 0;
+  Data a = 0;
+
+  if(M == NULL)
+  {
+    return NULL;
+  }
+
+  // Structured storage is scanned as its dense equivalent
+  if(M->structure != MX_GENERAL)
+  {
+    U = Mx_Hdlr.unpack(M);
+    S = (U != NULL) ? smatrix_fromDense(U) : NULL;
+    Mx_Hdlr.del(U);
+
+    return S;
+  }
+
+  // Counts nonzeros
+  for(i = 0; i < M->rows; i++)
+  {
+    for(j = 0; j < M->columns; j++)
+    {
+      a = M->transposed ? M->data[j * M->ld + i] : M->data[i * M->ld + j];
+      nnz += (a != 0);
+    }
+  }
+
+  S = smatrix_alloc(M->rows, M->columns, SMX_CSR, nnz);
+
+  if(S == NULL)
+  {
+    return NULL;
+  }
+
+  for(i = 0; i < M->rows; i++)
+  {
+    S->row[i] = p;
+
+    for(j = 0; j < M->columns; j++)
+    {
+      a = M->transposed ? M->data[j * M->ld + i] : M->data[i * M->ld + j];
+
+      if(a != 0)
+      {
+        S->col[p] = j;
+        S->val[p] = a;
+        p++;
+      }
+    }
+  }
+
+  S->row[M->rows] = p;
+  S->nnz = p;
+
+  return S;
+}
+
+/**
+@brief  Converts a sparse matrix to dense
+@param  S: Pointer to sparse matrix (any format)
+@retval Pointer to new dense matrix
+*/
+Matrix smatrix_toDense(SMatrix S)
+{
+  Matrix M = NULL;
+  size_t i = 0, p = 0;
+
+  if(S == NULL)
+  {
+    return NULL;
+  }
+
+  M = Mx_Hdlr.init(S->rows, S->columns);
+
+  if(M == NULL)
+  {
+    return NULL;
+  }
+
+  switch(S->format)
+  {
+    case SMX_CSR:
+      for(i = 0; i < S->rows; i++)
+      {
+        for(p = S->row[i]; p < S->row[i + 1]; p++)
+        {
+          M->data[i * M->ld + S->col[p]] = S->val[p];
+        }
+      }
+      break;
+
+    case SMX_CSC:
+      for(i = 0; i < S->columns; i++)
+      {
+        for(p = S->col[i]; p < S->col[i + 1]; p++)
+        {
+          M->data[S->row[p] * M->ld + i] = S->val[p];
+        }
+      }
+      break;
+
+    default:
+      // COO duplicates add up
+      for(p = 0; p < S->nnz; p++)
+      {
+        M->data[S->row[p] * M->ld + S->col[p]] += S->val[p];
+      }
+      break;
+  }
+
+  return M;
+}
+
+/**
+@brief  Sparse matrix-vector product: y = a A x + b y
+@param  a: Scale of A x
+        A: Pointer to sparse matrix (rows x columns)
+        x: Input vector (columns elements)
+        b: Scale of previous y (0: previous y is not read)
+        y: Output vector (rows elements), distinct from x
+@retval TRUE if product was computed, FALSE otherwise
+@note   CSR: rows in parallel (OpenMP) with a vectorized gather-reduction.
+        CSC and COO: scatter over y (single thread)
+*/
+uint8_t smatrix_spmv(Data a, SMatrix A, Vector x, Data b, Vector y)
+{
+  size_t i = 0, j = 0, p = 0;
+  Data xj = 0;
+
+  if(A == NULL || x == NULL || y == NULL || x == y)
+  {
+    return FALSE;
+  }
+
+  if(A->format == SMX_CSR)
+  {
+    #pragma omp parallel for schedule(dynamic) if(A->nnz >= SMX_PARALLEL_MIN)
+    for(i = 0; i < A->rows; i += SMX_CHUNK)
+    {
+      smatrix_spmv_rows(A, i, (A->rows - i < SMX_CHUNK) ? A->rows :
+                        i + SMX_CHUNK, a, x, b, y);
+    }
+
+    return TRUE;
+  }
+
+  // Scatter: y = b y first
+  for(i = 0; i < A->rows; i++)
+  {
+    y[i] = (b == 0) ? 0 : b * y[i];
+  }
+
+  if(A->format == SMX_CSC)
+  {
+    for(j = 0; j < A->columns; j++)
+    {
+      xj = a * x[j];
+
+      for(p = A->col[j]; p < A->col[j + 1]; p++)
+      {
+        y[A->row[p]] += A->val[p] * xj;
+      }
+    }
+  }
+  else
+  {
+    for(p = 0; p < A->nnz; p++)
+    {
+      y[A->row[p]] += a * A->val[p] * x[A->col[p]];
+    }
+  }
+
+  return TRUE;
+}
+
+/**
+@brief  Sparse matrix-matrix product A B
+@param  A: Pointer to first matrix (m x k, any format)
+        B: Pointer to second matrix (k x n, any format)
+@retval Pointer to product in CSR, NULL if dimensions do not match
+@note   Row-by-row (Gustavson) with a dense accumulator per thread: a
+        symbolic pass sizes every row, a numeric pass fills them
+*/
+SMatrix smatrix_spmm(SMatrix A, SMatrix B)
+{
+  SMatrix C = NULL, Ar = NULL, Br = NULL;
+  size_t *mark = NULL, *ptr = NULL;
+  Data* acc = NULL;
+  size_t i = 0, j = 0, p = 0, q = 0, k = 0, m = 0, n = 0;
+  uint8_t ok = TRUE;
+
+  if(A == NULL || B == NULL || A->columns != B->rows)
+  {
+    return NULL;
+  }
+
+  // Row access on both operands
+  Ar = (A->format == SMX_CSR) ? A : smatrix_convert(A, SMX_CSR);
+  Br = (B->format == SMX_CSR) ? B : smatrix_convert(B, SMX_CSR);
+  m = A->rows;
+  n = B->columns;
+  ptr = (size_t*)calloc(m + 1, sizeof(size_t));
+
+  ok = (Ar != NULL && Br != NULL && ptr != NULL);
+
+  // Symbolic pass: row i of C has ptr[i + 1] distinct columns
+  #pragma omp parallel private(mark, i, j, p, q, k) \
+                       if(ok && Ar->nnz + Br->nnz >= SMX_PARALLEL_MIN)
+  {
+    mark = ok ? (size_t*)calloc(n, sizeof(size_t)) : NULL;
+
+    if(ok && mark == NULL)
+    {
+      #pragma omp atomic write
+      ok = FALSE;
+    }
+
+    #pragma omp for schedule(dynamic, SMX_CHUNK)
+    for(i = 0; i < m; i++)
+    {
+      if(mark == NULL)
+      {
+        continue;
+      }
+
+      for(p = Ar->row[i], k = 0; p < Ar->row[i + 1]; p++)
+      {
+        for(q = Br->row[Ar->col[p]]; q < Br->row[Ar->col[p] + 1]; q++)
+        {
+          j = Br->col[q];
+
+          if(mark[j] != i + 1)
+          {
+            mark[j] = i + 1;
+            k++;
+          }
+        }
+      }
+
+      ptr[i + 1] = k;
+    }
+
+    free(mark);
+  }
+
+  if(ok)
+  {
+    for(i = 0; i < m; i++)
+    {
+      ptr[i + 1] += ptr[i];
+    }
+
+    C = smatrix_alloc(m, n, SMX_CSR, ptr[m]);
+    ok = (C != NULL);
+  }
+
+  // Numeric pass: accumulates row i, then sorts its columns
+  #pragma omp parallel private(mark, acc, i, j, p, q, k) \
+                       if(ok && Ar->nnz + Br->nnz >= SMX_PARALLEL_MIN)
+  {
+    mark = ok ? (size_t*)calloc(n, sizeof(size_t)) : NULL;
+    acc = ok ? (Data*)malloc(n * sizeof(Data)) : NULL;
+
+    if(ok && (mark == NULL || acc == NULL))
+    {
+      #pragma omp atomic write
+      ok = FALSE;
+    }
+
+    #pragma omp for schedule(dynamic, SMX_CHUNK)
+    for(i = 0; i < m; i++)
+    {
+      if(mark == NULL || acc == NULL)
+      {
+        continue;
+      }
+
+      k = ptr[i];
+
+      for(p = Ar->row[i]; p < Ar->row[i + 1]; p++)
+      {
+        for(q = Br->row[Ar->col[p]]; q < Br->row[Ar->col[p] + 1]; q++)
+        {
+          j = Br->col[q];
+
+          if(mark[j] != i + 1)
+          {
+            mark[j] = i + 1;
+            acc[j] = Ar->val[p] * Br->val[q];
+            C->col[k++] = j;
+          }
+          else
+          {
+            acc[j] += Ar->val[p] * Br->val[q];
+          }
+        }
+      }
+
+      qsort(&C->col[ptr[i]], k - ptr[i], sizeof(size_t), smatrix_cmp);
+
+      for(q = ptr[i]; q < k; q++)
+      {
+        C->val[q] = acc[C->col[q]];
+      }
+    }
+
+    free(mark);
+    free(acc);
+  }
+
+  if(ok)
+  {
+    memcpy(C->row, ptr, (m + 1) * sizeof(size_t));
+    C->nnz = ptr[m];
+  }
+  else
+  {
+    smatrix_delete(C);
+    C = NULL;
+  }
+
+  if(Ar != A)
+  {
+    smatrix_delete(Ar);
+  }
+
+  if(Br != B)
+  {
+    smatrix_delete(Br);
+  }
+
+  free(ptr);
+
+  return C;
+}
+
+/**
+@brief  Sparse-dense product A B
+@param  A: Pointer to sparse matrix (m x k, any format)
+        B: Pointer to dense matrix (k x n)
+@retval Pointer to dense product (m x n), NULL if dimensions do not match
+@note   Each stored a_ij adds a_ij * B(j, :) to row i: contiguous,
+        vectorized row updates, rows in parallel
+*/
+Matrix smatrix_product(SMatrix A, Matrix B)
+{
+  SMatrix Ar = NULL;
+  Matrix C = NULL, Bn = NULL;
+  size_t i = 0, p = 0;
+
+  if(A == NULL || B == NULL || A->columns != B->rows)
+  {
+    return NULL;
+  }
+
+  Ar = (A->format == SMX_CSR) ? A : smatrix_convert(A, SMX_CSR);
+
+  // Rows of B must be contiguous: views and structured storage are
+  // materialized
+  if(B->transposed || B->structure != MX_GENERAL)
+  {
+    Bn = Mx_Hdlr.unpack(B);
+  }
+  else
+  {
+    Bn = B;
+  }
+
+  C = Mx_Hdlr.init(A->rows, B->columns);
+
+  if(Ar != NULL && Bn != NULL && C != NULL)
+  {
+    #pragma omp parallel for private(p) schedule(dynamic, SMX_CHUNK) \
+                             if(Ar->nnz * Bn->columns >= SMX_PARALLEL_MIN)
+    for(i = 0; i < Ar->rows; i++)
+    {
+      for(p = Ar->row[i]; p < Ar->row[i + 1]; p++)
+      {
+        smatrix_axpy(Bn->columns, Ar->val[p], &Bn->data[Ar->col[p] * Bn->ld],
+                     &C->data[i * C->ld]);
+      }
+    }
+  }
+  else
+  {
+    Mx_Hdlr.del(C);
+    C = NULL;
+  }
+
+  if(Ar != A)
+  {
+    smatrix_delete(Ar);
+  }
+
+  if(Bn != B)
+  {
+    Mx_Hdlr.del(Bn);
+  }
+
+  return C;
+}
+
+/**
+@brief  Transposes a sparse matrix
+@param  S: Pointer to matrix
+@retval Pointer to transposed matrix
+@note   CSR and CSC swap roles: the arrays are copied, not sorted
+*/
+SMatrix smatrix_transpose(SMatrix S)
+{
+  SMatrix T = NULL;
+  t_smatrixFormat format = SMX_COO;
+
+  if(S == NULL)
+  {
+    return NULL;
+  }
+
+  // CSR of S holds the CSC of S^T and vice versa
+  format = (S->format == SMX_CSR) ? SMX_CSC :
+           (S->format == SMX_CSC) ? SMX_CSR : SMX_COO;
+  T = smatrix_alloc(S->columns, S->rows, format, S->capacity);
+
+  if(T == NULL)
+  {
+    return NULL;
+  }
+
+  T->nnz = S->nnz;
+  memcpy(T->val, S->val, S->nnz * sizeof(Data));
+
+  switch(S->format)
+  {
+    case SMX_CSR:
+      memcpy(T->col, S->row, (S->rows + 1) * sizeof(size_t));
+      memcpy(T->row, S->col, S->nnz * sizeof(size_t));
+      break;
+
+    case SMX_CSC:
+      memcpy(T->row, S->col, (S->columns + 1) * sizeof(size_t));
+      memcpy(T->col, S->row, S->nnz * sizeof(size_t));
+      break;
+
+    default:
+      memcpy(T->row, S->col, S->nnz * sizeof(size_t));
+      memcpy(T->col, S->row, S->nnz * sizeof(size_t));
+      break;
+  }
+
+  return T;
+}
+
+/**
+@brief  Deletes sparse matrix and frees allocated memory
+@param  S: Pointer to matrix
+@retval TRUE if matrix was deleted with no error, FALSE otherwise
+*/
+uint8_t smatrix_delete(SMatrix S)
+{
+  if(S != NULL)
+  {
+    free(S->row);
+    free(S->col);
+    free(S->val);
+    free(S);
+
+    return TRUE;
+  }
+
+  return FALSE;
+}
+
+/**
+@brief  Prints the stored entries of a sparse matrix on screen
+@param  S: Pointer to matrix
+@retval TRUE if matrix was printed with no error, FALSE otherwise
+*/
+uint8_t smatrix_print(SMatrix S)
+{
+  size_t *r = NULL, *c = NULL;
+  size_t p = 0;
+
+  if(S == NULL)
+  {
+    return FALSE;
+  }
+
+  r = (size_t*)malloc( (S->nnz + 1) * sizeof(size_t) );
+  c = (size_t*)malloc( (S->nnz + 1) * sizeof(size_t) );
+
+  if(r == NULL || c == NULL)
+  {
+    free(r);
+    free(c);
+
+    return FALSE;
+  }
+
+  smatrix_expand(S, r, c);
+
+  printf("%zu x %zu, %zu entries (%s)\n", S->rows, S->columns, S->nnz,
+         (S->format == SMX_CSR) ? "CSR" :
+         (S->format == SMX_CSC) ? "CSC" : "COO");
+
+  for(p = 0; p < S->nnz; p++)
+  {
+    printf("  (%zu, %zu) %10.4f\n", r[p], c[p], S->val[p]);
+  }
+
+  free(r);
+  free(c);
+
+  return TRUE;
+}
@@ -0,0 +1,247 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : ADT_SparseMatrix.h
+ * Description   : Abstract Data Type for sparse matrices. Header file.
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _SPARSE_MATRIX_H_
+#define _SPARSE_MATRIX_H_
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Matrix.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Initial capacity of a COO matrix (entries); it doubles when full
+#define SMX_COO_MIN (size_t)(16)
+
+// Min. stored entries to run sparse kernels with OpenMP threads
+#define SMX_PARALLEL_MIN (size_t)(1 << 15)
+
+// Rows per OpenMP chunk (rows differ in length: dynamic schedule)
+#define SMX_CHUNK 64
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Storage formats
+typedef enum
+{
+  SMX_COO,                  // Coordinates: assembly (any order, duplicates)
+  SMX_CSR,                  // Compressed sparse rows: compute
+  SMX_CSC                   // Compressed sparse columns: compute on A^T
+}
+t_smatrixFormat;
+
+// Sparse matrix. Entry p is (row[p], col[p], val[p]) in COO. CSR keeps the
+// entries of row i in [row[i], row[i + 1]) with columns col[p]; CSC keeps
+// the entries of column j in [col[j], col[j + 1]) with rows row[p].
+// Compressed formats are sorted and without duplicates (conversions also
+// drop zeros; products keep cancellations)
+typedef struct smatrix_struct
+{
+  size_t  rows;              // Number of rows
+  size_t  columns;           // Number of columns
+  size_t  nnz;               // Stored entries
+  size_t  capacity;          // Allocated entries
+  t_smatrixFormat format;    // Storage format
+  size_t* row;               // Row indices (CSR: rows + 1 row pointers)
+  size_t* col;               // Column indices (CSC: columns + 1 pointers)
+  Data*   val;               // Values
+}
+t_smatrix;
+
+typedef t_smatrix* SMatrix;
+
+// Sparse matrix handler
+typedef struct smatrix_handler
+{
+  SMatrix (*init)(size_t rows, size_t columns);               // Create (COO)
+  uint8_t (*add)(SMatrix S, Data k, size_t i, size_t j);      // Add entry
+  uint8_t (*get)(SMatrix S, size_t i, size_t j, Data* k);     // Get element
+  uint8_t (*isNull)(SMatrix S);                               // Null matrix?
+  size_t  (*row)(SMatrix S);                                  // Get #rows
+  size_t  (*col)(SMatrix S);                                  // Get #columns
+  size_t  (*nnz)(SMatrix S);                                  // Stored entries
+  SMatrix (*toCOO)(SMatrix S);                                // COO copy
+  SMatrix (*toCSR)(SMatrix S);                                // CSR copy
+  SMatrix (*toCSC)(SMatrix S);                                // CSC copy
+  SMatrix (*fromDense)(Matrix M);                             // Dense to CSR
+  Matrix  (*toDense)(SMatrix S);                              // Sparse to dense
+  uint8_t (*spmv)(Data a, SMatrix A, Vector x, Data b, Vector y); // y = aAx + by
+  SMatrix (*spmm)(SMatrix A, SMatrix B);                      // Sparse product
+  Matrix  (*product)(SMatrix A, Matrix B);                    // Sparse * dense
+  SMatrix (*transp)(SMatrix S);                               // Transpose
+  uint8_t (*del)(SMatrix S);                                  // Delete matrix
+}
+t_SMatrixHandler;
+
+extern t_SMatrixHandler SMx_Hdlr;
+
+//----------------------------------------------------------------------------//
+//                              Public functions                              //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Creates an empty sparse matrix in COO format (for assembly)
+@param  rows:    Number of rows
+        columns: Number of columns
+@retval Pointer to new matrix, NULL on zero dimensions or memory error
+*/
+extern SMatrix smatrix_create(size_t rows, size_t columns);
+
+/**
+@brief  Adds an entry to a COO matrix
+@param  S: Pointer to COO matrix
+        k: Value
+        i: Row index
+        j: Column index
+@retval TRUE if entry was stored, FALSE otherwise
+@note   Entries at the same position are added up on compression
+*/
+extern uint8_t smatrix_add(SMatrix S, Data k, size_t i, size_t j);
+
+/**
+@brief  Gets an element of a sparse matrix
+@param  S: Pointer to matrix
+        i: Row index
+        j: Column index
+        k: Pointer to value (0 if not stored)
+@retval TRUE if indices are valid, FALSE otherwise
+@note   Binary search in CSR / CSC, linear scan in COO
+*/
+extern uint8_t smatrix_get(SMatrix S, size_t i, size_t j, Data* k);
+
+/**
+@brief  Verifies if matrix is null
+@param  S: Pointer to matrix
+@retval TRUE if matrix is null, FALSE otherwise
+@note   O(nnz) instead of O(rows * columns)
+*/
+extern uint8_t smatrix_isNull(SMatrix S);
+
+/**
+@brief  Gets number of rows of indicated matrix
+@param  S: Pointer to matrix
+@retval Number of rows
+*/
+extern size_t smatrix_getRows(SMatrix S);
+
+/**
+@brief  Gets number of columns of indicated matrix
+@param  S: Pointer to matrix
+@retval Number of columns
+*/
+extern size_t smatrix_getColumns(SMatrix S);
+
+/**
+@brief  Gets number of stored entries
+@param  S: Pointer to matrix
+@retval Number of stored entries
+*/
+extern size_t smatrix_getNnz(SMatrix S);
+
+/**
+@brief  Copies a sparse matrix in COO format
+@param  S: Pointer to matrix (any format)
+@retval Pointer to new matrix
+*/
+extern SMatrix smatrix_toCOO(SMatrix S);
+
+/**
+@brief  Copies a sparse matrix in CSR format
+@param  S: Pointer to matrix (any format)
+@retval Pointer to new matrix
+@note   Two stable counting sorts (by column, then by row): O(nnz + rows +
+        columns). Duplicates are added up and zeros dropped
+*/
+extern SMatrix smatrix_toCSR(SMatrix S);
+
+/**
+@brief  Copies a sparse matrix in CSC format
+@param  S: Pointer to matrix (any format)
+@retval Pointer to new matrix
+*/
+extern SMatrix smatrix_toCSC(SMatrix S);
+
+/**
+@brief  Converts a dense matrix to CSR
+@param  M: Pointer to dense matrix (or transposed view, any storage)
+@retval Pointer to new sparse matrix
+*/
+extern SMatrix smatrix_fromDense(Matrix M);
+
+/**
+@brief  Converts a sparse matrix to dense
+@param  S: Pointer to sparse matrix (any format)
+@retval Pointer to new dense matrix
+*/
+extern Matrix smatrix_toDense(SMatrix S);
+
+/**
+@brief  Sparse matrix-vector product: y = a A x + b y
+@param  a: Scale of A x
+        A: Pointer to sparse matrix (rows x columns)
+        x: Input vector (columns elements)
+        b: Scale of previous y (0: previous y is not read)
+        y: Output vector (rows elements), distinct from x
+@retval TRUE if product was computed, FALSE otherwise
+@note   CSR: rows in parallel (OpenMP) with a vectorized gather-reduction.
+        CSC and COO: scatter over y (single thread)
+*/
+extern uint8_t smatrix_spmv(Data a, SMatrix A, Vector x, Data b, Vector y);
+
+/**
+@brief  Sparse matrix-matrix product A B
+@param  A: Pointer to first matrix (m x k, any format)
+        B: Pointer to second matrix (k x n, any format)
+@retval Pointer to product in CSR, NULL if dimensions do not match
+@note   Row-by-row (Gustavson) with a dense accumulator per thread: a
+        symbolic pass sizes every row, a numeric pass fills them
+*/
+extern SMatrix smatrix_spmm(SMatrix A, SMatrix B);
+
+/**
+@brief  Sparse-dense product A B
+@param  A: Pointer to sparse matrix (m x k, any format)
+        B: Pointer to dense matrix (k x n, any storage)
+@retval Pointer to dense product (m x n), NULL if dimensions do not match
+@note   Each stored a_ij adds a_ij * B(j, :) to row i: contiguous,
+        vectorized row updates, rows in parallel
+*/
+extern Matrix smatrix_product(SMatrix A, Matrix B);
+
+/**
+@brief  Transposes a sparse matrix
+@param  S: Pointer to matrix
+@retval Pointer to transposed matrix
+@note   CSR and CSC swap roles: the arrays are copied, not sorted
+*/
+extern SMatrix smatrix_transpose(SMatrix S);
+
+/**
+@brief  Deletes sparse matrix and frees allocated memory
+@param  S: Pointer to matrix
+@retval TRUE if matrix was deleted with no error, FALSE otherwise
+*/
+extern uint8_t smatrix_delete(SMatrix S);
+
+/**
+@brief  Prints the stored entries of a sparse matrix on screen
+@param  S: Pointer to matrix
+@retval TRUE if matrix was printed with no error, FALSE otherwise
+*/
+extern uint8_t smatrix_print(SMatrix S);
+
+#endif
@@ -0,0 +1,243 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_cmatrix.c
+ * Description   : Test file for complex matrices ADT.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_ComplexMatrix.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Largest benchmark size
+#define BENCH_MAX (size_t)(2048)
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Fills a matrix with reproducible pseudo-random values in [-1, 1]
+@param  M:    Pointer to matrix
+        seed: Generator state
+@retval none
+*/
+void fill(CMatrix M, uint32_t seed)
+{
+  size_t i = 0, j = 0;
+
+  for(i = 0; i < M->rows; i++)
+  {
+    for(j = 0; j < M->columns; j++)
+    {
+      seed = seed * 1664525u + 1013904223u;
+      M->re[i * M->ld + j] = (seed >> 8) / 8388608.0 - 1.0;
+      seed = seed * 1664525u + 1013904223u;
+      M->im[i * M->ld + j] = (seed >> 8) / 8388608.0 - 1.0;
+    }
+  }
+}
+
+/**
+@brief  Max. element-wise distance |A - B|
+@param  A, B: Pointers to matrices of equal dimensions
+@retval Distance
+*/
+double distance(CMatrix A, CMatrix B)
+{
+  size_t i = 0, j = 0;
+  double d = 0, e = 0;
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < A->columns; j++)
+    {
+      e = hypot(A->re[i * A->ld + j] - B->re[i * B->ld + j],
+                A->im[i * A->ld + j] - B->im[i * B->ld + j]);
+      d = (e > d) ? e : d;
+    }
+  }
+
+  return d;
+}
+
+/**
+@brief  Reference product (triple loop, one element at a time)
+@param  A, B: Pointers to matrices
+@retval Pointer to product matrix
+*/
+CMatrix naive_product(CMatrix A, CMatrix B)
+{
+  CMatrix P = CMx_Hdlr.init(A->rows, B->columns);
+  size_t i = 0, j = 0, k = 0;
+  double sr = 0, si = 0;
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < B->columns; j++)
+    {
+      sr = si = 0;
+
+      for(k = 0; k < A->columns; k++)
+      {
+        sr += A->re[i * A->ld + k] * B->re[k * B->ld + j] -
+              A->im[i * A->ld + k] * B->im[k * B->ld + j];
+        si += A->re[i * A->ld + k] * B->im[k * B->ld + j] +
+              A->im[i * A->ld + k] * B->re[k * B->ld + j];
+      }
+
+      P->re[i * P->ld + j] = sr;
+      P->im[i * P->ld + j] = si;
+    }
+  }
+
+  return P;
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  CMatrix A = NULL, B = NULL, C = NULL, D = NULL, I = NULL;
+  t_complex z = {0, 0, 0, 0};
+  Complex k = NULL;
+  size_t n = 0, runs = 0, i = 0;
+  struct timespec t0;
+  double t = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Small example
+  A = CMx_Hdlr.init(2, 3);
+  k = Cmplx_Hdlr.init(1.0, 2.0);   CMx_Hdlr.update(A, k, 0, 0);
+  k->Real = 0; k->Imag = -1;       CMx_Hdlr.update(A, k, 0, 2);
+  k->Real = 3; k->Imag = 0.5;      CMx_Hdlr.update(A, k, 1, 1);
+  printf("A =\n");        cmatrix_print(A);
+  B = CMx_Hdlr.herm(A);
+  printf("A^H =\n");      cmatrix_print(B);
+  C = CMx_Hdlr.product(A, B);
+  printf("A A^H =\n");    cmatrix_print(C);
+  CMx_Hdlr.get(C, 0, 0, &z);
+  printf("(A A^H)[0][0] = "); complex_print(&z, CARTESIAN);
+  D = CMx_Hdlr.scalar(k, A);
+  printf("(3 + 0.5i) A =\n"); cmatrix_print(D);
+  CMx_Hdlr.del(A); CMx_Hdlr.del(B); CMx_Hdlr.del(C); CMx_Hdlr.del(D);
+  Cmplx_Hdlr.del(k);
+  printf("\n");
+
+  // Blocked product against the triple loop (sizes crossing block edges)
+  for(n = 1; n <= 300; n = 3 * n + 4)
+  {
+    A = CMx_Hdlr.init(n, n + 3);
+    B = CMx_Hdlr.init(n + 3, n + 1);
+    fill(A, (uint32_t)n);
+    fill(B, (uint32_t)(n + 7));
+    C = CMx_Hdlr.product(A, B);
+    D = naive_product(A, B);
+    printf("Product %3zux%3zu * %3zux%3zu: max error = %.2e %s\n", n, n + 3,
+           n + 3, n + 1, distance(C, D),
+           distance(C, D) < 1e-12 * n ? "OK" : "FAIL");
+    CMx_Hdlr.del(A); CMx_Hdlr.del(B); CMx_Hdlr.del(C); CMx_Hdlr.del(D);
+  }
+
+  // Inverse: A inv(A) = I
+  for(n = 1; n <= 400; n = 4 * n + 3)
+  {
+    A = CMx_Hdlr.init(n, n);
+    fill(A, (uint32_t)(3 * n));
+    B = CMx_Hdlr.inv(A);
+    C = CMx_Hdlr.product(A, B);
+    I = CMx_Hdlr.eye(n);
+    printf("Inverse %3zux%3zu: |A inv(A) - I| = %.2e %s\n", n, n,
+           distance(C, I), distance(C, I) < 1e-9 ? "OK" : "FAIL");
+    CMx_Hdlr.del(A); CMx_Hdlr.del(B); CMx_Hdlr.del(C); CMx_Hdlr.del(I);
+  }
+
+  // Singular matrix (zero row: a pivot column is exactly zero)
+  A = CMx_Hdlr.init(3, 3);
+  fill(A, 11);
+  memset(&A->re[2 * A->ld], 0, 3 * sizeof(double));
+  memset(&A->im[2 * A->ld], 0, 3 * sizeof(double));
+  B = CMx_Hdlr.inv(A);
+  printf("Inverse of singular matrix: %s\n", B == NULL ? "NULL (OK)" : "FAIL");
+  CMx_Hdlr.del(A); CMx_Hdlr.del(B);
+
+  // Tiny entries: |a|^2 underflows, the matrix is still invertible
+  A = CMx_Hdlr.init(20, 20);
+  fill(A, 13);
+
+  for(i = 0; i < 20 * A->ld; i++)
+  {
+    A->re[i] *= 1e-170;
+    A->im[i] *= 1e-170;
+  }
+
+  B = CMx_Hdlr.inv(A);
+  C = CMx_Hdlr.product(A, B);
+  I = CMx_Hdlr.eye(20);
+  printf("Inverse of 1e-170 * A: %s\n",
+         (B != NULL && distance(C, I) < 1e-9) ? "OK" : "FAIL");
+  CMx_Hdlr.del(A); CMx_Hdlr.del(B); CMx_Hdlr.del(C); CMx_Hdlr.del(I);
+
+  // (A B)^H = B^H A^H
+  A = CMx_Hdlr.init(37, 50);
+  B = CMx_Hdlr.init(50, 29);
+  fill(A, 5);
+  fill(B, 6);
+  C = CMx_Hdlr.product(A, B);
+  D = CMx_Hdlr.herm(C);
+  CMx_Hdlr.del(C);
+  I = CMx_Hdlr.herm(A);
+  C = CMx_Hdlr.herm(B);
+  CMx_Hdlr.del(A);
+  A = CMx_Hdlr.product(C, I);
+  printf("(A B)^H = B^H A^H: %.2e %s\n", distance(A, D),
+         distance(A, D) < 1e-12 ? "OK" : "FAIL");
+  CMx_Hdlr.del(A); CMx_Hdlr.del(B); CMx_Hdlr.del(C); CMx_Hdlr.del(D);
+  CMx_Hdlr.del(I);
+  printf("\n");
+
+  // Product throughput (8 flops per complex multiply-add)
+  printf("* Benchmark (complex product) *\n");
+
+  for(n = 64; n <= BENCH_MAX; n *= 2)
+  {
+    A = CMx_Hdlr.init(n, n);
+    B = CMx_Hdlr.init(n, n);
+    fill(A, 1);
+    fill(B, 2);
+    runs = 0;
+    timespec_get(&t0, TIME_UTC);
+
+    do
+    {
+      C = CMx_Hdlr.product(A, B);
+      CMx_Hdlr.del(C);
+      runs++;
+      t = elapsed(t0);
+    } while(t < 0.2);
+
+    printf("N = %4zu: %7.2f GFLOPS\n", n,
+           8.0 * n * n * n * runs / t * 1e-9);
+    CMx_Hdlr.del(A); CMx_Hdlr.del(B);
+  }
+
+  printf("\n");
+  printf("***** END OF TEST *****");
+
+  return 0;
+}
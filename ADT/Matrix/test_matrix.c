@@ -0,0 +1,1514 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_matrix.c
+ * Description   : Test file for matrices ADT.
+ * Version       : 01.00
+ * Revision      : 13
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Matrix.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Benchmark sizes (the naive loop stops at BENCH_NAIVE)
+#define BENCH_MAX   (size_t)(4096)
+#define BENCH_NAIVE (size_t)(1024)
+
+// Tridiagonal system solved in the structured storage benchmark
+#define BENCH_TRIDIAG (size_t)(1000000)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Number of failed checks (exit status)
+size_t fails = 0;
+
+// GEMM on raw blocks (private function of ADT_Matrix.c, reachable with k = 0)
+extern uint8_t matrix_gemm_core(size_t m, size_t n, size_t k, Data alpha,
+                                const Data* A, size_t lda, uint8_t ta,
+                                const Data* B, size_t ldb, uint8_t tb,
+                                Data beta, Data* C, size_t ldc);
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Counts a failed check
+@param  none
+@retval failed(), to be printed by the check
+*/
+const char* failed(void)
+{
+  fails++;
+
+  return "FAIL";
+}
+
+/**
+@brief  Reference product C = A * B (triple loop)
+@param  A, B, C: Pointers to matrices
+@retval none
+*/
+void naive_product(Matrix A, Matrix B, Matrix C)
+{
+  size_t i = 0, j = 0, k = 0;
+  Data s = 0;
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < B->columns; j++)
+    {
+      for(k = 0, s = 0; k < A->columns; k++)
+      {
+        s += A->matrix[i][k] * B->matrix[k][j];
+      }
+
+      C->matrix[i][j] = s;
+    }
+  }
+}
+
+/**
+@brief  Reference transpose T = M^T (row by row)
+@param  M, T: Pointers to matrices (T is M->columns x M->rows)
+@retval none
+*/
+void naive_transpose(Matrix M, Matrix T)
+{
+  size_t i = 0, j = 0;
+
+  for(i = 0; i < M->rows; i++)
+  {
+    for(j = 0; j < M->columns; j++)
+    {
+      T->matrix[j][i] = M->matrix[i][j];
+    }
+  }
+}
+
+/**
+@brief  Reference element-wise operation (one element at a time)
+@param  op:   0: a A + b B, 1: A .* B, 2: A ./ B, 3: A .^ a
+        a, b: Scales (a is the exponent for op 3)
+        A, B: Pointers to operands
+        R:    Pointer to result
+@retval none
+*/
+void naive_ewise(int op, Data a, Matrix A, Data b, Matrix B, Matrix R)
+{
+  size_t i = 0, j = 0;
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < A->columns; j++)
+    {
+      R->matrix[i][j] = (op == 0) ? a * A->matrix[i][j] + b * B->matrix[i][j] :
+                        (op == 1) ? A->matrix[i][j] * B->matrix[i][j] :
+                        (op == 2) ? A->matrix[i][j] / B->matrix[i][j] :
+                                    pow(A->matrix[i][j], a);
+    }
+  }
+}
+
+/**
+@brief  Fills a square matrix with a random row-stochastic matrix (rows of
+        non-negative values adding up to 1), so that its powers stay bounded
+@param  M:    Pointer to matrix
+        seed: Generator state
+@retval none
+*/
+void fill_stochastic(Matrix M, uint32_t seed)
+{
+  size_t i = 0, j = 0;
+  double s = 0;
+
+  fill(M, seed);
+
+  for(i = 0; i < M->rows; i++)
+  {
+    for(j = 0, s = 0; j < M->columns; j++)
+    {
+      M->matrix[i][j] = fabs(M->matrix[i][j]);
+      s += M->matrix[i][j];
+    }
+
+    for(j = 0; j < M->columns; j++)
+    {
+      M->matrix[i][j] /= s;
+    }
+  }
+
+  Mx_Hdlr.touch(M);
+}
+
+/**
+@brief  Runs a product repeatedly for at least 0.2 s of wall time
+@param  A, B, C: Pointers to matrices
+        fast:    TRUE for matrix_gemm, FALSE for the naive loop
+@retval GFLOPS
+*/
+double bench(Matrix A, Matrix B, Matrix C, uint8_t fast)
+{
+  struct timespec t0, t1;
+  size_t runs = 0;
+  double t = 0;
+
+  timespec_get(&t0, TIME_UTC);
+
+  do
+  {
+    if(fast)
+    {
+      Mx_Hdlr.gemm(1, A, B, 0, C);
+    }
+    else
+    {
+      naive_product(A, B, C);
+    }
+
+    runs++;
+    timespec_get(&t1, TIME_UTC);
+    t = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+  } while(t < 0.2);
+
+  return 2.0 * A->rows * A->columns * B->columns * runs / t * 1e-9;
+}
+
+/**
+@brief  Checks that a mutation dropped the determinant cache of M and that
+        the next det matches a fresh factorization
+@param  M:    Pointer to square matrix (det called before the mutation)
+        path: Name of the mutating path
+@retval none
+*/
+void check_cache(Matrix M, const char* path)
+{
+  MatrixLU F = NULL;
+  uint8_t dropped = (M->dirty && M->lu == NULL);
+  double d = 0;
+
+  Mx_Hdlr.det(M, &d);
+  F = MxLU_Hdlr.init(M);
+  printf("%-23s dirty, det %+.6e %s\n", path, d,
+         (dropped && !M->dirty && d == MxLU_Hdlr.det(F)) ? "OK" : failed());
+  MxLU_Hdlr.del(F);
+}
+
+/**
+@brief  Random structured matrix with a dominant diagonal (well conditioned)
+@param  n:      Dimension
+        s:      Structure
+        kl, ku: Sub- / super-diagonals (MX_BANDED)
+        seed:   Generator state
+@retval Pointer to new matrix
+*/
+Matrix structured(size_t n, t_matrixStructure s, size_t kl, size_t ku,
+                  uint32_t seed)
+{
+  Matrix G = Mx_Hdlr.init(n, n), S = NULL;
+  size_t i = 0;
+
+  fill(G, seed);
+
+  for(i = 0; i < n; i++)
+  {
+    G->matrix[i][i] += 2 + kl + ku;
+  }
+
+  Mx_Hdlr.touch(G);
+  S = Mx_Hdlr.pack(G, s, kl, ku);
+  Mx_Hdlr.del(G);
+
+  return S;
+}
+
+/**
+@brief  Copy of a block of M, element by element (reference for views)
+@param  M:             Pointer to matrix
+        i, j:          Block origin
+        rows, columns: Block dimensions
+@retval Pointer to new matrix
+*/
+Matrix copy_block(Matrix M, size_t i, size_t j, size_t rows, size_t columns)
+{
+  Matrix B = Mx_Hdlr.init(rows, columns);
+  size_t r = 0, c = 0;
+
+  for(r = 0; r < rows; r++)
+  {
+    for(c = 0; c < columns; c++)
+    {
+      Mx_Hdlr.get(M, i + r, j + c, &B->data[r * B->ld + c]);
+    }
+  }
+
+  return B;
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  // New matrices
+  Matrix M1 = NULL, M2 = NULL, M3 = NULL, M4 = NULL;
+  MatrixLU F = NULL;
+  size_t i = 0, j = 0, n = 0;
+  double d = 0;
+  struct timespec t0, t1;
+  MatrixLU L = NULL;
+  Matrix V = NULL, W = NULL;
+  t_matrix Vb[3];                      // Block views in local storage
+  size_t cut[3] = {0, 0, 0};
+  double e = 0, c = 0;
+  const double expo[5] = {3, -2, 0.5, 2.7, 0};
+  uint64_t p = 0;
+  size_t runs = 0;
+  const char* name[6] = {"Diagonal", "Tridiagonal", "Banded (3, 2)",
+                         "Upper", "Lower", "Symmetric"};
+  const t_matrixStructure kind[6] = {MX_DIAGONAL, MX_BANDED, MX_BANDED,
+                                     MX_UPPER, MX_LOWER, MX_SYMMETRIC};
+  const size_t kl[6] = {0, 1, 3, 0, 0, 0}, ku[6] = {0, 1, 2, 0, 0, 0};
+  Matrix S1 = NULL, S2 = NULL, D1 = NULL, D2 = NULL;
+  Data x = 0;
+  double d2 = 0;
+  uint8_t ok = TRUE;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Initialize matrices
+  M1 = Mx_Hdlr.init(3, 4);
+  M2 = Mx_Hdlr.init(3, 4);
+  M3 = Mx_Hdlr.eye(4);
+
+  // Validate memory allocation
+  if(M1 == NULL || M2 == NULL || M3 == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  printf("M1 (%zu x %zu) is %s\n", Mx_Hdlr.row(M1), Mx_Hdlr.col(M1),
+         Mx_Hdlr.isNull(M1) ? "null" : "not null");
+
+  // Fill M1 and M2 with the same values
+  for(i = 0; i < Mx_Hdlr.row(M1); i++)
+  {
+    for(j = 0; j < Mx_Hdlr.col(M1); j++)
+    {
+      Mx_Hdlr.update(M1, 10 * i + j, i, j);
+      Mx_Hdlr.update(M2, 10 * i + j, i, j);
+    }
+  }
+
+  printf("M1 = \n"); matrix_print(M1);
+  printf("I4 = \n"); matrix_print(M3);
+  printf("M1 == M2: %s\n", Mx_Hdlr.areEqual(M1, M2) ? "TRUE" : "FALSE");
+  Mx_Hdlr.update(M2, -1, 2, 3);
+  printf("M1 == M2 (after update): %s\n",
+         Mx_Hdlr.areEqual(M1, M2) ? "TRUE" : "FALSE");
+  printf("Update out of range: %s\n",
+         Mx_Hdlr.update(M1, 0, 3, 0) ? "TRUE" : "FALSE (OK)");
+  printf("\n");
+
+  // Contiguous storage: row pointers view the aligned buffer
+  printf("Leading dimension: %zu, buffer aligned: %s\n", M1->ld,
+         ((uintptr_t)M1->data % MX_ALIGN == 0) ? "YES" : "NO");
+  printf("Row pointers inside buffer: %s\n",
+         (M1->matrix[2] == M1->data + 2 * M1->ld &&
+          M1->matrix[2][3] == 23) ? "YES" : "NO");
+  printf("\n");
+
+  // Delete matrices
+  if( !Mx_Hdlr.del(M1) || !Mx_Hdlr.del(M2) || !Mx_Hdlr.del(M3) )
+  {
+    printf("ERROR DELETING MATRICES\n");
+    exit(-1);
+  }
+
+  printf("Matrices deleted\n");
+  printf("\n");
+
+  // Dimensions beyond 255 (former uint8_t limit)
+  M1 = Mx_Hdlr.eye(300);
+  printf("I300: %zu x %zu, I[299][299] = %.1f, I[299][298] = %.1f\n",
+         Mx_Hdlr.row(M1), Mx_Hdlr.col(M1), M1->matrix[299][299],
+         M1->matrix[299][298]);
+  Mx_Hdlr.del(M1);
+
+  // 10^4-scale matrix: every row reachable through both views
+  M1 = Mx_Hdlr.init(10000, 1000);
+
+  if(M1 == NULL)
+  {
+    printf("ERROR IN MEMORY ALLOCATION\n");
+    exit(-1);
+  }
+
+  for(i = 0; i < Mx_Hdlr.row(M1); i++)
+  {
+    Mx_Hdlr.update(M1, (Data)i, i, i % Mx_Hdlr.col(M1));
+  }
+
+  for(i = 0, j = 0; i < Mx_Hdlr.row(M1); i++)
+  {
+    j += (M1->matrix[i][i % M1->columns] == (Data)i) ? 1 : 0;
+  }
+
+  printf("10000 x 1000: %zu / 10000 rows verified, ld = %zu\n", j, M1->ld);
+  Mx_Hdlr.del(M1);
+
+  // Power-of-two widths get an extra cache line per row
+  M1 = Mx_Hdlr.init(4, 1024);
+  printf("4 x 1024: ld = %zu\n", M1->ld);
+  Mx_Hdlr.del(M1);
+
+  // Sizes overflowing size_t are rejected instead of wrapping
+  M1 = Mx_Hdlr.init(SIZE_MAX / 16, 64);
+  printf("Overflowing size: %s\n", (M1 == NULL) ? "NULL (OK)" : failed());
+  M1 = Mx_Hdlr.init(2, SIZE_MAX - 1);
+  printf("Overflowing columns: %s\n", (M1 == NULL) ? "NULL (OK)" : failed());
+  printf("\n");
+
+  // Product against the triple loop (sizes crossing every block edge)
+  for(n = 1; n <= 700; n = 3 * n + 5)
+  {
+    M1 = Mx_Hdlr.init(n + 1, n + 300);
+    M2 = Mx_Hdlr.init(n + 300, n + 2);
+    fill(M1, (uint32_t)n);
+    fill(M2, (uint32_t)(n + 1));
+    M3 = Mx_Hdlr.product(M1, M2);
+    M4 = Mx_Hdlr.init(n + 1, n + 2);
+    naive_product(M1, M2, M4);
+    printf("Product %3zux%3zu * %3zux%3zu: max error = %.2e %s\n", n + 1,
+           n + 300, n + 300, n + 2, distance(M3, M4),
+           distance(M3, M4) < 1e-12 * (n + 300) ? "OK" : failed());
+
+    // C = 2 A B - 3 C
+    fill(M3, 9);
+    for(i = 0; i < M4->rows; i++)
+    {
+      for(j = 0; j < M4->columns; j++)
+      {
+        M4->matrix[i][j] = 2 * M4->matrix[i][j] - 3 * M3->matrix[i][j];
+      }
+    }
+
+    Mx_Hdlr.gemm(2, M1, M2, -3, M3);
+    printf("GEMM    %3zux%3zu * %3zux%3zu: max error = %.2e %s\n", n + 1,
+           n + 300, n + 300, n + 2, distance(M3, M4),
+           distance(M3, M4) < 1e-11 * (n + 300) ? "OK" : failed());
+    Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  }
+
+  M1 = Mx_Hdlr.init(3, 4);
+  M2 = Mx_Hdlr.init(5, 2);
+  printf("Product 3x4 * 5x2: %s\n", Mx_Hdlr.product(M1, M2) == NULL ?
+         "NULL (OK)" : failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+
+  // Empty inner dimension: A B = 0, so C = beta C (beta = 0 clears NaN too)
+  M1 = Mx_Hdlr.init(3, 4);
+  M3 = Mx_Hdlr.init(3, 4);
+  M4 = Mx_Hdlr.init(3, 4);
+  fill(M3, 5);
+  fill(M4, 5);
+
+  for(i = 0; i < 3; i++)
+  {
+    for(j = 0; j < 4; j++)
+    {
+      M4->matrix[i][j] *= 2;
+    }
+  }
+
+  e = (matrix_gemm_core(3, 4, 0, 1, NULL, 0, FALSE, NULL, 0, FALSE, 2,
+                        M3->data, M3->ld)) ? distance(M3, M4) : NAN;
+  M3->matrix[1][2] = NAN;
+  c = (matrix_gemm_core(3, 4, 0, 1, NULL, 0, FALSE, NULL, 0, FALSE, 0,
+                        M3->data, M3->ld)) ? distance(M3, M1) : NAN;
+  printf("GEMM with k = 0: beta = 2 %s, beta = 0 %s\n",
+         (e == 0) ? "OK" : failed(), (c == 0) ? "OK" : failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  printf("\n");
+
+  // Determinants of known matrices
+  M1 = Mx_Hdlr.init(3, 3);
+  M1->matrix[0][0] = 2; M1->matrix[0][1] = -3; M1->matrix[0][2] = 1;
+  M1->matrix[1][0] = 2; M1->matrix[1][1] =  0; M1->matrix[1][2] = -1;
+  M1->matrix[2][0] = 1; M1->matrix[2][1] =  4; M1->matrix[2][2] = 5;
+  Mx_Hdlr.det(M1, &d);
+  printf("det 3x3 = %.6f %s\n", d, fabs(d - 49) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.cof(M1, 0, 1, &d);
+  printf("cof(0, 1) = %.6f %s\n", d, fabs(d + 11) < 1e-12 ? "OK" : failed());
+  M2 = Mx_Hdlr.minor(M1, 1, 2);
+  printf("minor(1, 2) = [%g %g; %g %g] %s\n", M2->matrix[0][0],
+         M2->matrix[0][1], M2->matrix[1][0], M2->matrix[1][1],
+         (M2->matrix[0][1] == -3 && M2->matrix[1][0] == 1) ? "OK" : failed());
+  Mx_Hdlr.del(M2);
+  printf("minor(3, 0): %s\n", Mx_Hdlr.minor(M1, 3, 0) == NULL ?
+         "NULL (OK)" : failed());
+  Mx_Hdlr.del(M1);
+
+  // Permutation with one swap and a scaled identity
+  M1 = Mx_Hdlr.eye(5);
+  M1->matrix[1][1] = M1->matrix[3][3] = 0;
+  M1->matrix[1][3] = M1->matrix[3][1] = 1;
+  Mx_Hdlr.det(M1, &d);
+  printf("det swap(I5) = %.1f %s\n", d, d == -1 ? "OK" : failed());
+  Mx_Hdlr.del(M1);
+  M1 = Mx_Hdlr.eye(200);
+  for(i = 0; i < 200; i++)
+  {
+    M1->matrix[i][i] = (i % 2) ? 2 : 0.5;
+  }
+  Mx_Hdlr.det(M1, &d);
+  printf("det diag(0.5, 2, ...) 200x200 = %.6f %s\n", d,
+         fabs(d - 1) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M1);
+
+  // Singular matrix: zero row (exactly zero pivot)
+  M1 = Mx_Hdlr.init(150, 150);
+  fill(M1, 4);
+  memset(M1->matrix[149], 0, 150 * sizeof(Data));
+  Mx_Hdlr.touch(M1);
+  Mx_Hdlr.det(M1, &d);
+  printf("Singular 150x150: det = %g, inverse %s\n", d,
+         (d == 0 && Mx_Hdlr.inv(M1) == NULL) ? "NULL (OK)" : failed());
+
+  // Repeated row: rounding leaves a tiny pivot, not an exact zero; the
+  // determinant is negligible against the Hadamard bound (product of the
+  // row norms)
+  memcpy(M1->matrix[149], M1->matrix[7], 150 * sizeof(Data));
+  Mx_Hdlr.touch(M1);
+  Mx_Hdlr.det(M1, &d);
+
+  for(i = 0, c = 1; i < 150; i++)
+  {
+    for(j = 0, e = 0; j < 150; j++)
+    {
+      e += M1->matrix[i][j] * M1->matrix[i][j];
+    }
+
+    c *= sqrt(e);
+  }
+
+  printf("Repeated row 150x150: |det| / bound = %.1e %s\n", fabs(d) / c,
+         fabs(d) / c < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M1);
+
+  // Ill-conditioned, not singular: pivot far below n eps max|a|
+  M1 = Mx_Hdlr.eye(4);
+  M1->matrix[0][3] = 1;
+  M1->matrix[3][3] = 1e-17;
+  Mx_Hdlr.touch(M1);
+  Mx_Hdlr.det(M1, &d);
+  M2 = Mx_Hdlr.inv(M1);
+  printf("Ill-conditioned 4x4: det = %g, inverse %s\n", d,
+         (d == 1e-17 && M2 != NULL &&
+          fabs(M2->matrix[3][3] * 1e-17 - 1) < 1e-15 &&
+          M2->matrix[0][3] == -M2->matrix[3][3]) ? "OK" : failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+
+  // A inv(A) = I and residual of A X = B (sizes crossing panel edges)
+  for(n = 1; n <= 700; n = 3 * n + 7)
+  {
+    M1 = Mx_Hdlr.init(n, n);
+    fill(M1, (uint32_t)(5 * n));
+    M2 = Mx_Hdlr.inv(M1);
+    M3 = Mx_Hdlr.product(M1, M2);
+    M4 = Mx_Hdlr.eye(n);
+    printf("Inverse %3zux%3zu: |A inv(A) - I| = %.2e %s\n", n, n,
+           distance(M3, M4), distance(M3, M4) < 1e-8 ? "OK" : failed());
+    Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+
+    M2 = Mx_Hdlr.init(n, 3);
+    fill(M2, 77);
+    M3 = Mx_Hdlr.solve(M1, M2);
+    M4 = Mx_Hdlr.product(M1, M3);
+    printf("Solve   %3zux%3zu: |A X - B| = %.2e %s\n", n, n,
+           distance(M4, M2), distance(M4, M2) < 1e-9 ? "OK" : failed());
+    Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  }
+
+  // One factorization, several uses
+  M1 = Mx_Hdlr.init(64, 64);
+  fill(M1, 21);
+  F = MxLU_Hdlr.init(M1);
+  M2 = MxLU_Hdlr.inv(F);
+  Mx_Hdlr.det(M2, &d);
+  printf("det(inv(A)) det(A) = %.12f %s\n", d * MxLU_Hdlr.det(F),
+         fabs(d * MxLU_Hdlr.det(F) - 1) < 1e-9 ? "OK" : failed());
+  MxLU_Hdlr.del(F); Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+  printf("\n");
+
+  // Determinant cache: repeated calls are O(1), every mutation drops it
+  printf("* Determinant cache *\n");
+  M1 = Mx_Hdlr.init(64, 64);
+  M2 = Mx_Hdlr.init(64, 64);
+  M3 = Mx_Hdlr.init(64, 64);
+  fill(M1, 31); fill(M2, 32); fill(M3, 33);
+  printf("New matrix dirty: %s\n", (M1->dirty && M1->lu == NULL) ? "OK" :
+         failed());
+  Mx_Hdlr.det(M1, &d);
+  L = M1->lu;
+  timespec_get(&t0, TIME_UTC);
+
+  for(runs = 0; runs < 100000; runs++)
+  {
+    Mx_Hdlr.det(M1, &e);
+  }
+
+  timespec_get(&t1, TIME_UTC);
+  printf("100000 cached det calls (64x64): %.2e s %s\n",
+         (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9,
+         (e == d && M1->lu == L && !M1->dirty) ? "OK" : failed());
+  M4 = Mx_Hdlr.inv(M1);
+  Mx_Hdlr.del(M4);
+  M4 = Mx_Hdlr.solve(M1, M2);
+  Mx_Hdlr.cof(M1, 0, 0, &c);
+  printf("inv / solve / cof keep the cache: %s\n",
+         (M1->lu == L && !M1->dirty) ? "OK" : failed());
+
+  // update: det changes by delta * cofactor
+  Mx_Hdlr.cof(M1, 4, 7, &c);
+  Mx_Hdlr.update(M1, M1->matrix[4][7] + 0.5, 4, 7);
+  check_cache(M1, "update:");
+  Mx_Hdlr.det(M1, &e);
+  printf("  det(new) - det(old) = 0.5 cof(4, 7): %s\n",
+         fabs(e - d - 0.5 * c) <= 1e-9 * fabs(d) ? "OK" : failed());
+
+  // Failed update (out of range) leaves the cache alone
+  Mx_Hdlr.update(M1, 1, 64, 0);
+  printf("Out-of-range update keeps the cache: %s\n",
+         (!M1->dirty && M1->lu != NULL) ? "OK" : failed());
+
+  // Direct write: the cache is stale until touch
+  Mx_Hdlr.det(M1, &d);
+  L = M1->lu;
+  M1->matrix[10][10] += 1;
+  Mx_Hdlr.det(M1, &e);
+  printf("Raw write keeps the old det until touch: %s\n",
+         (e == d && M1->lu == L && !M1->dirty) ? "OK" : failed());
+  Mx_Hdlr.touch(M1);
+  check_cache(M1, "touch:");
+
+  // Raw write through a view: touching the view drops the base cache
+  V = Mx_Hdlr.view(M1, 8, 8, 4, 4, FALSE);
+  V->data[V->ld + 2] -= 1;
+  Mx_Hdlr.touch(V);
+  check_cache(M1, "touch of view:");
+  Mx_Hdlr.del(V);
+
+  // GEMM output (C = A B + C)
+  Mx_Hdlr.det(M3, &d);
+  Mx_Hdlr.gemm(1, M1, M2, 1, M3);
+  check_cache(M3, "gemm output:");
+
+  // GEMM inputs are not modified
+  printf("gemm inputs keep the cache: %s\n",
+         (!M1->dirty && M1->lu != NULL) ? "OK" : failed());
+
+  // LU solve output, in place and into another matrix
+  L = MxLU_Hdlr.init(M1);
+  Mx_Hdlr.det(M2, &d);
+  MxLU_Hdlr.solve(L, M2, M2);
+  check_cache(M2, "LU solve (in place):");
+  Mx_Hdlr.det(M4, &d);
+  MxLU_Hdlr.solve(L, M3, M4);
+  check_cache(M4, "LU solve (output):");
+  MxLU_Hdlr.del(L);
+
+  // In-place transpose and element-wise outputs
+  Mx_Hdlr.transpIP(M1);
+  check_cache(M1, "transpose in place:");
+  Mx_Hdlr.sumInto(M2, M2, M3);
+  check_cache(M2, "sum into:");
+  Mx_Hdlr.scalarInto(M2, 0.5, M2);
+  check_cache(M2, "scalar into:");
+  Mx_Hdlr.axpby(M2, 2, M2, -1, M3);
+  check_cache(M2, "axpby:");
+  Mx_Hdlr.eProductInto(M2, M3, M2);
+  check_cache(M2, "element product into:");
+  Mx_Hdlr.eDivisionInto(M2, M2, M3);
+  check_cache(M2, "element division into:");
+  Mx_Hdlr.ePowInto(M2, M2, 3);
+  check_cache(M2, "element power into:");
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  printf("\n");
+
+  // Transpose against the reference loop (sizes crossing tile and leaf edges)
+  printf("* Transpose *\n");
+
+  for(n = 1; n <= 700; n = 3 * n + 2)
+  {
+    M1 = Mx_Hdlr.init(n, 2 * n + 5);
+    fill(M1, (uint32_t)n);
+    M2 = Mx_Hdlr.transp(M1);
+    M3 = Mx_Hdlr.init(2 * n + 5, n);
+    naive_transpose(M1, M3);
+    printf("Transpose %3zux%4zu: %s", n, 2 * n + 5,
+           Mx_Hdlr.areEqual(M2, M3) ? "OK" : failed());
+    Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+
+    // In place (square)
+    M1 = Mx_Hdlr.init(n + 3, n + 3);
+    fill(M1, (uint32_t)(n + 9));
+    M2 = Mx_Hdlr.transp(M1);
+    Mx_Hdlr.transpIP(M1);
+    printf(", in place %3zux%3zu: %s\n", n + 3, n + 3,
+           Mx_Hdlr.areEqual(M1, M2) ? "OK" : failed());
+    Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+  }
+
+  M1 = Mx_Hdlr.init(3, 5);
+  printf("In place 3x5: %s\n", Mx_Hdlr.transpIP(M1) ? failed() : "FALSE (OK)");
+  Mx_Hdlr.del(M1);
+
+  // Transposed views: shared storage, no copies
+  M1 = Mx_Hdlr.init(150, 90);
+  fill(M1, 12);
+  V = Mx_Hdlr.transpView(M1);
+  M2 = Mx_Hdlr.transp(M1);
+  printf("View 90x150: shares storage %s, equals transpose %s\n",
+         (V->data == M1->data && V->rows == 90) ? "OK" : failed(),
+         Mx_Hdlr.areEqual(V, M2) ? "OK" : failed());
+  W = Mx_Hdlr.transpView(V);
+  printf("View of view: equals M %s\n", Mx_Hdlr.areEqual(W, M1) ? "OK" :
+         failed());
+  Mx_Hdlr.del(W);
+  Mx_Hdlr.update(V, 42, 7, 3);
+  printf("Update through view: M[3][7] = %.1f %s\n", M1->matrix[3][7],
+         M1->matrix[3][7] == 42 ? "OK" : failed());
+  W = Mx_Hdlr.transp(V);
+  printf("Transpose of view: %s\n", Mx_Hdlr.areEqual(W, M1) ? "OK" : failed());
+  Mx_Hdlr.del(W);
+
+  // Products reading A^T / B^T in place: A^T A, A A^T, A^T (A^T)^T
+  Mx_Hdlr.update(M2, 42, 7, 3);
+  M3 = Mx_Hdlr.product(V, M1);
+  M4 = Mx_Hdlr.init(90, 90);
+  naive_product(M2, M1, M4);
+  printf("A^T A (view):  max error = %.2e %s\n", distance(M3, M4),
+         distance(M3, M4) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  M3 = Mx_Hdlr.product(M1, V);
+  M4 = Mx_Hdlr.init(150, 150);
+  naive_product(M1, M2, M4);
+  printf("A A^T (view):  max error = %.2e %s\n", distance(M3, M4),
+         distance(M3, M4) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M3);
+
+  // Transposed output: (A A^T)^T written through a view
+  M3 = Mx_Hdlr.init(150, 150);
+  W = Mx_Hdlr.transpView(M3);
+  Mx_Hdlr.gemm(1, M1, V, 0, W);
+  Mx_Hdlr.transpIP(M4);
+  printf("gemm into view: max error = %.2e %s\n", distance(M3, M4),
+         distance(M3, M4) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(W);
+  W = Mx_Hdlr.transpView(V);
+  printf("gemm with C sharing A storage: %s\n",
+         Mx_Hdlr.gemm(1, M1, V, 0, W) ? failed() : "FALSE (OK)");
+  Mx_Hdlr.del(W); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+
+  // Determinant / inverse of a view: det(A^T) = det(A), inv(A^T) = inv(A)^T
+  M1 = Mx_Hdlr.init(77, 77);
+  fill(M1, 8);
+  V = Mx_Hdlr.transpView(M1);
+  Mx_Hdlr.det(M1, &d);
+  Mx_Hdlr.det(V, &e);
+  M2 = Mx_Hdlr.inv(V);
+  M3 = Mx_Hdlr.inv(M1);
+  Mx_Hdlr.transpIP(M3);
+  printf("det(A^T) = det(A): %s, inv(A^T) = inv(A)^T: %.2e %s\n",
+         fabs(d - e) <= 1e-12 * fabs(d) ? "OK" : failed(), distance(M2, M3),
+         distance(M2, M3) < 1e-10 ? "OK" : failed());
+  Mx_Hdlr.update(M1, M1->matrix[0][0] + 1, 0, 0);
+  Mx_Hdlr.det(M1, &d);
+  Mx_Hdlr.det(V, &e);
+  printf("View sees base update: %s\n", fabs(d - e) <= 1e-12 * fabs(d) ?
+         "OK" : failed());
+
+  // Reading a view keeps the factors cached by its base
+  F = M1->lu;
+  Mx_Hdlr.det(V, &e);
+  M4 = Mx_Hdlr.inv(V);
+  printf("Base cache after det / inv of view: %s\n",
+         (M1->lu == F && F != NULL && !M1->dirty) ? "OK" : failed());
+  Mx_Hdlr.del(M4);
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+  printf("\n");
+
+  // Element-wise operations against the reference loop
+  printf("* Element-wise operations *\n");
+  M1 = Mx_Hdlr.init(2, 3);
+  M2 = Mx_Hdlr.init(2, 3);
+  fill(M1, 1);
+  fill(M2, 2);
+  printf("A =\n");      matrix_print(M1);
+  printf("B =\n");      matrix_print(M2);
+  M3 = Mx_Hdlr.sum(M1, M2);
+  printf("A + B =\n");  matrix_print(M3); Mx_Hdlr.del(M3);
+  M3 = Mx_Hdlr.scalar(-2, M1);
+  printf("-2 A =\n");   matrix_print(M3); Mx_Hdlr.del(M3);
+  M3 = Mx_Hdlr.eProduct(M1, M2);
+  printf("A .* B =\n"); matrix_print(M3); Mx_Hdlr.del(M3);
+  M3 = Mx_Hdlr.eDivision(M1, M2);
+  printf("A ./ B =\n"); matrix_print(M3); Mx_Hdlr.del(M3);
+  M3 = Mx_Hdlr.ePow(M1, 2);
+  printf("A .^ 2 =\n"); matrix_print(M3); Mx_Hdlr.del(M3);
+  Mx_Hdlr.del(M2);
+  M2 = Mx_Hdlr.init(3, 2);
+  printf("2x3 + 3x2: %s\n", Mx_Hdlr.sum(M1, M2) == NULL ? "NULL (OK)" :
+         failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+
+  for(n = 1; n <= 700; n = 3 * n + 2)
+  {
+    M1 = Mx_Hdlr.init(n, n + 13);
+    M2 = Mx_Hdlr.init(n, n + 13);
+    M4 = Mx_Hdlr.init(n, n + 13);
+    fill(M1, (uint32_t)n);
+    fill(M2, (uint32_t)(n + 3));
+
+    naive_ewise(0, 1.5, M1, -0.25, M2, M4);
+    M3 = Mx_Hdlr.init(n, n + 13);
+    Mx_Hdlr.axpby(M3, 1.5, M1, -0.25, M2);
+    printf("%3zux%3zu: axpby %s", n, n + 13,
+           distance(M3, M4) == 0 ? "OK" : failed());
+    naive_ewise(0, 1, M1, 1, M2, M4);
+    Mx_Hdlr.sumInto(M3, M1, M2);
+    printf(", sum %s", distance(M3, M4) == 0 ? "OK" : failed());
+    naive_ewise(1, 0, M1, 0, M2, M4);
+    Mx_Hdlr.eProductInto(M3, M1, M2);
+    printf(", .* %s", distance(M3, M4) == 0 ? "OK" : failed());
+    naive_ewise(2, 0, M1, 0, M2, M4);
+    Mx_Hdlr.eDivisionInto(M3, M1, M2);
+    printf(", ./ %s", distance(M3, M4) == 0 ? "OK" : failed());
+
+    // Powers: repeated squaring within a few ulps of pow
+    for(i = 0, d = 0; i < 5; i++)
+    {
+      naive_ewise(3, expo[i], M1, 0, NULL, M4);
+      Mx_Hdlr.ePowInto(M3, M1, expo[i]);
+
+      for(j = 0; j < M3->rows * M3->columns; j++)
+      {
+        e = M4->matrix[j / M3->columns][j % M3->columns];
+        c = M3->matrix[j / M3->columns][j % M3->columns];
+        d = (isnan(e) && isnan(c)) ? d : fmax(d, fabs(c - e) / fabs(e));
+      }
+    }
+
+    printf(", .^ %s\n", d < 1e-14 ? "OK" : failed());
+
+    // In place: A = 2 A - B, then scaled back
+    naive_ewise(0, 2, M1, -1, M2, M4);
+    Mx_Hdlr.axpby(M1, 2, M1, -1, M2);
+    Mx_Hdlr.scalarInto(M4, 0.5, M4);
+    Mx_Hdlr.scalarInto(M1, 0.5, M1);
+    printf("         in place %s\n", distance(M1, M4) == 0 ? "OK" : failed());
+    Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  }
+
+  // Mixed orientations: A^T (view) + B, result written through a view
+  M1 = Mx_Hdlr.init(40, 70);
+  M2 = Mx_Hdlr.init(70, 40);
+  fill(M1, 3);
+  fill(M2, 4);
+  V = Mx_Hdlr.transpView(M1);
+  M3 = Mx_Hdlr.sum(V, M2);
+  M4 = Mx_Hdlr.transp(M1);
+  Mx_Hdlr.sumInto(M4, M4, M2);
+  printf("View + matrix: %s", Mx_Hdlr.areEqual(M3, M4) ? "OK" : failed());
+  W = Mx_Hdlr.init(40, 70);
+  Mx_Hdlr.del(M3);
+  M3 = Mx_Hdlr.transpView(W);
+  Mx_Hdlr.sumInto(M3, V, M2);
+  printf(", into view: %s", Mx_Hdlr.areEqual(M3, M4) ? "OK" : failed());
+  printf(", into view of operand: %s\n", Mx_Hdlr.sumInto(V, M2, M1) ||
+         Mx_Hdlr.scalarInto(V, 2, M1) ? failed() : "FALSE (OK)");
+  Mx_Hdlr.del(V); Mx_Hdlr.del(W); Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+  Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  printf("\n");
+
+  // Block views: offsets into the storage of the owner, no copies
+  printf("* Block views *\n");
+  M1 = Mx_Hdlr.init(150, 90);
+  fill(M1, 21);
+  V = Mx_Hdlr.view(M1, 20, 10, 50, 30, FALSE);
+  M2 = copy_block(M1, 20, 10, 50, 30);
+  printf("Block 50x30 at (20, 10): shares storage %s, equals copy %s\n",
+         V->data == &M1->data[20 * M1->ld + 10] ? "OK" : failed(),
+         Mx_Hdlr.areEqual(V, M2) ? "OK" : failed());
+  W = Mx_Hdlr.view(V, 5, 3, 10, 20, TRUE);
+  M3 = copy_block(M1, 25, 13, 10, 20);
+  M4 = Mx_Hdlr.transp(M3);
+  printf("Transposed block of block: %s\n", Mx_Hdlr.areEqual(W, M4) ?
+         "OK" : failed());
+  Mx_Hdlr.del(W); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  Mx_Hdlr.update(V, 42, 1, 2);
+  printf("Update through view: M[21][12] = %.1f %s\n", M1->matrix[21][12],
+         M1->matrix[21][12] == 42 ? "OK" : failed());
+  W = Mx_Hdlr.view(M1, 30, 0, 4, 90, FALSE);
+  printf("Row pointers: %s at column 0, %s elsewhere\n",
+         W->matrix != NULL && W->matrix[2] == M1->matrix[32] ? "kept (OK)" :
+         failed(), V->matrix == NULL ? "NULL (OK)" : failed());
+  Mx_Hdlr.del(W);
+  Mx_Hdlr.del(M2);
+  M2 = Mx_Hdlr.diag(NULL, 3);
+  printf("Outside the matrix: %s, structured owner: %s\n",
+         Mx_Hdlr.view(M1, 100, 0, 51, 30, FALSE) == NULL &&
+         Mx_Hdlr.view(M1, 0, 90, 1, 1, FALSE) == NULL ? "NULL (OK)" : failed(),
+         Mx_Hdlr.view(M2, 0, 0, 1, 1, FALSE) == NULL ? "NULL (OK)" : failed());
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M2);
+
+  // Rows and columns: 1 x n and n x 1 views, |row|^2 as a product
+  V = Mx_Hdlr.view(M1, 7, 0, 1, 90, FALSE);
+  W = Mx_Hdlr.view(M1, 7, 0, 1, 90, TRUE);
+  M2 = Mx_Hdlr.product(V, W);
+  for(j = 0, d = 0; j < 90; j++)
+  {
+    d += M1->matrix[7][j] * M1->matrix[7][j];
+  }
+  printf("Row x row^T: %s", M2 != NULL && M2->rows == 1 &&
+         fabs(M2->data[0] - d) <= 1e-12 * d ? "OK" : failed());
+  Mx_Hdlr.del(V); Mx_Hdlr.del(W); Mx_Hdlr.del(M2);
+  V = Mx_Hdlr.view(M1, 0, 4, 150, 1, FALSE);
+  M2 = Mx_Hdlr.scalar(2, V);
+  for(i = 0, ok = TRUE; i < 150; i++)
+  {
+    ok = ok && M2->data[i * M2->ld] == 2 * M1->matrix[i][4];
+  }
+  printf(", 2 x column: %s\n", ok ? "OK" : failed());
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M2); Mx_Hdlr.del(M1);
+
+  // Blocked product through local views: C(I, J) = sum_K A(I, K) B(K, J)
+  M1 = Mx_Hdlr.init(100, 80);
+  M2 = Mx_Hdlr.init(80, 70);
+  fill(M1, 22);
+  fill(M2, 23);
+  M3 = Mx_Hdlr.init(100, 70);
+  M4 = Mx_Hdlr.product(M1, M2);
+  cut[0] = 37; cut[1] = 41; cut[2] = 33;
+  for(i = 0, ok = TRUE; i < 2; i++)
+  {
+    for(j = 0; j < 2; j++)
+    {
+      for(n = 0; n < 2; n++)
+      {
+        ok = ok &&
+             Mx_Hdlr.viewInto(&Vb[0], M1, i * cut[0], n * cut[1],
+                              i ? 100 - cut[0] : cut[0],
+                              n ? 80 - cut[1] : cut[1], FALSE) &&
+             Mx_Hdlr.viewInto(&Vb[1], M2, n * cut[1], j * cut[2],
+                              n ? 80 - cut[1] : cut[1],
+                              j ? 70 - cut[2] : cut[2], FALSE) &&
+             Mx_Hdlr.viewInto(&Vb[2], M3, i * cut[0], j * cut[2],
+                              i ? 100 - cut[0] : cut[0],
+                              j ? 70 - cut[2] : cut[2], FALSE) &&
+             Mx_Hdlr.gemm(1, &Vb[0], &Vb[1], n ? 1 : 0, &Vb[2]);
+      }
+    }
+  }
+  printf("Blocked product (2 x 2 x 2): %.2e %s\n", distance(M3, M4),
+         ok && distance(M3, M4) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+
+  // Overlap: side-by-side blocks of one matrix are independent
+  M1 = Mx_Hdlr.init(60, 130);
+  fill(M1, 24);
+  Mx_Hdlr.viewInto(&Vb[0], M1, 0, 0, 60, 60, FALSE);
+  Mx_Hdlr.viewInto(&Vb[1], M1, 0, 65, 60, 60, FALSE);
+  M2 = Mx_Hdlr.product(&Vb[0], &Vb[0]);
+  printf("gemm into the right block of A: %s",
+         Mx_Hdlr.gemm(1, &Vb[0], &Vb[0], 0, &Vb[1]) &&
+         distance_any(&Vb[1], M2) == 0 ? "OK" : failed());
+  Mx_Hdlr.viewInto(&Vb[1], M1, 0, 30, 60, 60, FALSE);
+  printf(", into an overlapping block: %s\n",
+         Mx_Hdlr.gemm(1, &Vb[0], &Vb[0], 0, &Vb[1]) ? failed() : "FALSE (OK)");
+  Mx_Hdlr.del(M2);
+
+  // Element-wise R = A + R shifted by one column: read from a copy
+  Mx_Hdlr.viewInto(&Vb[0], M1, 0, 0, 60, 100, FALSE);
+  Mx_Hdlr.viewInto(&Vb[1], M1, 0, 1, 60, 100, FALSE);
+  M2 = Mx_Hdlr.sum(&Vb[0], &Vb[1]);
+  Mx_Hdlr.sumInto(&Vb[1], &Vb[0], &Vb[1]);
+  printf("Shifted in place sum: %s\n",
+         distance_any(&Vb[1], M2) == 0 ? "OK" : failed());
+  Mx_Hdlr.del(M2); Mx_Hdlr.del(M1);
+
+  // Solvers on a block: det, inverse, solve, in-place transpose
+  M1 = Mx_Hdlr.init(90, 90);
+  fill(M1, 25);
+  V = Mx_Hdlr.view(M1, 11, 17, 64, 64, FALSE);
+  M2 = copy_block(M1, 11, 17, 64, 64);
+  Mx_Hdlr.det(V, &d);
+  Mx_Hdlr.det(M2, &e);
+  M3 = Mx_Hdlr.inv(V);
+  M4 = Mx_Hdlr.inv(M2);
+  printf("det(block): %s, inv(block): %.2e %s\n",
+         fabs(d - e) <= 1e-12 * fabs(e) ? "OK" : failed(), distance(M3, M4),
+         distance(M3, M4) < 1e-10 ? "OK" : failed());
+  Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+  W = Mx_Hdlr.view(M1, 0, 0, 64, 3, FALSE);
+  M3 = Mx_Hdlr.solve(V, W);
+  M4 = Mx_Hdlr.solve(M2, W);
+  printf("solve(block, column block): %.2e %s\n", distance(M3, M4),
+         distance(M3, M4) < 1e-10 ? "OK" : failed());
+  Mx_Hdlr.del(M3); Mx_Hdlr.del(M4); Mx_Hdlr.del(W);
+  Mx_Hdlr.det(M1, &d);
+  Mx_Hdlr.transpIP(V);
+  Mx_Hdlr.transpIP(M2);
+  Mx_Hdlr.det(M1, &e);
+  printf("In-place transpose of block: %s, owner cache dropped: %s\n",
+         Mx_Hdlr.areEqual(V, M2) ? "OK" : failed(), d != e ? "OK" : failed());
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M2); Mx_Hdlr.del(M1);
+
+  // Creation cost: views in local storage, no allocation
+  M1 = Mx_Hdlr.init(512, 512);
+  timespec_get(&t0, TIME_UTC);
+  for(i = 0, x = 0; i < 10000000; i++)
+  {
+    Mx_Hdlr.viewInto(&Vb[0], M1, i % 500, (i / 500) % 500, 12, 12, i & 1);
+    x += Vb[0].data[0];
+  }
+  timespec_get(&t1, TIME_UTC);
+  printf("viewInto: %.1f ns per view %s\n",
+         ((t1.tv_sec - t0.tv_sec) * 1e9 + (t1.tv_nsec - t0.tv_nsec)) / 1e7,
+         x == 0 ? "OK" : failed());
+  Mx_Hdlr.del(M1);
+  printf("\n");
+
+  // Matrix power against repeated products
+  printf("* Matrix power *\n");
+  M1 = Mx_Hdlr.init(37, 37);
+  fill(M1, 17);
+  Mx_Hdlr.scalarInto(M1, 0.3, M1);
+  M2 = Mx_Hdlr.eye(37);
+  M3 = Mx_Hdlr.init(37, 37);
+
+  for(p = 0; p <= 33; p++)
+  {
+    M4 = Mx_Hdlr.pow(M1, p);
+    d = distance(M4, M2);
+    printf("%s%2u: %s", (p % 6 == 0) ? "M^" : ", M^", (unsigned)p,
+           d < 1e-12 ? "OK" : failed());
+    printf((p % 6 == 5 || p == 33) ? "\n" : "");
+    Mx_Hdlr.del(M4);
+
+    // M2 = M^(p + 1) for the next round
+    Mx_Hdlr.gemm(1, M2, M1, 0, M3);
+    W = M2; M2 = M3; M3 = W;
+  }
+
+  Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+
+  // M^(a + b) = M^a M^b (stochastic: entries stay in [0, 1])
+  fill_stochastic(M1, 18);
+  M2 = Mx_Hdlr.pow(M1, 1000);
+  M3 = Mx_Hdlr.pow(M1, 1023);
+  M4 = Mx_Hdlr.pow(M1, 23);
+  W = Mx_Hdlr.product(M2, M4);
+  printf("M^1023 = M^1000 M^23: %.2e %s\n", distance(M3, W),
+         distance(M3, W) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4); Mx_Hdlr.del(W);
+
+  // Transposed view: (M^T)^n = (M^n)^T
+  V = Mx_Hdlr.transpView(M1);
+  M2 = Mx_Hdlr.pow(V, 77);
+  M3 = Mx_Hdlr.pow(M1, 77);
+  Mx_Hdlr.transpIP(M3);
+  printf("(M^T)^77 = (M^77)^T: %s\n", distance(M2, M3) < 1e-14 ? "OK" :
+         failed());
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M1);
+
+  // Diagonal fast path (exact for powers of two entries)
+  M1 = Mx_Hdlr.eye(5);
+  M1->matrix[1][1] = -2; M1->matrix[2][2] = 0.5; M1->matrix[4][4] = 0;
+  Mx_Hdlr.touch(M1);
+  M2 = Mx_Hdlr.pow(M1, 9);
+  printf("diag(1, -2, 0.5, 1, 0)^9 = diag(%g, %g, %g, %g, %g) %s\n",
+         M2->matrix[0][0], M2->matrix[1][1], M2->matrix[2][2],
+         M2->matrix[3][3], M2->matrix[4][4],
+         (M2->matrix[1][1] == -512 && M2->matrix[2][2] == 1.0 / 512 &&
+          M2->matrix[4][4] == 0 && M2->matrix[0][1] == 0) ? "OK" : failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+  M1 = Mx_Hdlr.init(3, 4);
+  printf("Power of 3x4: %s\n", Mx_Hdlr.pow(M1, 2) == NULL ? "NULL (OK)" :
+         failed());
+  Mx_Hdlr.del(M1);
+  printf("\n");
+
+  // Structured storage: only the allowed elements are kept
+  printf("* Structured storage *\n");
+  V = Mx_Hdlr.diag(NULL, 4);
+  Mx_Hdlr.update(V, 3, 2, 2);
+  Mx_Hdlr.get(V, 2, 2, &x);
+  printf("Diagonal 4x4: (2, 2) = %g, (1, 2) <- 1: %s, <- 0: %s %s\n", x,
+         Mx_Hdlr.update(V, 1, 1, 2) ? "TRUE" : "FALSE",
+         Mx_Hdlr.update(V, 0, 1, 2) ? "TRUE" : "FALSE",
+         (x == 3 && V->matrix == NULL && !Mx_Hdlr.isNull(V)) ? "OK" : failed());
+  W = Mx_Hdlr.sym(4);
+  Mx_Hdlr.update(W, 5, 1, 3);
+  Mx_Hdlr.get(W, 3, 1, &x);
+  printf("Symmetric 4x4: (1, 3) <- 5, (3, 1) = %g %s\n", x,
+         x == 5 ? "OK" : failed());
+  printf("Invalid: band 4 (4, 0) %s, diag 0 %s, pack 3x4 %s, view %s\n",
+         Mx_Hdlr.band(4, 4, 0) == NULL ? "NULL (OK)" : failed(),
+         Mx_Hdlr.diag(NULL, 0) == NULL ? "NULL (OK)" : failed(),
+         Mx_Hdlr.pack(M1 = Mx_Hdlr.init(3, 4), MX_UPPER, 0, 0) == NULL ?
+         "NULL (OK)" : failed(), Mx_Hdlr.transpView(W) == NULL ? "NULL (OK)" :
+         failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+
+  // Every operation against the dense equivalent (n = 37, 5 right-hand
+  // sides, a 23 x 37 / 37 x 23 general factor)
+  n = 37;
+  M1 = Mx_Hdlr.init(n, 5);
+  M2 = Mx_Hdlr.init(23, n);
+  M3 = Mx_Hdlr.init(n, 23);
+  fill(M1, 30);
+  fill(M2, 31);
+  fill(M3, 32);
+
+  for(i = 0; i < 6; i++)
+  {
+    S1 = structured(n, kind[i], kl[i], ku[i], 40 + i);
+    S2 = structured(n, kind[i], kl[i], ku[i], 50 + i);
+    D1 = Mx_Hdlr.unpack(S1);
+    D2 = Mx_Hdlr.unpack(S2);
+    printf("%-14s", name[i]);
+
+    // Products: S S, A S, S B (same-structure product keeps it, except
+    // symmetric)
+    V = Mx_Hdlr.product(S1, S2);
+    W = Mx_Hdlr.product(D1, D2);
+    ok = (V != NULL && V->structure == ((kind[i] == MX_SYMMETRIC) ?
+          MX_GENERAL : kind[i]) && distance_any(V, W) < 1e-12);
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+    V = Mx_Hdlr.product(M2, S1);
+    W = Mx_Hdlr.product(M2, D1);
+    ok = ok && distance_any(V, W) < 1e-12;
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+    V = Mx_Hdlr.product(S1, M3);
+    W = Mx_Hdlr.product(D1, M3);
+    ok = ok && distance_any(V, W) < 1e-12;
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+
+    // GEMM: C = 2 S B - C; a structured C is rejected
+    W = Mx_Hdlr.init(n, 23);
+    fill(W, 33);
+    V = Mx_Hdlr.product(D1, M3);
+    Mx_Hdlr.axpby(V, 2, V, -1, W);
+    Mx_Hdlr.gemm(2, S1, M3, -1, W);
+    ok = ok && distance(V, W) < 1e-12 && !Mx_Hdlr.gemm(1, S1, D1, 0, S2);
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+    printf(" product %s", ok ? "OK" : failed());
+
+    // Solve and determinant
+    V = Mx_Hdlr.solve(S1, M1);
+    W = Mx_Hdlr.solve(D1, M1);
+    printf(", solve %s", distance_any(V, W) < 1e-12 ? "OK" : failed());
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+    Mx_Hdlr.det(S1, &d);
+    Mx_Hdlr.det(D1, &d2);
+    printf(", det %s", fabs(d - d2) <= 1e-10 * fabs(d2) ? "OK" : failed());
+
+    // Inverse and transpose (structures closed under both)
+    V = Mx_Hdlr.inv(S1);
+    W = Mx_Hdlr.inv(D1);
+    ok = (V != NULL && distance_any(V, W) < 1e-12 && V->structure ==
+          ((kind[i] == MX_BANDED) ? MX_GENERAL : kind[i]));
+    printf(", inv %s", ok ? "OK" : failed());
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+    V = Mx_Hdlr.transp(S1);
+    W = Mx_Hdlr.transp(D1);
+    ok = (V != NULL && distance_any(V, W) == 0 && V->kl == S1->ku);
+    printf(", transp %s", ok ? "OK" : failed());
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+
+    // Element-wise: structure kept for 2 S1 - S2, S1 .* S2, S1 .^ 3; a
+    // division fills in (except symmetric)
+    W = Mx_Hdlr.init(n, n);
+    V = Mx_Hdlr.init(n, n);
+    naive_ewise(0, 2, D1, -1, D2, W);
+    Mx_Hdlr.axpby(S2, 2, S1, -1, S2);
+    ok = (distance_any(S2, W) == 0);
+    naive_ewise(1, 0, D1, 0, D1, W);
+    Mx_Hdlr.eProductInto(S2, S1, S1);
+    ok = ok && distance_any(S2, W) == 0;
+    M4 = Mx_Hdlr.ePow(S1, 3);
+    naive_ewise(3, 3, D1, 0, NULL, W);
+    ok = ok && M4->structure == kind[i] && distance_any(M4, W) < 1e-14;
+    Mx_Hdlr.del(M4);
+    M4 = Mx_Hdlr.eDivision(S1, S1);
+    ok = ok && (M4->structure == MX_SYMMETRIC) == (kind[i] == MX_SYMMETRIC)
+         && Mx_Hdlr.eDivisionInto(S2, S1, S1) == (kind[i] == MX_SYMMETRIC);
+    Mx_Hdlr.del(M4);
+    Mx_Hdlr.sumInto(V, S1, D2);
+    naive_ewise(0, 1, D1, 1, D2, W);
+    ok = ok && distance(V, W) == 0;
+    printf(", ewise %s", ok ? "OK" : failed());
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+
+    // Power, equality, sparse-style null check
+    V = Mx_Hdlr.pow(S1, 5);
+    W = Mx_Hdlr.pow(D1, 5);
+    ok = (V != NULL && distance_any(V, W) < 1e-9 * fabs(W->matrix[0][0]));
+    printf(", pow %s", ok ? "OK" : failed());
+    Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+    printf(", equal %s\n", Mx_Hdlr.areEqual(S1, D1) && !Mx_Hdlr.isNull(S1) ?
+           "OK" : failed());
+    Mx_Hdlr.del(S1); Mx_Hdlr.del(S2); Mx_Hdlr.del(D1); Mx_Hdlr.del(D2);
+  }
+
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+
+  // Singular structures
+  S1 = Mx_Hdlr.tri(5, TRUE);
+  S2 = Mx_Hdlr.band(5, 1, 1);
+  M1 = Mx_Hdlr.eye(5);
+  Mx_Hdlr.det(S2, &d);
+  printf("Singular: triangular solve %s, inv %s, band det %g %s\n",
+         Mx_Hdlr.solve(S1, M1) == NULL ? "NULL (OK)" : failed(),
+         Mx_Hdlr.inv(S1) == NULL ? "NULL (OK)" : failed(), d,
+         d == 0 ? "OK" : failed());
+  Mx_Hdlr.del(S1); Mx_Hdlr.del(S2); Mx_Hdlr.del(M1);
+
+  // Zero diagonal: band LU must pivot (det = (-1)^(n / 2) for even n)
+  S1 = Mx_Hdlr.band(40, 1, 1);
+
+  for(i = 1; i < 40; i++)
+  {
+    Mx_Hdlr.update(S1, 1, i, i - 1);
+    Mx_Hdlr.update(S1, 1, i - 1, i);
+  }
+
+  D1 = Mx_Hdlr.unpack(S1);
+  M1 = Mx_Hdlr.init(40, 3);
+  fill(M1, 34);
+  V = Mx_Hdlr.solve(S1, M1);
+  W = Mx_Hdlr.solve(D1, M1);
+  Mx_Hdlr.det(S1, &d);
+  printf("Tridiagonal, zero diagonal: solve %s, det %g %s\n",
+         distance_any(V, W) < 1e-12 ? "OK" : failed(), d, d == 1 ? "OK" :
+         failed());
+  Mx_Hdlr.del(S1); Mx_Hdlr.del(D1); Mx_Hdlr.del(M1); Mx_Hdlr.del(V);
+  Mx_Hdlr.del(W);
+  printf("\n");
+
+  // Product throughput
+  printf("* Benchmark (matrix product, wall time) *\n");
+
+  for(n = 64; n <= BENCH_MAX; n *= 2)
+  {
+    M1 = Mx_Hdlr.init(n, n);
+    M2 = Mx_Hdlr.init(n, n);
+    M3 = Mx_Hdlr.init(n, n);
+    fill(M1, 1);
+    fill(M2, 2);
+
+    if(n <= BENCH_NAIVE)
+    {
+      d = bench(M1, M2, M3, TRUE);
+      d2 = bench(M1, M2, M3, FALSE);
+
+      // Blocking pays off once the operands leave L1
+      printf("N = %4zu: GEMM %7.2f GFLOPS, naive %5.2f GFLOPS, x%5.1f %s\n",
+             n, d, d2, d / d2, (n < 128 || d > 2 * d2) ? "OK" : failed());
+    }
+    else
+    {
+      printf("N = %4zu: GEMM %7.2f GFLOPS\n", n, bench(M1, M2, M3, TRUE));
+    }
+
+    Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+  }
+
+  printf("\n");
+
+  // LU factorization throughput (2/3 n^3 flops)
+  printf("* Benchmark (LU factorization, wall time) *\n");
+
+  for(n = 64; n <= BENCH_MAX; n *= 2)
+  {
+    M1 = Mx_Hdlr.init(n, n);
+    fill(M1, 3);
+    timespec_get(&t0, TIME_UTC);
+    F = MxLU_Hdlr.init(M1);
+    timespec_get(&t1, TIME_UTC);
+    d = (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+    printf("N = %4zu: %8.4f s, %6.2f GFLOPS\n", n, d,
+           2.0 / 3.0 * n * n * n / d * 1e-9);
+    MxLU_Hdlr.del(F); Mx_Hdlr.del(M1);
+  }
+
+  printf("\n");
+
+  // Transpose throughput (bytes read + written)
+  printf("* Benchmark (transpose, %zu x %zu, wall time) *\n", BENCH_MAX,
+         BENCH_MAX);
+  M1 = Mx_Hdlr.init(BENCH_MAX, BENCH_MAX);
+  fill(M1, 5);
+  d = 2.0 * BENCH_MAX * BENCH_MAX * sizeof(Data) * 1e-9;
+
+  // Both out-of-place variants include allocating the result
+  timespec_get(&t0, TIME_UTC);
+  M2 = Mx_Hdlr.init(BENCH_MAX, BENCH_MAX);
+  naive_transpose(M1, M2);
+  e = elapsed(t0);
+  printf("Naive loop: %7.4f s, %6.2f GB/s\n", e, d / e);
+  Mx_Hdlr.del(M2);
+  timespec_get(&t0, TIME_UTC);
+  M2 = Mx_Hdlr.transp(M1);
+  e = elapsed(t0);
+  printf("Blocked:    %7.4f s, %6.2f GB/s\n", e, d / e);
+  timespec_get(&t0, TIME_UTC);
+  Mx_Hdlr.transpIP(M1);
+  e = elapsed(t0);
+  printf("In place:   %7.4f s, %6.2f GB/s %s\n", e, d / e,
+         Mx_Hdlr.areEqual(M1, M2) ? "OK" : failed());
+  timespec_get(&t0, TIME_UTC);
+  V = Mx_Hdlr.transpView(M1);
+  printf("View:       %7.4f s\n", elapsed(t0));
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M1); Mx_Hdlr.del(M2);
+
+  // A^T B: transposing first vs reading A^T through a view
+  n = BENCH_MAX / 2;
+  M1 = Mx_Hdlr.init(n, n);
+  M2 = Mx_Hdlr.init(n, n);
+  M3 = Mx_Hdlr.init(n, n);
+  fill(M1, 6);
+  fill(M2, 7);
+  timespec_get(&t0, TIME_UTC);
+  M4 = Mx_Hdlr.transp(M1);
+  Mx_Hdlr.gemm(1, M4, M2, 0, M3);
+  printf("A^T B (%zu): transpose + product %7.4f s, ", n, elapsed(t0));
+  Mx_Hdlr.del(M4);
+  timespec_get(&t0, TIME_UTC);
+  V = Mx_Hdlr.transpView(M1);
+  Mx_Hdlr.gemm(1, V, M2, 0, M3);
+  printf("view %7.4f s\n", elapsed(t0));
+  Mx_Hdlr.del(V); Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+  printf("\n");
+
+  // Element-wise throughput (bytes read + written per element: 24)
+  printf("* Benchmark (element-wise, %zu x %zu, wall time) *\n", BENCH_MAX,
+         BENCH_MAX);
+  M1 = Mx_Hdlr.init(BENCH_MAX, BENCH_MAX);
+  M2 = Mx_Hdlr.init(BENCH_MAX, BENCH_MAX);
+  M3 = Mx_Hdlr.init(BENCH_MAX, BENCH_MAX);
+  fill(M1, 8);
+  fill(M2, 9);
+  d = 3.0 * BENCH_MAX * BENCH_MAX * sizeof(Data) * 1e-9;
+  timespec_get(&t0, TIME_UTC);
+
+  for(i = 0; i < BENCH_MAX; i++)
+  {
+    for(j = 0; j < BENCH_MAX; j++)
+    {
+      M3->matrix[i][j] = M1->matrix[i][j] + M2->matrix[i][j];
+    }
+  }
+
+  e = elapsed(t0);
+  printf("Sum, naive loop:        %7.4f s, %6.2f GB/s\n", e, d / e);
+  timespec_get(&t0, TIME_UTC);
+  M4 = Mx_Hdlr.sum(M1, M2);
+  e = elapsed(t0);
+  printf("Sum, new matrix:        %7.4f s, %6.2f GB/s\n", e, d / e);
+  Mx_Hdlr.del(M4);
+  timespec_get(&t0, TIME_UTC);
+  Mx_Hdlr.sumInto(M3, M1, M2);
+  e = elapsed(t0);
+  printf("Sum, into:              %7.4f s, %6.2f GB/s\n", e, d / e);
+  timespec_get(&t0, TIME_UTC);
+  Mx_Hdlr.sumInto(M1, M1, M2);
+  e = elapsed(t0);
+  printf("Sum, in place:          %7.4f s, %6.2f GB/s\n", e, d / e);
+  timespec_get(&t0, TIME_UTC);
+  Mx_Hdlr.scalarInto(M3, 2, M1);
+  Mx_Hdlr.scalarInto(M1, -3, M2);
+  Mx_Hdlr.sumInto(M3, M3, M1);
+  e = elapsed(t0);
+  printf("2A - 3B, three passes:  %7.4f s\n", e);
+  timespec_get(&t0, TIME_UTC);
+  Mx_Hdlr.axpby(M3, 2, M1, -3, M2);
+  e = elapsed(t0);
+  printf("2A - 3B, axpby:         %7.4f s, %6.2f GB/s\n", e, d / e);
+  timespec_get(&t0, TIME_UTC);
+  Mx_Hdlr.ePowInto(M3, M1, 5);
+  e = elapsed(t0);
+  printf("A .^ 5:                 %7.4f s\n", e);
+  timespec_get(&t0, TIME_UTC);
+  Mx_Hdlr.ePowInto(M3, M1, 5.5);
+  e = elapsed(t0);
+  printf("A .^ 5.5 (pow):         %7.4f s\n", e);
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+  printf("\n");
+
+  // Matrix power throughput (row-stochastic input: powers stay bounded)
+  printf("* Benchmark (matrix power, 512 x 512, wall time) *\n");
+  M1 = Mx_Hdlr.init(512, 512);
+  fill_stochastic(M1, 10);
+  timespec_get(&t0, TIME_UTC);
+  M2 = Mx_Hdlr.eye(512);
+  M3 = Mx_Hdlr.init(512, 512);
+
+  for(p = 0; p < 64; p++)
+  {
+    Mx_Hdlr.gemm(1, M2, M1, 0, M3);
+    W = M2; M2 = M3; M3 = W;
+  }
+
+  e = elapsed(t0);
+  M4 = Mx_Hdlr.pow(M1, 64);
+  printf("n =      64, repeated products: %8.4f s (%s)\n", e,
+         distance(M2, M4) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M2); Mx_Hdlr.del(M3); Mx_Hdlr.del(M4);
+
+  for(p = 1; p <= ((uint64_t)1 << 20); p <<= 4)
+  {
+    timespec_get(&t0, TIME_UTC);
+    M2 = Mx_Hdlr.pow(M1, p);
+    e = elapsed(t0);
+    printf("n = %7u, by squaring:        %8.4f s", (unsigned)p, e);
+    Mx_Hdlr.del(M2);
+
+    // All bits set: one product per squaring
+    timespec_get(&t0, TIME_UTC);
+    M2 = Mx_Hdlr.pow(M1, (p > 1) ? p - 1 : 1);
+    e = elapsed(t0);
+    printf(", n = %7u: %8.4f s\n", (unsigned)((p > 1) ? p - 1 : 1), e);
+
+    // Rows of a stochastic matrix keep adding up to 1
+    for(i = 0, d = 0; i < 512; i++)
+    {
+      for(j = 0, c = 0; j < 512; j++)
+      {
+        c += M2->matrix[i][j];
+      }
+
+      d = fmax(d, fabs(c - 1));
+    }
+
+    Mx_Hdlr.del(M2);
+
+    if(d > 1e-9)
+    {
+      printf("Row sums drifted: %.2e %s\n", d, failed());
+    }
+  }
+
+  M2 = Mx_Hdlr.eye(512);
+  Mx_Hdlr.scalarInto(M2, 1.0000001, M2);
+  timespec_get(&t0, TIME_UTC);
+  M3 = Mx_Hdlr.pow(M2, (uint64_t)1 << 20);
+  e = elapsed(t0);
+  printf("Diagonal, n = 2^20:                %8.4f s (%.6f %s)\n", e,
+         M3->matrix[7][7], fabs(M3->matrix[7][7] - pow(1.0000001, 1 << 20)) <
+         1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(M1); Mx_Hdlr.del(M2); Mx_Hdlr.del(M3);
+  printf("\n");
+
+  // Structured storage against the dense equivalent (LU / GEMM). The
+  // determinants overflow at this size: both must reach the same infinity
+  printf("* Benchmark (structured storage, n = 2000, wall time) *\n");
+  n = 2000;
+  M1 = Mx_Hdlr.init(n, 1);
+  fill(M1, 60);
+
+  for(i = 0; i < 4; i++)
+  {
+    S1 = structured(n, (i == 0) ? MX_DIAGONAL : (i == 3) ? MX_UPPER :
+                    MX_BANDED, (i == 2) ? 8 : 1, (i == 2) ? 8 : 1, 61);
+    D1 = Mx_Hdlr.unpack(S1);
+    timespec_get(&t0, TIME_UTC);
+    V = Mx_Hdlr.solve(S1, M1);
+    Mx_Hdlr.det(S1, &d);
+    e = elapsed(t0);
+    timespec_get(&t0, TIME_UTC);
+    W = Mx_Hdlr.solve(D1, M1);
+    Mx_Hdlr.det(D1, &d2);
+    c = elapsed(t0);
+
+    // Relative error: a triangular solve grows the solution with n
+    for(j = 0, x = 0; j < n; j++)
+    {
+      x = fmax(x, fabs(W->matrix[j][0]));
+    }
+
+    printf("%-22s solve + det %9.6f s, dense LU %7.4f s (%s)\n",
+           (i == 0) ? "Diagonal:" : (i == 1) ? "Tridiagonal:" :
+           (i == 2) ? "Banded (8, 8):" : "Upper triangular:", e, c,
+           (distance_any(V, W) <= 1e-10 * x && (d == d2 ||
+            fabs(d - d2) <= 1e-9 * fabs(d2))) ? "OK" : failed());
+    Mx_Hdlr.del(S1); Mx_Hdlr.del(D1); Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+  }
+
+  Mx_Hdlr.del(M1);
+
+  // Row scaling: diagonal times dense
+  S1 = structured(n, MX_DIAGONAL, 0, 0, 62);
+  D1 = Mx_Hdlr.unpack(S1);
+  M1 = Mx_Hdlr.init(n, n);
+  fill(M1, 63);
+  timespec_get(&t0, TIME_UTC);
+  V = Mx_Hdlr.product(S1, M1);
+  e = elapsed(t0);
+  timespec_get(&t0, TIME_UTC);
+  W = Mx_Hdlr.product(D1, M1);
+  c = elapsed(t0);
+  printf("Diagonal product:      %9.6f s, dense GEMM %7.4f s (%s)\n", e, c,
+         distance(V, W) < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(S1); Mx_Hdlr.del(D1); Mx_Hdlr.del(M1); Mx_Hdlr.del(V);
+  Mx_Hdlr.del(W);
+
+  // Tridiagonal system far beyond dense storage: (-1, 4, -1) x = A 1
+  S1 = Mx_Hdlr.band(BENCH_TRIDIAG, 1, 1);
+  M1 = Mx_Hdlr.init(BENCH_TRIDIAG, 1);
+
+  for(i = 0; i < BENCH_TRIDIAG; i++)
+  {
+    Mx_Hdlr.update(S1, 4, i, i);
+    Mx_Hdlr.update(S1, -1, i, (i > 0) ? i - 1 : i + 1);
+    Mx_Hdlr.update(S1, -1, i, (i + 1 < BENCH_TRIDIAG) ? i + 1 : i - 1);
+    M1->matrix[i][0] = 1;
+  }
+
+  V = Mx_Hdlr.product(S1, M1);
+  timespec_get(&t0, TIME_UTC);
+  W = Mx_Hdlr.solve(S1, V);
+  e = elapsed(t0);
+
+  for(i = 0, d = 0; i < BENCH_TRIDIAG; i++)
+  {
+    d = fmax(d, fabs(W->matrix[i][0] - 1));
+  }
+
+  printf("Tridiagonal solve, n = %zu: %.4f s (|x - 1| = %.1e %s)\n",
+         BENCH_TRIDIAG, e, d, d < 1e-12 ? "OK" : failed());
+  Mx_Hdlr.del(S1); Mx_Hdlr.del(M1); Mx_Hdlr.del(V); Mx_Hdlr.del(W);
+  printf("\n");
+
+  printf("***** END OF TEST *****");
+
+  return (fails == 0) ? 0 : 1;
+}
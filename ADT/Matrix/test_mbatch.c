@@ -0,0 +1,299 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_mbatch.c
+ * Description   : Test file for batches of small matrices.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_MatrixBatch.h"
+#include"ADT_MatrixFixed.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Test batches (not a multiple of MXB_LANES), benchmark batches of 4 x 4
+// matrices: one frame, and one that fits in L2 (512 KB per batch)
+#define TEST_COUNT  (size_t)(1000)
+#define BENCH_COUNT (size_t)(1000000)
+#define BENCH_CACHE (size_t)(4096)
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Random batch; matrices are diagonally dominant (well conditioned)
+@param  n:     Dimension
+        count: Number of matrices
+        seed:  Generator seed
+@retval Pointer to new batch
+*/
+MatrixBatch random_batch(size_t n, size_t count, uint32_t seed)
+{
+  MatrixBatch B = MxB_Hdlr.init(n, count);
+  size_t i = 0, j = 0, t = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    for(j = 0; j < n; j++)
+    {
+      for(t = 0; t < count; t++)
+      {
+        B->data[(i * n + j) * B->stride + t] = rnd(&seed) / 8388608.0 - 1.0 +
+                                               ((i == j) ? n : 0);
+      }
+    }
+  }
+
+  return B;
+}
+
+/**
+@brief  Checks products, inverses and determinants of one size against
+        t_matrix, with a singular matrix and one that needs row exchanges
+@param  n: Dimension
+@retval none
+*/
+void check_size(size_t n)
+{
+  MatrixBatch A = random_batch(n, TEST_COUNT, (uint32_t)n);
+  MatrixBatch B = random_batch(n, TEST_COUNT, (uint32_t)n + 100);
+  MatrixBatch P = MxB_Hdlr.init(n, TEST_COUNT);
+  MatrixBatch X = MxB_Hdlr.init(n, TEST_COUNT);
+  Matrix M = NULL, N = NULL, Q = NULL, E = Mx_Hdlr.eye(n);
+  Vector d = (Vector)malloc( TEST_COUNT * sizeof(Data) );
+  double e[3] = {0, 0, 0}, dm = 0;
+  size_t t = 0, i = 0, singular = 0;
+  uint8_t ok = TRUE;
+
+  // Matrix 3: reversed identity (zero pivots without row exchanges)
+  M = Mx_Hdlr.init(n, n);
+
+  for(i = 0; i < n; i++)
+  {
+    M->data[i * M->ld + (n - 1 - i)] = 1;
+  }
+
+  MxB_Hdlr.set(A, 3, M);
+  Mx_Hdlr.del(M);
+
+  // Matrix 7: second column zero
+  for(i = 0; i < n; i++)
+  {
+    A->data[(i * n + 1) * A->stride + 7] = 0;
+  }
+
+  ok = MxB_Hdlr.product(P, A, B) && MxB_Hdlr.inverse(X, A, &singular) &&
+       MxB_Hdlr.det(A, d);
+
+  for(t = 0; ok && t < TEST_COUNT; t++)
+  {
+    M = MxB_Hdlr.get(A, t);
+    N = MxB_Hdlr.get(B, t);
+    Q = Mx_Hdlr.product(M, N);
+    Mx_Hdlr.del(N);
+    N = MxB_Hdlr.get(P, t);
+    e[0] = fmax(e[0], distance(N, Q));
+    Mx_Hdlr.del(N);
+    Mx_Hdlr.del(Q);
+
+    N = MxB_Hdlr.get(X, t);
+    Q = Mx_Hdlr.product(M, N);
+    e[1] = (t == 7) ? e[1] : fmax(e[1], distance(Q, E));
+    ok = (t != 7) || (distance(N, Q) == 0 && d[t] == 0);
+    Mx_Hdlr.del(N);
+    Mx_Hdlr.del(Q);
+
+    Mx_Hdlr.det(M, &dm);
+    e[2] = fmax(e[2], fabs(d[t] - dm) / fmax(fabs(dm), 1));
+    Mx_Hdlr.del(M);
+  }
+
+  printf("%zu x %zu (%zu matrices): product %s, inverse %s, det %s, "
+         "singular %s\n", n, n, (size_t)TEST_COUNT,
+         ok && e[0] < 1e-12 ? "OK" : "FAIL",
+         ok && e[1] < 1e-12 ? "OK" : "FAIL",
+         ok && e[2] < 1e-12 ? "OK" : "FAIL",
+         singular == 1 ? "OK" : "FAIL");
+
+  // In place: inv(inv(A)) = A, A A in place
+  M = MxB_Hdlr.get(B, 5);
+  Q = Mx_Hdlr.product(M, M);
+  ok = MxB_Hdlr.inverse(B, B, NULL) && MxB_Hdlr.inverse(B, B, &singular) &&
+       singular == 0 && (N = MxB_Hdlr.get(B, 5)) != NULL &&
+       distance(M, N) < 1e-12;
+  Mx_Hdlr.del(N);
+  ok = ok && MxB_Hdlr.product(B, B, B) && (N = MxB_Hdlr.get(B, 5)) != NULL &&
+       distance(Q, N) < 1e-9;
+  printf("%zu x %zu in place: %s\n", n, n, ok ? "OK" : "FAIL");
+
+  Mx_Hdlr.del(M); Mx_Hdlr.del(N); Mx_Hdlr.del(Q); Mx_Hdlr.del(E);
+  MxB_Hdlr.del(A); MxB_Hdlr.del(B); MxB_Hdlr.del(P); MxB_Hdlr.del(X);
+  free(d);
+}
+
+/**
+@brief  Times products, inverses and determinants of 4 x 4 matrices: SoA
+        batch, array of t_mat4 and (inverse) one t_matrix per matrix
+@param  count: Matrices per batch
+        reps:  Repetitions of each batch call
+@retval none
+*/
+void bench(size_t count, size_t reps)
+{
+  MatrixBatch A = random_batch(4, count, 1);
+  MatrixBatch B = random_batch(4, count, 2);
+  MatrixBatch R = MxB_Hdlr.init(4, count);
+  Matrix M = Mx_Hdlr.init(4, 4), P = NULL;
+  Vector d = (Vector)malloc( count * sizeof(Data) );
+  t_mat4* a = (t_mat4*)malloc( count * sizeof(t_mat4) );
+  t_mat4* r = (t_mat4*)malloc( count * sizeof(t_mat4) );
+  struct timespec t0;
+  size_t i = 0, t = 0, k = 0, singular = 0, m = reps * count;
+  size_t mm = (count < BENCH_CACHE) ? count : BENCH_CACHE;
+  double ts[3] = {0, 0, 0}, ta[3] = {0, 0, 0}, tm = 0;
+
+  for(t = 0; t < count; t++)
+  {
+    for(i = 0; i < 16; i++)
+    {
+      a[t].m[i / 4][i % 4] = A->data[i * A->stride + t];
+    }
+  }
+
+  timespec_get(&t0, TIME_UTC);
+
+  for(k = 0; k < reps; k++)
+  {
+    MxB_Hdlr.product(R, A, B);
+  }
+
+  ts[0] = elapsed(t0);
+
+  timespec_get(&t0, TIME_UTC);
+
+  for(k = 0; k < reps; k++)
+  {
+    MxB_Hdlr.inverse(R, A, &singular);
+  }
+
+  ts[1] = elapsed(t0);
+
+  timespec_get(&t0, TIME_UTC);
+
+  for(k = 0; k < reps; k++)
+  {
+    MxB_Hdlr.det(A, d);
+  }
+
+  ts[2] = elapsed(t0);
+
+  timespec_get(&t0, TIME_UTC);
+
+  for(k = 0; k < reps; k++)
+  {
+    mat4_batch_product(a, a, r, count);
+  }
+
+  ta[0] = elapsed(t0);
+
+  timespec_get(&t0, TIME_UTC);
+
+  for(k = 0; k < reps; k++)
+  {
+    mat4_batch_inv(a, r, count);
+  }
+
+  ta[1] = elapsed(t0);
+
+  timespec_get(&t0, TIME_UTC);
+
+  for(k = 0; k < reps; k++)
+  {
+    mat4_batch_det(a, d, count);
+  }
+
+  ta[2] = elapsed(t0);
+
+  // t_matrix inverses on the first matrices only
+  timespec_get(&t0, TIME_UTC);
+
+  for(t = 0; t < mm; t++)
+  {
+    for(i = 0; i < 4; i++)
+    {
+      memcpy(&M->data[i * M->ld], a[t].m[i], 4 * sizeof(Data));
+    }
+
+    P = Mx_Hdlr.inv(M);
+    Mx_Hdlr.del(P);
+  }
+
+  tm = elapsed(t0) / mm;
+
+  printf("%zu x %zu matrices 4 x 4, ns per matrix (singular: %zu):\n",
+         reps, count, singular);
+  printf("  %-8s %10s %10s %10s\n", "", "SoA batch", "t_mat4", "t_matrix");
+  printf("  %-8s %10.2f %10.2f %10s\n", "product", ts[0] * 1e9 / m,
+         ta[0] * 1e9 / m, "");
+  printf("  %-8s %10.2f %10.2f %10.2f\n", "inverse", ts[1] * 1e9 / m,
+         ta[1] * 1e9 / m, tm * 1e9);
+  printf("  %-8s %10.2f %10.2f %10s\n", "det", ts[2] * 1e9 / m,
+         ta[2] * 1e9 / m, "");
+  printf("  Inverses: %.1f M matrices / s\n", m / ts[1] * 1e-6);
+  printf("\n");
+
+  MxB_Hdlr.del(A); MxB_Hdlr.del(B); MxB_Hdlr.del(R); Mx_Hdlr.del(M);
+  free(d); free(a); free(r);
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  MatrixBatch A = NULL, B = NULL, R = NULL;
+  Matrix M = NULL;
+  size_t n[5] = {2, 3, 4, 5, 8};
+  size_t i = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  for(i = 0; i < 5; i++)
+  {
+    check_size(n[i]);
+  }
+
+  A = MxB_Hdlr.init(3, 10);
+  B = MxB_Hdlr.init(3, 11);
+  R = MxB_Hdlr.init(4, 10);
+  M = Mx_Hdlr.init(4, 4);
+  printf("Mismatched sizes: %s\n",
+         !MxB_Hdlr.product(A, A, B) && !MxB_Hdlr.inverse(R, A, NULL) &&
+         !MxB_Hdlr.set(A, 0, M) && !MxB_Hdlr.set(R, 10, M) &&
+         MxB_Hdlr.get(A, 10) == NULL && MxB_Hdlr.init(0, 5) == NULL ?
+         "rejected (OK)" : "FAIL");
+  MxB_Hdlr.del(A); MxB_Hdlr.del(B); MxB_Hdlr.del(R); Mx_Hdlr.del(M);
+  printf("\n");
+
+  // One frame of 4 x 4 matrices (memory bound), then one batch that stays
+  // in cache, repeated to the same number of matrices
+  bench(BENCH_COUNT, 1);
+  bench(BENCH_CACHE, BENCH_COUNT / BENCH_CACHE);
+
+  printf("****** END OF TEST ******\n");
+
+  return 0;
+}
@@ -0,0 +1,491 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_meigen.c
+ * Description   : Test file for eigen-decomposition and SVD.
+ * Version       : 01.00
+ * Revision      : 02
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<float.h>
+#include"ADT_MatrixEigen.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Accepted errors, in units of DBL_EPSILON times dimension times max. |a_ij|
+#define TOL (double)(100)
+
+// Benchmark dimensions
+#define BENCH_SIZES (size_t)(4)
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Random matrix with elements in [-1, 1)
+@param  m, n: Dimensions
+        sym:  TRUE for a symmetric matrix (m = n)
+        seed: Generator seed
+@retval Pointer to new matrix
+*/
+Matrix random_matrix(size_t m, size_t n, uint8_t sym, uint32_t seed)
+{
+  Matrix A = Mx_Hdlr.init(m, n);
+  size_t i = 0, j = 0;
+
+  for(i = 0; i < m; i++)
+  {
+    for(j = 0; j < n; j++)
+    {
+      A->matrix[i][j] = (sym && j < i) ? A->matrix[j][i] :
+                        rnd(&seed) / 8388608.0 - 1.0;
+    }
+  }
+
+  return A;
+}
+
+/**
+@brief  Max. |a_ij|
+@param  A: Pointer to dense matrix
+@retval Max. element magnitude
+*/
+double max_abs(Matrix A)
+{
+  size_t i = 0, j = 0;
+  double d = 0;
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < A->columns; j++)
+    {
+      d = fmax(d, fabs(A->matrix[i][j]));
+    }
+  }
+
+  return d;
+}
+
+/**
+@brief  Orthonormality error max. |Q^T Q - I|
+@param  Q: Pointer to dense matrix
+@retval Error
+*/
+double orth_error(Matrix Q)
+{
+  Matrix T = Mx_Hdlr.transp(Q);
+  Matrix P = Mx_Hdlr.product(T, Q);
+  size_t i = 0, j = 0;
+  double d = 0;
+
+  for(i = 0; i < P->rows; i++)
+  {
+    for(j = 0; j < P->columns; j++)
+    {
+      d = fmax(d, fabs(P->matrix[i][j] - (i == j)));
+    }
+  }
+
+  Mx_Hdlr.del(T);
+  Mx_Hdlr.del(P);
+
+  return d;
+}
+
+/**
+@brief  Residual max. |A V - V diag(values)|
+@param  A: Pointer to dense matrix
+        E: Pointer to eigen-decomposition with vectors
+@retval Residual
+*/
+double eig_residual(Matrix A, MatrixEigen E)
+{
+  Matrix P = Mx_Hdlr.product(A, E->vectors);
+  size_t i = 0, j = 0;
+  double d = 0;
+
+  for(i = 0; i < E->n; i++)
+  {
+    for(j = 0; j < E->n; j++)
+    {
+      d = fmax(d, fabs(P->matrix[i][j] -
+                       E->vectors->matrix[i][j] * E->values[j]));
+    }
+  }
+
+  Mx_Hdlr.del(P);
+
+  return d;
+}
+
+/**
+@brief  Residual max. |A - U diag(s) V^T|
+@param  A: Pointer to dense matrix
+        S: Pointer to decomposition with vectors
+@retval Residual
+*/
+double svd_residual(Matrix A, MatrixSVD S)
+{
+  Matrix US = Mx_Hdlr.init(S->U->rows, S->k);
+  Matrix VT = Mx_Hdlr.transp(S->V);
+  Matrix P = NULL;
+  size_t i = 0, j = 0;
+  double d = 0;
+
+  for(i = 0; i < US->rows; i++)
+  {
+    for(j = 0; j < S->k; j++)
+    {
+      US->matrix[i][j] = S->U->matrix[i][j] * S->s[j];
+    }
+  }
+
+  P = Mx_Hdlr.product(US, VT);
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < A->columns; j++)
+    {
+      d = fmax(d, fabs(P->matrix[i][j] - A->matrix[i][j]));
+    }
+  }
+
+  Mx_Hdlr.del(US);
+  Mx_Hdlr.del(VT);
+  Mx_Hdlr.del(P);
+
+  return d;
+}
+
+/**
+@brief  Checks the eigen-decomposition of a symmetric matrix: residual,
+        orthonormality, order and eigenvalues without vectors
+@param  name: Label
+        A:    Pointer to dense symmetric matrix
+        ref:  Expected eigenvalues in ascending order (may be NULL)
+@retval none
+*/
+void check_eig(const char* name, Matrix A, const Data* ref)
+{
+  MatrixEigen E = MxE_Hdlr.sym(A, TRUE);
+  MatrixEigen F = MxE_Hdlr.sym(A, FALSE);
+  size_t n = A->rows, i = 0;
+  double scale = fmax(max_abs(A), DBL_MIN) * n * DBL_EPSILON;
+  double r = 0, o = 0, v = 0;
+  uint8_t ok = E != NULL && F != NULL && F->vectors == NULL;
+
+  if(ok)
+  {
+    r = eig_residual(A, E) / scale;
+    o = orth_error(E->vectors) / (n * DBL_EPSILON);
+
+    for(i = 0; i < n; i++)
+    {
+      ok = ok && (i == 0 || E->values[i - 1] <= E->values[i]);
+      v = fmax(v, fabs(E->values[i] - F->values[i]) / scale);
+      v = (ref != NULL) ? fmax(v, fabs(E->values[i] - ref[i]) / scale) : v;
+    }
+  }
+
+  printf("%-22s eigen: residual %5.2f, orth. %5.2f, values %5.2f  %s\n",
+         name, r, o, v, ok && r < TOL && o < TOL && v < TOL ? "OK" : "FAIL");
+
+  MxE_Hdlr.delEig(E);
+  MxE_Hdlr.delEig(F);
+}
+
+/**
+@brief  Checks the thin SVD of a matrix: residual, orthonormality, order and
+        singular values without vectors
+@param  name: Label
+        A:    Pointer to dense matrix
+        ref:  Expected singular values in descending order (may be NULL)
+@retval none
+*/
+void check_svd(const char* name, Matrix A, const Data* ref)
+{
+  MatrixSVD S = MxE_Hdlr.svd(A, TRUE);
+  MatrixSVD T = MxE_Hdlr.svd(A, FALSE);
+  size_t k = (A->rows < A->columns) ? A->rows : A->columns;
+  size_t n = (A->rows > A->columns) ? A->rows : A->columns, i = 0;
+  double scale = fmax(max_abs(A), DBL_MIN) * n * DBL_EPSILON;
+  double r = 0, o = 0, v = 0;
+  uint8_t ok = S != NULL && T != NULL && S->k == k && T->U == NULL &&
+               T->V == NULL;
+
+  if(ok)
+  {
+    ok = S->U->rows == A->rows && S->U->columns == k &&
+         S->V->rows == A->columns && S->V->columns == k;
+    r = svd_residual(A, S) / scale;
+    o = fmax(orth_error(S->U), orth_error(S->V)) / (n * DBL_EPSILON);
+
+    for(i = 0; i < k; i++)
+    {
+      ok = ok && S->s[i] >= 0 && (i == 0 || S->s[i - 1] >= S->s[i]);
+      v = fmax(v, fabs(S->s[i] - T->s[i]) / scale);
+      v = (ref != NULL) ? fmax(v, fabs(S->s[i] - ref[i]) / scale) : v;
+    }
+  }
+
+  printf("%-22s SVD:   residual %5.2f, orth. %5.2f, values %5.2f  %s\n",
+         name, r, o, v, ok && r < TOL && o < TOL && v < TOL ? "OK" : "FAIL");
+
+  MxE_Hdlr.delSVD(S);
+  MxE_Hdlr.delSVD(T);
+}
+
+/**
+@brief  Times eigen-decomposition and SVD of random n x n matrices, with and
+        without vectors
+@param  n: Dimension
+@retval none
+*/
+void bench(size_t n)
+{
+  Matrix A = random_matrix(n, n, TRUE, (uint32_t)n);
+  Matrix B = random_matrix(n, n, FALSE, (uint32_t)n + 1);
+  MatrixEigen E = NULL;
+  MatrixSVD S = NULL;
+  struct timespec t0;
+  double t[4] = {0, 0, 0, 0};
+
+  timespec_get(&t0, TIME_UTC);
+  E = MxE_Hdlr.sym(A, FALSE);
+  t[0] = elapsed(t0);
+  MxE_Hdlr.delEig(E);
+
+  timespec_get(&t0, TIME_UTC);
+  E = MxE_Hdlr.sym(A, TRUE);
+  t[1] = elapsed(t0);
+
+  timespec_get(&t0, TIME_UTC);
+  S = MxE_Hdlr.svd(B, FALSE);
+  t[2] = elapsed(t0);
+  MxE_Hdlr.delSVD(S);
+
+  timespec_get(&t0, TIME_UTC);
+  S = MxE_Hdlr.svd(B, TRUE);
+  t[3] = elapsed(t0);
+
+  printf("  %5zu %10.3f %10.3f %10.3f %10.3f\n", n, t[0], t[1], t[2], t[3]);
+
+  MxE_Hdlr.delEig(E);
+  MxE_Hdlr.delSVD(S);
+  Mx_Hdlr.del(A);
+  Mx_Hdlr.del(B);
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  Matrix A = NULL, B = NULL, C = NULL;
+  Vector ref = (Vector)malloc( 200 * sizeof(Data) );
+  MatrixEigen E = NULL;
+  MatrixSVD S = NULL;
+  size_t sizes[BENCH_SIZES] = {250, 500, 1000, 2000};
+  size_t n[6] = {1, 2, 3, 33, 100, 200};
+  size_t shape[5][2] = {{1, 7}, {7, 1}, {60, 35}, {35, 60}, {300, 70}};
+  char name[32];
+  size_t i = 0, j = 0;
+  double e = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Random symmetric matrices, across panel boundaries
+  for(i = 0; i < 6; i++)
+  {
+    A = random_matrix(n[i], n[i], TRUE, (uint32_t)n[i]);
+    sprintf(name, "Random %zu x %zu", n[i], n[i]);
+    check_eig(name, A, NULL);
+    Mx_Hdlr.del(A);
+  }
+
+  // 1-D Laplacian: eigenvalues 2 - 2 cos(k pi / (n + 1))
+  A = Mx_Hdlr.init(150, 150);
+
+  for(i = 0; i < 150; i++)
+  {
+    A->matrix[i][i] = 2;
+    ref[i] = 2 - 2 * cos((i + 1) * acos(-1.0) / 151);
+
+    if(i > 0)
+    {
+      A->matrix[i][i - 1] = -1;
+      A->matrix[i - 1][i] = -1;
+    }
+  }
+
+  check_eig("Laplacian 150 x 150", A, ref);
+  Mx_Hdlr.del(A);
+
+  // Repeated and unordered eigenvalues (already diagonal)
+  A = Mx_Hdlr.init(40, 40);
+
+  for(i = 0; i < 40; i++)
+  {
+    A->matrix[i][i] = (i % 4 == 0) ? 3 : (i % 4 == 1) ? -1 : 0.5;
+  }
+
+  for(i = 0; i < 40; i++)
+  {
+    ref[i] = (i < 10) ? -1 : (i < 30) ? 0.5 : 3;
+  }
+
+  check_eig("Repeated 40 x 40", A, ref);
+  Mx_Hdlr.del(A);
+
+  // Packed symmetric storage and a block view give the same eigenvalues
+  A = random_matrix(50, 50, TRUE, 7);
+  B = Mx_Hdlr.pack(A, MX_SYMMETRIC, 0, 0);
+  C = random_matrix(60, 60, FALSE, 8);
+
+  for(i = 0; i < 50; i++)
+  {
+    for(j = 0; j < 50; j++)
+    {
+      C->matrix[i + 5][j + 3] = A->matrix[i][j];
+    }
+  }
+
+  E = MxE_Hdlr.sym(A, FALSE);
+
+  for(i = 0; i < 50; i++)
+  {
+    ref[i] = E->values[i];
+  }
+
+  MxE_Hdlr.delEig(E);
+  check_eig("Symmetric 50 x 50", A, ref);
+  E = MxE_Hdlr.sym(B, TRUE);
+  Mx_Hdlr.del(B);
+  B = Mx_Hdlr.view(C, 5, 3, 50, 50, FALSE);
+
+  for(i = 0, e = 0; E != NULL && i < 50; i++)
+  {
+    e = fmax(e, fabs(E->values[i] - ref[i]));
+  }
+
+  MxE_Hdlr.delEig(E);
+  E = MxE_Hdlr.sym(B, FALSE);
+
+  for(i = 0; E != NULL && i < 50; i++)
+  {
+    e = fmax(e, fabs(E->values[i] - ref[i]));
+  }
+
+  printf("Packed / view input:   %s\n", E != NULL && e < 1e-12 ? "OK" : "FAIL");
+  MxE_Hdlr.delEig(E);
+  Mx_Hdlr.del(B);
+  Mx_Hdlr.del(C);
+  Mx_Hdlr.del(A);
+
+  A = Mx_Hdlr.init(3, 4);
+  printf("Not square:            %s\n",
+         MxE_Hdlr.sym(A, TRUE) == NULL && MxE_Hdlr.sym(NULL, FALSE) == NULL &&
+         MxE_Hdlr.svd(NULL, TRUE) == NULL && !MxE_Hdlr.delEig(NULL) &&
+         !MxE_Hdlr.delSVD(NULL) ? "rejected (OK)" : "FAIL");
+  Mx_Hdlr.del(A);
+  printf("\n");
+
+  // Random matrices: square, tall and wide
+  for(i = 0; i < 6; i++)
+  {
+    A = random_matrix(n[i], n[i], FALSE, (uint32_t)n[i] + 50);
+    sprintf(name, "Random %zu x %zu", n[i], n[i]);
+    check_svd(name, A, NULL);
+    Mx_Hdlr.del(A);
+  }
+
+  for(i = 0; i < 5; i++)
+  {
+    A = random_matrix(shape[i][0], shape[i][1], FALSE, (uint32_t)i + 90);
+    sprintf(name, "Random %zu x %zu", shape[i][0], shape[i][1]);
+    check_svd(name, A, NULL);
+    Mx_Hdlr.del(A);
+  }
+
+  // Rank 2: x y^T + y x^T; singular values |eigenvalues| of the pair
+  A = Mx_Hdlr.init(80, 80);
+
+  for(i = 0; i < 80; i++)
+  {
+    for(j = 0; j < 80; j++)
+    {
+      A->matrix[i][j] = sin(i + 1.0) * cos(j + 1.0) +
+                        cos(i + 1.0) * sin(j + 1.0);
+    }
+  }
+
+  E = MxE_Hdlr.sym(A, FALSE);
+
+  for(i = 2; i < 80; i++)
+  {
+    ref[i] = 0;
+  }
+
+  ref[0] = fmax(fabs(E->values[0]), fabs(E->values[79]));
+  ref[1] = fmin(fabs(E->values[0]), fabs(E->values[79]));
+  check_svd("Rank 2, 80 x 80", A, ref);
+  MxE_Hdlr.delEig(E);
+  Mx_Hdlr.del(A);
+
+  // Symmetric positive definite: singular values = eigenvalues
+  B = random_matrix(120, 120, FALSE, 11);
+  C = Mx_Hdlr.transp(B);
+  A = Mx_Hdlr.product(C, B);
+  E = MxE_Hdlr.sym(A, FALSE);
+
+  for(i = 0; i < 120; i++)
+  {
+    ref[i] = E->values[119 - i];
+  }
+
+  check_svd("SPD 120 x 120", A, ref);
+  MxE_Hdlr.delEig(E);
+  Mx_Hdlr.del(A);
+  Mx_Hdlr.del(C);
+
+  // Transposed view: singular values of B^T, vectors swapped
+  C = Mx_Hdlr.transpView(B);
+  S = MxE_Hdlr.svd(C, TRUE);
+  A = Mx_Hdlr.unpack(C);
+  printf("Transposed view:       %s\n",
+         S != NULL && svd_residual(A, S) < 1e-12 ? "OK" : "FAIL");
+  MxE_Hdlr.delSVD(S);
+  Mx_Hdlr.del(A);
+  Mx_Hdlr.del(C);
+  Mx_Hdlr.del(B);
+  printf("\n");
+
+  printf("Seconds (symmetric / general n x n):\n");
+  printf("  %5s %10s %10s %10s %10s\n", "n", "eig", "eig+vec", "svd",
+         "svd+vec");
+
+  for(i = 0; i < BENCH_SIZES; i++)
+  {
+    bench(sizes[i]);
+  }
+
+  printf("\n");
+
+  free(ref);
+
+  printf("****** END OF TEST ******\n");
+
+  return 0;
+}
@@ -0,0 +1,352 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_mfile.c
+ * Description   : Test file for binary matrix files.
+ * Version       : 01.00
+ * Revision      : 04
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_MatrixFile.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Benchmark sizes: text file, binary file (4096^2 doubles = 128 MB)
+#define BENCH_TEXT   (size_t)(2048)
+#define BENCH_BINARY (size_t)(4096)
+
+// Scratch files
+#define FILE_A    "test_mfile_a.bin"
+#define FILE_B    "test_mfile_b.bin"
+#define FILE_C    "test_mfile_c.bin"
+#define FILE_TEXT "test_mfile.txt"
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Number of failed checks (exit status)
+size_t fails = 0;
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Counts a failed check
+@param  none
+@retval failed(), to be printed by the check
+*/
+const char* failed(void)
+{
+  fails++;
+
+  return "FAIL";
+}
+
+/**
+@brief  Random dense matrix
+@param  rows, columns: Dimensions
+        seed:          Generator seed
+@retval Pointer to new matrix
+*/
+Matrix random_matrix(size_t rows, size_t columns, uint32_t seed)
+{
+  Matrix M = Mx_Hdlr.init(rows, columns);
+
+  fill(M, seed);
+
+  return M;
+}
+
+/**
+@brief  Saves a matrix, then checks it back through map, map with
+        verification and load
+@param  label: Case name
+        M:     Pointer to matrix
+@retval none
+*/
+void round_trip(const char* label, Matrix M)
+{
+  Matrix A = NULL, B = NULL, C = NULL;
+  uint8_t ok = FALSE;
+
+  ok = MxF_Hdlr.save(M, FILE_A);
+  A = MxF_Hdlr.map(FILE_A, FALSE);
+  B = MxF_Hdlr.map(FILE_A, TRUE);
+  C = MxF_Hdlr.load(FILE_A);
+
+  ok = ok && A != NULL && B != NULL && C != NULL &&
+       A->structure == (M->transposed ? MX_GENERAL : M->structure) &&
+       distance_any(A, M) == 0 && distance_any(B, M) == 0 &&
+       distance_any(C, M) == 0;
+
+  printf("%-20s %4zu x %-4zu: %s\n", label, M->rows, M->columns,
+         ok ? "OK" : failed());
+
+  Mx_Hdlr.del(A); Mx_Hdlr.del(B); Mx_Hdlr.del(C);
+}
+
+/**
+@brief  Overwrites one byte of a file
+@param  path:   File name
+        offset: Byte position
+@retval none
+*/
+void poke(const char* path, long offset)
+{
+  FILE* f = fopen(path, "r+b");
+  int c = 0;
+
+  fseek(f, offset, SEEK_SET);
+  c = fgetc(f);
+  fseek(f, offset, SEEK_SET);
+  fputc(c ^ 0x10, f);
+  fclose(f);
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  Matrix M = NULL, D = NULL, A = NULL, B = NULL, P = NULL, Q = NULL;
+  t_matrixFileHeader H;
+  struct timespec t0;
+  FILE* f = NULL;
+  char buf[64], *raw = NULL;
+  size_t budget[4] = {(size_t)1 << 16, (size_t)1 << 19, (size_t)1 << 23,
+                      (size_t)1 << 10};
+  size_t i = 0, j = 0, n = 0;
+  double t = 0, d1 = 0, d2 = 0, s = 0, e = 0;
+  Data k = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Round trips: padded rows, transposed view, every structure, 1 x 1
+  M = random_matrix(37, 53, 1);
+  round_trip("general", M);
+  A = Mx_Hdlr.transpView(M);
+  round_trip("transposed view", A);
+  Mx_Hdlr.del(A); Mx_Hdlr.del(M);
+
+  D = random_matrix(41, 41, 2);
+  A = Mx_Hdlr.pack(D, MX_DIAGONAL, 0, 0);   round_trip("diagonal", A);
+  Mx_Hdlr.del(A);
+  A = Mx_Hdlr.pack(D, MX_BANDED, 2, 3);     round_trip("banded (2, 3)", A);
+  Mx_Hdlr.del(A);
+  A = Mx_Hdlr.pack(D, MX_UPPER, 0, 0);      round_trip("upper", A);
+  Mx_Hdlr.del(A);
+  A = Mx_Hdlr.pack(D, MX_LOWER, 0, 0);      round_trip("lower", A);
+  Mx_Hdlr.del(A);
+  A = Mx_Hdlr.pack(D, MX_SYMMETRIC, 0, 0);  round_trip("symmetric", A);
+  Mx_Hdlr.del(A);
+  M = random_matrix(1, 1, 3);
+  round_trip("scalar", M);
+  Mx_Hdlr.del(M);
+
+  MxF_Hdlr.save(D, FILE_A);
+  printf("Header: %s\n", MxF_Hdlr.info(FILE_A, &H) && H.rows == 41 &&
+         H.ld == D->ld && H.offset == MXF_OFFSET &&
+         H.bytes == 41 * D->ld * sizeof(Data) ? "OK" : failed());
+  printf("\n");
+
+  // Operations on a mapped matrix; writes stay in the process
+  A = MxF_Hdlr.map(FILE_A, TRUE);
+  P = Mx_Hdlr.product(A, A);
+  Q = Mx_Hdlr.product(D, D);
+  printf("Mapped product: %s\n", distance_any(P, Q) == 0 ? "OK" : failed());
+  Mx_Hdlr.det(A, &d1);
+  Mx_Hdlr.det(D, &d2);
+  printf("Mapped det: %s\n", d1 == d2 ? "OK" : failed());
+  Mx_Hdlr.update(A, 42.0, 3, 4);
+  Mx_Hdlr.get(A, 3, 4, &k);
+  printf("Mapped update: %s\n", k == 42.0 ? "OK" : failed());
+  B = MxF_Hdlr.map(FILE_A, TRUE);
+  Mx_Hdlr.get(B, 3, 4, &k);
+  printf("File unchanged: %s\n",
+         B != NULL && k == D->data[3 * D->ld + 4] ? "OK" : failed());
+  Mx_Hdlr.del(A); Mx_Hdlr.del(B); Mx_Hdlr.del(P); Mx_Hdlr.del(Q);
+  printf("\n");
+
+  // Corruption, truncation and foreign files
+  poke(FILE_A, (long)MXF_OFFSET + 5 * sizeof(Data) + 3);
+  A = MxF_Hdlr.map(FILE_A, TRUE);
+  printf("Corrupt payload, verified map: %s\n",
+         A == NULL ? "rejected (OK)" : failed());
+  A = MxF_Hdlr.map(FILE_A, FALSE);
+  printf("Corrupt payload, unverified map: %s\n",
+         A != NULL && distance_any(A, D) > 0 ? "OK" : failed());
+  Mx_Hdlr.del(A);
+  A = MxF_Hdlr.load(FILE_A);
+  printf("Corrupt payload, load: %s\n", A == NULL ? "rejected (OK)" : failed());
+
+  MxF_Hdlr.save(D, FILE_A);
+  poke(FILE_A, 1);
+  printf("Bad signature: %s\n",
+         MxF_Hdlr.map(FILE_A, FALSE) == NULL && !MxF_Hdlr.info(FILE_A, &H) ?
+         "rejected (OK)" : failed());
+
+  // Truncated copy: header and half of the payload
+  MxF_Hdlr.save(D, FILE_A);
+  f = fopen(FILE_A, "rb");
+  raw = (char*)malloc( MXF_OFFSET + 41 * D->ld * sizeof(Data) / 2 );
+  n = fread(raw, 1, MXF_OFFSET + 41 * D->ld * sizeof(Data) / 2, f);
+  fclose(f);
+  f = fopen(FILE_B, "wb");
+  fwrite(raw, 1, n, f);
+  fclose(f);
+  free(raw);
+  printf("Truncated file: %s\n",
+         MxF_Hdlr.map(FILE_B, FALSE) == NULL &&
+         MxF_Hdlr.load(FILE_B) == NULL ? "rejected (OK)" : failed());
+  printf("Missing file: %s\n",
+         MxF_Hdlr.map("test_mfile_none.bin", FALSE) == NULL ?
+         "rejected (OK)" : failed());
+  Mx_Hdlr.del(D);
+  printf("\n");
+
+  // Out-of-core product: odd sizes, budgets from small tiles to all in
+  // memory, then one too small for a row of C
+  A = random_matrix(301, 203, 6);
+  B = random_matrix(203, 171, 7);
+  P = Mx_Hdlr.product(A, B);
+  MxF_Hdlr.save(A, FILE_A);
+  MxF_Hdlr.save(B, FILE_B);
+
+  for(i = 0; i < 3; i++)
+  {
+    Q = MxF_Hdlr.product(FILE_A, FILE_B, FILE_C, budget[i]) ?
+        MxF_Hdlr.map(FILE_C, TRUE) : NULL;
+    e = distance_any(P, Q);
+    printf("File product, budget %7zu B: %.2e %s\n", budget[i], e,
+           e < 1e-12 ? "OK" : failed());
+    Mx_Hdlr.del(Q);
+  }
+
+  printf("File product, budget %7zu B: %s\n", budget[3],
+         MxF_Hdlr.product(FILE_A, FILE_B, FILE_C, budget[3]) ? failed() :
+         "rejected (OK)");
+  printf("File product, dimension mismatch: %s\n",
+         MxF_Hdlr.product(FILE_B, FILE_B, FILE_C, budget[2]) ? failed() :
+         "rejected (OK)");
+  printf("File product, result over operand: %s\n",
+         MxF_Hdlr.product(FILE_A, FILE_B, FILE_A, budget[2]) ? failed() :
+         "rejected (OK)");
+  Mx_Hdlr.del(A); Mx_Hdlr.del(B); Mx_Hdlr.del(P);
+  printf("\n");
+
+  // Benchmark: text file (fprintf/fscanf) vs binary file
+  n = BENCH_TEXT;
+  M = random_matrix(n, n, 4);
+  timespec_get(&t0, TIME_UTC);
+  f = fopen(FILE_TEXT, "w");
+
+  for(i = 0; i < n; i++)
+  {
+    for(j = 0; j < n; j++)
+    {
+      fprintf(f, "%.17g%c", M->data[i * M->ld + j], j + 1 < n ? ' ' : '\n');
+    }
+  }
+
+  fclose(f);
+  t = elapsed(t0);
+  timespec_get(&t0, TIME_UTC);
+  f = fopen(FILE_TEXT, "r");
+  A = Mx_Hdlr.init(n, n);
+
+  for(i = 0; i < n; i++)
+  {
+    for(j = 0; j < n; j++)
+    {
+      if(fscanf(f, "%63s", buf) == 1)
+      {
+        Mx_Hdlr.update(A, strtod(buf, NULL), i, j);
+      }
+    }
+  }
+
+  fclose(f);
+  printf("Text   n = %4zu: write %7.3f s, read %7.3f s %s\n", n, t,
+         elapsed(t0), distance_any(A, M) == 0 ? "OK" : failed());
+  Mx_Hdlr.del(A); Mx_Hdlr.del(M);
+
+  n = BENCH_BINARY;
+  M = random_matrix(n, n, 5);
+  timespec_get(&t0, TIME_UTC);
+  MxF_Hdlr.save(M, FILE_A);
+  printf("Binary n = %4zu: write %7.3f s (%zu MB)\n", n, elapsed(t0),
+         n * M->ld * sizeof(Data) >> 20);
+
+  timespec_get(&t0, TIME_UTC);
+  A = MxF_Hdlr.map(FILE_A, FALSE);
+  t = elapsed(t0);
+  timespec_get(&t0, TIME_UTC);
+
+  // First touch: one element per page
+  for(i = 0, s = 0; i < n * A->ld; i += 4096 / sizeof(Data))
+  {
+    s += A->data[i];
+  }
+
+  printf("  map          %10.6f s, first touch of every page %7.3f s %s\n",
+         t, elapsed(t0), s == s ? "OK" : failed());
+  printf("  mapped = saved: %s\n", distance_any(A, M) == 0 ? "OK" : failed());
+  Mx_Hdlr.del(A);
+
+  timespec_get(&t0, TIME_UTC);
+  A = MxF_Hdlr.map(FILE_A, TRUE);
+  printf("  map + verify %10.6f s %s\n", elapsed(t0),
+         A != NULL ? "OK" : failed());
+  Mx_Hdlr.del(A);
+
+  timespec_get(&t0, TIME_UTC);
+  A = MxF_Hdlr.load(FILE_A);
+  printf("  load         %10.6f s %s\n", elapsed(t0),
+         A != NULL ? "OK" : failed());
+  Mx_Hdlr.del(A);
+
+  // Out-of-core vs in-memory product, M * M (operand pages cached)
+  timespec_get(&t0, TIME_UTC);
+  P = Mx_Hdlr.product(M, M);
+  t = elapsed(t0);
+  printf("Product n = %4zu in memory:        %7.3f s, %6.2f GFLOPS\n", n, t,
+         2.0 * n * n * n / t * 1e-9);
+
+  for(i = 0; i < 3; i++)
+  {
+    timespec_get(&t0, TIME_UTC);
+    Q = MxF_Hdlr.product(FILE_A, FILE_A, FILE_C, (size_t)256 << (20 - 2 * i)) ?
+        MxF_Hdlr.map(FILE_C, FALSE) : NULL;
+    t = elapsed(t0);
+    e = distance_any(P, Q);
+    printf("  out of core, budget %3zu MB: %7.3f s, %6.2f GFLOPS %s\n",
+           (size_t)256 >> (2 * i), t, 2.0 * n * n * n / t * 1e-9,
+           e < 1e-9 ? "OK" : failed());
+    Mx_Hdlr.del(Q);
+  }
+
+  Mx_Hdlr.del(P); Mx_Hdlr.del(M);
+
+  remove(FILE_A);
+  remove(FILE_B);
+  remove(FILE_C);
+  remove(FILE_TEXT);
+
+  printf("\n");
+  printf("****** END OF TEST ******\n");
+
+  return (fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,186 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_mfixed.c
+ * Description   : Test file for fixed-size matrices.
+ * Version       : 01.00
+ * Revision      : 03
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_MatrixFixed.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Benchmark: pairs per batch
+#define BENCH_BATCH (size_t)(100000)
+
+// Checks one size against t_matrix: product, inverse, determinant, singular
+// input, transpose, conversions and batches (in place)
+#define TEST_MAC(N)                                                           \
+  {                                                                           \
+    t_mat##N A, B, P, X, S, L[2];                                             \
+    Matrix MA = NULL, MB = NULL, MP = NULL, MX = NULL;                        \
+    Data d = 0, dl[2];                                                        \
+    double dm = 0, e = 0;                                                     \
+    size_t i = 0, j = 0;                                                      \
+    uint8_t ok = TRUE;                                                        \
+                                                                              \
+    for(i = 0; i < N; i++)                                                    \
+    {                                                                         \
+      for(j = 0; j < N; j++)                                                  \
+      {                                                                       \
+        A.m[i][j] = rnd(&seed) / 8388608.0 - 1.0 + (i == j ? N : 0);          \
+        B.m[i][j] = rnd(&seed) / 8388608.0 - 1.0;                             \
+      }                                                                       \
+    }                                                                         \
+                                                                              \
+    MA = mat##N##_to_matrix(A);                                               \
+    MB = mat##N##_to_matrix(B);                                               \
+    MP = Mx_Hdlr.product(MA, MB);                                             \
+    P = mat##N##_product(A, B);                                               \
+    MX = mat##N##_to_matrix(P);                                               \
+    printf("%zu x %zu product:   %s\n", (size_t)N, (size_t)N,                 \
+           distance(MX, MP) < 1e-12 ? "OK" : "FAIL");                         \
+    Mx_Hdlr.del(MX);                                                          \
+                                                                              \
+    ok = mat##N##_inv(A, &X);                                                 \
+    P = mat##N##_product(A, X);                                               \
+    MX = mat##N##_to_matrix(P);                                               \
+    Mx_Hdlr.del(MP);                                                          \
+    MP = Mx_Hdlr.eye(N);                                                      \
+    printf("%zu x %zu inverse:   %s\n", (size_t)N, (size_t)N,                 \
+           ok && distance(MX, MP) < 1e-12 ? "OK" : "FAIL");                   \
+                                                                              \
+    d = mat##N##_det(A);                                                      \
+    Mx_Hdlr.det(MA, &dm);                                                     \
+    printf("%zu x %zu det:       %s\n", (size_t)N, (size_t)N,                 \
+           fabs(d - dm) < 1e-12 * fabs(dm) ? "OK" : "FAIL");                  \
+                                                                              \
+    S = A;                                                                    \
+    X = B;                                                                    \
+    for(i = 0; i < N; i++)                                                    \
+    {                                                                         \
+      S.m[i][1] = 0;                                                          \
+    }                                                                         \
+    printf("%zu x %zu singular:  %s\n", (size_t)N, (size_t)N,                 \
+           !mat##N##_inv(S, &X) && mat##N##_areEqual(X, B) &&                 \
+           mat##N##_det(S) == 0 ? "rejected (OK)" : "FAIL");                  \
+                                                                              \
+    P = mat##N##_transp(A);                                                   \
+    for(i = 0, ok = TRUE; i < N; i++)                                         \
+    {                                                                         \
+      for(j = 0; j < N; j++)                                                  \
+      {                                                                       \
+        ok = ok && P.m[i][j] == A.m[j][i];                                    \
+      }                                                                       \
+    }                                                                         \
+    Mx_Hdlr.del(MB);                                                          \
+    MB = Mx_Hdlr.init(N, N + 1);                                              \
+    ok = ok && mat##N##_from_matrix(MA, &X) && mat##N##_areEqual(X, A) &&     \
+         !mat##N##_from_matrix(MB, &X);                                       \
+    printf("%zu x %zu transp/io: %s\n", (size_t)N, (size_t)N,                 \
+           ok ? "OK" : "FAIL");                                               \
+                                                                              \
+    L[0] = A; L[1] = S;                                                       \
+    mat##N##_batch_det(L, dl, 2);                                             \
+    ok = mat##N##_batch_inv(L, L, 2) == 1 &&                                  \
+         mat##N##_areEqual(L[1], mat##N##_zero());                            \
+    mat##N##_batch_product(L, (t_mat##N[]){A, A}, L, 2);                      \
+    e = 0;                                                                    \
+    for(i = 0; i < N; i++)                                                    \
+    {                                                                         \
+      for(j = 0; j < N; j++)                                                  \
+      {                                                                       \
+        e = fmax(e, fabs(L[0].m[i][j] - (i == j)));                           \
+      }                                                                       \
+    }                                                                         \
+    printf("%zu x %zu batches:   %s\n", (size_t)N, (size_t)N,                 \
+           ok && e < 1e-12 && dl[0] == d && dl[1] == 0 ? "OK" : "FAIL");      \
+                                                                              \
+    Mx_Hdlr.del(MA); Mx_Hdlr.del(MB); Mx_Hdlr.del(MP); Mx_Hdlr.del(MX);       \
+    printf("\n");                                                             \
+  }
+
+// Batch product throughput against one t_matrix product per pair
+#define BENCH_MAC(N)                                                          \
+  {                                                                           \
+    t_mat##N* A = (t_mat##N*)malloc( BENCH_BATCH * sizeof(t_mat##N) );        \
+    t_mat##N* R = (t_mat##N*)malloc( BENCH_BATCH * sizeof(t_mat##N) );        \
+    Matrix MA = NULL, MP = NULL;                                              \
+    size_t i = 0, j = 0, runs = 0;                                            \
+    struct timespec t0;                                                       \
+    double t1 = 0, t2 = 0;                                                    \
+                                                                              \
+    for(i = 0; i < BENCH_BATCH; i++)                                          \
+    {                                                                         \
+      for(j = 0; j < N * N; j++)                                              \
+      {                                                                       \
+        A[i].m[j / N][j % N] = rnd(&seed) / 8388608.0 - 1.0;                  \
+      }                                                                       \
+    }                                                                         \
+                                                                              \
+    timespec_get(&t0, TIME_UTC);                                              \
+    do                                                                        \
+    {                                                                         \
+      mat##N##_batch_product(A, A + 1, R, BENCH_BATCH - 1);                   \
+      runs++;                                                                 \
+      t1 = elapsed(t0);                                                       \
+    } while(t1 < 0.2);                                                        \
+    t1 /= runs * (BENCH_BATCH - 1);                                           \
+                                                                              \
+    MA = Mx_Hdlr.init(N, N);                                                  \
+    timespec_get(&t0, TIME_UTC);                                              \
+    for(i = 0; i + 1 < BENCH_BATCH; i++)                                      \
+    {                                                                         \
+      memcpy(MA->data, A[i].m, sizeof(A[i].m));                               \
+      MP = Mx_Hdlr.product(MA, MA);                                           \
+      Mx_Hdlr.del(MP);                                                        \
+    }                                                                         \
+    t2 = elapsed(t0) / (BENCH_BATCH - 1);                                     \
+                                                                              \
+    printf("%zu x %zu: batch %7.2f ns, t_matrix %7.2f ns, %5.1fx\n",          \
+           (size_t)N, (size_t)N, t1 * 1e9, t2 * 1e9, t2 / t1);                \
+                                                                              \
+    Mx_Hdlr.del(MA);                                                          \
+    free(A);                                                                  \
+    free(R);                                                                  \
+  }
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  uint32_t seed = 1;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  TEST_MAC(2)
+  TEST_MAC(3)
+  TEST_MAC(4)
+  TEST_MAC(5)
+  TEST_MAC(6)
+  TEST_MAC(7)
+  TEST_MAC(8)
+
+  printf("Batch product, per pair (%zu pairs):\n", BENCH_BATCH - 1);
+  BENCH_MAC(3)
+  BENCH_MAC(4)
+  BENCH_MAC(8)
+  printf("\n");
+
+  printf("****** END OF TEST ******\n");
+
+  return 0;
+}
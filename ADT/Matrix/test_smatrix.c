@@ -0,0 +1,446 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_smatrix.c
+ * Description   : Test file for sparse matrices ADT.
+ * Version       : 01.00
+ * Revision      : 04
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_SparseMatrix.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Benchmark sizes: random SpMV, banded SpMV, sparse vs dense
+#define BENCH_RANDOM (size_t)(100000)
+#define BENCH_BANDED (size_t)(1000000)
+#define BENCH_DENSE  (size_t)(4096)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Number of failed checks (exit status)
+size_t fails = 0;
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Counts a failed check
+@param  none
+@retval failed(), to be printed by the check
+*/
+const char* failed(void)
+{
+  fails++;
+
+  return "FAIL";
+}
+
+/**
+@brief  Random COO matrix with about k entries per row (duplicates allowed)
+@param  rows, columns: Dimensions
+        k:             Entries per row
+        seed:          Generator state
+@retval Pointer to new COO matrix
+*/
+SMatrix random_coo(size_t rows, size_t columns, size_t k, uint32_t seed)
+{
+  SMatrix S = SMx_Hdlr.init(rows, columns);
+  size_t i = 0, p = 0;
+
+  for(i = 0; i < rows; i++)
+  {
+    for(p = 0; p < k; p++)
+    {
+      SMx_Hdlr.add(S, rnd(&seed) / 8388608.0 - 1.0, i, rnd(&seed) % columns);
+    }
+  }
+
+  return S;
+}
+
+/**
+@brief  Banded COO matrix (half bandwidth w, diagonally dominant)
+@param  n: Dimension
+        w: Half bandwidth
+@retval Pointer to new COO matrix
+*/
+SMatrix banded_coo(size_t n, size_t w)
+{
+  SMatrix S = SMx_Hdlr.init(n, n);
+  size_t i = 0, j = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    for(j = (i > w) ? i - w : 0; j <= i + w && j < n; j++)
+    {
+      SMx_Hdlr.add(S, (i == j) ? 2.0 * w + 1 : -1.0, i, j);
+    }
+  }
+
+  return S;
+}
+
+/**
+@brief  Distance between a sparse matrix and a dense reference
+@param  S: Pointer to sparse matrix
+        D: Pointer to dense matrix
+@retval Distance
+*/
+double sdistance(SMatrix S, Matrix D)
+{
+  Matrix M = SMx_Hdlr.toDense(S);
+  double d = distance(M, D);
+
+  Mx_Hdlr.del(M);
+
+  return d;
+}
+
+/**
+@brief  Times SpMV on a matrix in CSR
+@param  label: Benchmark name
+        A:     Pointer to CSR matrix
+@retval none
+*/
+void bench_spmv(const char* label, SMatrix A)
+{
+  Vector x = (Vector)malloc(A->columns * sizeof(Data));
+  Vector y = (Vector)malloc(A->rows * sizeof(Data));
+  struct timespec t0;
+  size_t i = 0, runs = 0;
+  double t = 0;
+
+  for(i = 0; i < A->columns; i++)
+  {
+    x[i] = 1.0 / (i + 1);
+  }
+
+  timespec_get(&t0, TIME_UTC);
+
+  do
+  {
+    SMx_Hdlr.spmv(1.0, A, x, 0.0, y);
+    runs++;
+    t = elapsed(t0);
+  } while(t < 0.2);
+
+  // Streams val + col per entry, row pointers and y per row
+  printf("%-24s nnz = %8zu: %6.2f GFLOPS, %6.2f GB/s\n", label, A->nnz,
+         2.0 * A->nnz * runs / t * 1e-9,
+         (16.0 * A->nnz + 16.0 * A->rows) * runs / t * 1e-9);
+
+  free(x);
+  free(y);
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  SMatrix S = NULL, A = NULL, B = NULL, C = NULL, T = NULL;
+  Matrix D = NULL, E = NULL, F = NULL, V = NULL;
+  t_smatrixFormat fmt[3] = {SMX_COO, SMX_CSR, SMX_CSC};
+  const char* name[3] = {"COO", "CSR", "CSC"};
+  Vector x = NULL, y = NULL, z = NULL;
+  struct timespec t0;
+  size_t i = 0, j = 0, n = 0, f = 0, g = 0, runs = 0;
+  double t = 0, ts = 0, e = 0;
+  Data k = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  // Small example: assembly with a duplicate, conversions
+  S = SMx_Hdlr.init(3, 4);
+  SMx_Hdlr.add(S, 1.0, 0, 0);
+  SMx_Hdlr.add(S, 2.0, 2, 3);
+  SMx_Hdlr.add(S, -4.0, 1, 2);
+  SMx_Hdlr.add(S, 0.5, 2, 3);
+  SMx_Hdlr.add(S, 3.0, 0, 1);
+  printf("S =\n");        smatrix_print(S);
+  A = SMx_Hdlr.toCSR(S);
+  printf("CSR(S) =\n");   smatrix_print(A);
+  B = SMx_Hdlr.toCSC(S);
+  printf("CSC(S) =\n");   smatrix_print(B);
+  D = SMx_Hdlr.toDense(B);
+  printf("Dense(S) =\n"); matrix_print(D);
+  SMx_Hdlr.get(A, 2, 3, &k);
+  printf("S[2][3] = %.4f %s\n", k, k == 2.5 ? "OK" : failed());
+  SMx_Hdlr.get(B, 1, 1, &k);
+  printf("S[1][1] = %.4f %s\n", k, k == 0 ? "OK" : failed());
+  printf("Add out of range: %s\n",
+         SMx_Hdlr.add(S, 1.0, 3, 0) ? failed() : "rejected (OK)");
+  SMx_Hdlr.del(S); SMx_Hdlr.del(A); SMx_Hdlr.del(B); Mx_Hdlr.del(D);
+  printf("\n");
+
+  // Conversions between all formats against the dense reference
+  S = random_coo(97, 131, 9, 1);
+  D = SMx_Hdlr.toDense(S);
+
+  for(f = 0; f < 3; f++)
+  {
+    for(g = 0; g < 3; g++)
+    {
+      A = (fmt[f] == SMX_COO) ? SMx_Hdlr.toCOO(S) :
+          (fmt[f] == SMX_CSR) ? SMx_Hdlr.toCSR(S) : SMx_Hdlr.toCSC(S);
+      B = (fmt[g] == SMX_COO) ? SMx_Hdlr.toCOO(A) :
+          (fmt[g] == SMX_CSR) ? SMx_Hdlr.toCSR(A) : SMx_Hdlr.toCSC(A);
+      e = sdistance(B, D);
+      printf("%s -> %s: %.2e %s\n", name[f], name[g], e,
+             e < 1e-14 ? "OK" : failed());
+      SMx_Hdlr.del(A); SMx_Hdlr.del(B);
+    }
+  }
+
+  // Dense round trip (also from a transposed view)
+  A = SMx_Hdlr.fromDense(D);
+  B = SMx_Hdlr.toCSR(S);
+  printf("fromDense: nnz %zu / %zu, %.2e %s\n", A->nnz, B->nnz,
+         sdistance(A, D), A->nnz == B->nnz && sdistance(A, D) == 0 ?
+         "OK" : failed());
+  V = Mx_Hdlr.transpView(D);
+  E = Mx_Hdlr.transp(D);
+  C = SMx_Hdlr.fromDense(V);
+  printf("fromDense(view): %.2e %s\n", sdistance(C, E),
+         sdistance(C, E) == 0 ? "OK" : failed());
+  SMx_Hdlr.del(C);
+
+  // Transpose in every format
+  for(f = 0; f < 3; f++)
+  {
+    C = (fmt[f] == SMX_COO) ? SMx_Hdlr.toCOO(S) :
+        (fmt[f] == SMX_CSR) ? SMx_Hdlr.toCSR(S) : SMx_Hdlr.toCSC(S);
+    T = SMx_Hdlr.transp(C);
+    printf("Transpose (%s): %.2e %s\n", name[f], sdistance(T, E),
+           sdistance(T, E) == 0 ? "OK" : failed());
+    SMx_Hdlr.del(C); SMx_Hdlr.del(T);
+  }
+
+  SMx_Hdlr.del(A); SMx_Hdlr.del(B);
+  Mx_Hdlr.del(V); Mx_Hdlr.del(E);
+
+  // SpMV in every format: y = 2 S x - 0.5 y and y = S x
+  x = (Vector)malloc(S->columns * sizeof(Data));
+  y = (Vector)malloc(S->rows * sizeof(Data));
+  z = (Vector)malloc(S->rows * sizeof(Data));
+
+  for(i = 0; i < S->columns; i++)
+  {
+    x[i] = cos((double)i);
+  }
+
+  for(f = 0; f < 3; f++)
+  {
+    A = (fmt[f] == SMX_COO) ? SMx_Hdlr.toCOO(S) :
+        (fmt[f] == SMX_CSR) ? SMx_Hdlr.toCSR(S) : SMx_Hdlr.toCSC(S);
+
+    for(g = 0; g < 2; g++)
+    {
+      for(i = 0, e = 0; i < S->rows; i++)
+      {
+        y[i] = sin((double)i);
+        z[i] = g ? 0 : -0.5 * y[i];
+
+        for(j = 0; j < S->columns; j++)
+        {
+          z[i] += (g ? 1.0 : 2.0) * D->data[i * D->ld + j] * x[j];
+        }
+      }
+
+      SMx_Hdlr.spmv(g ? 1.0 : 2.0, A, x, g ? 0.0 : -0.5, y);
+
+      for(i = 0; i < S->rows; i++)
+      {
+        e = (fabs(y[i] - z[i]) > e) ? fabs(y[i] - z[i]) : e;
+      }
+
+      printf("SpMV (%s, %s): %.2e %s\n", name[f],
+             g ? "b = 0" : "b != 0", e, e < 1e-13 ? "OK" : failed());
+    }
+
+    SMx_Hdlr.del(A);
+  }
+
+  free(x); free(y); free(z);
+
+  // SpMM and sparse-dense products against dense products
+  A = random_coo(131, 75, 6, 2);
+  E = SMx_Hdlr.toDense(A);
+  F = Mx_Hdlr.product(D, E);
+
+  for(f = 0; f < 3; f++)
+  {
+    B = (fmt[f] == SMX_COO) ? SMx_Hdlr.toCOO(A) :
+        (fmt[f] == SMX_CSR) ? SMx_Hdlr.toCSR(A) : SMx_Hdlr.toCSC(A);
+    C = SMx_Hdlr.spmm(S, B);
+    printf("SpMM (COO * %s): %.2e %s\n", name[f], sdistance(C, F),
+           sdistance(C, F) < 1e-13 ? "OK" : failed());
+    SMx_Hdlr.del(B); SMx_Hdlr.del(C);
+  }
+
+  V = SMx_Hdlr.product(S, E);
+  printf("Sparse * dense: %.2e %s\n", distance(V, F),
+         distance(V, F) < 1e-13 ? "OK" : failed());
+  Mx_Hdlr.del(V);
+  C = SMx_Hdlr.transp(A);
+  Mx_Hdlr.del(E);
+  E = SMx_Hdlr.toDense(C);
+  V = Mx_Hdlr.transpView(E);
+  B = SMx_Hdlr.toCSC(S);
+  Mx_Hdlr.del(F);
+  F = SMx_Hdlr.product(B, V);
+  Mx_Hdlr.del(V);
+  V = Mx_Hdlr.transp(E);
+  Mx_Hdlr.del(E);
+  E = Mx_Hdlr.product(D, V);
+  printf("Sparse * dense (view): %.2e %s\n", distance(F, E),
+         distance(F, E) < 1e-13 ? "OK" : failed());
+  printf("Dimension mismatch: %s\n",
+         SMx_Hdlr.spmm(S, S) == NULL && SMx_Hdlr.product(S, D) == NULL ?
+         "NULL (OK)" : failed());
+
+  // Structured storage: scanned and multiplied as its dense equivalent
+  Mx_Hdlr.del(D); Mx_Hdlr.del(E); Mx_Hdlr.del(F); Mx_Hdlr.del(V);
+  F = Mx_Hdlr.band(75, 2, 1);
+
+  for(i = 0; i < 75; i++)
+  {
+    for(j = (i > 2) ? i - 2 : 0; j < 75 && j <= i + 1; j++)
+    {
+      Mx_Hdlr.update(F, 1.0 + i - 0.5 * j, i, j);
+    }
+  }
+
+  T = SMx_Hdlr.fromDense(F);
+  E = Mx_Hdlr.unpack(F);
+  D = SMx_Hdlr.product(A, E);
+  V = SMx_Hdlr.product(A, F);
+  printf("Banded (2, 1): nnz %zu, %.2e, product %.2e %s\n", T->nnz,
+         sdistance(T, E), distance(V, D), (T->nnz == 296 &&
+         sdistance(T, E) == 0 && distance(V, D) == 0) ? "OK" : failed());
+  SMx_Hdlr.del(T);
+  SMx_Hdlr.del(A); SMx_Hdlr.del(B); SMx_Hdlr.del(C);
+  Mx_Hdlr.del(D); Mx_Hdlr.del(E); Mx_Hdlr.del(F); Mx_Hdlr.del(V);
+
+  // Null matrix: empty, cancelling duplicates, nonzero
+  A = SMx_Hdlr.init(5, 5);
+  printf("Empty is null: %s\n", SMx_Hdlr.isNull(A) ? "OK" : failed());
+  SMx_Hdlr.add(A, 1.5, 3, 4);
+  SMx_Hdlr.add(A, -1.5, 3, 4);
+  B = SMx_Hdlr.toCSR(A);
+  printf("Cancelled entries are null: %s, nnz(CSR) = %zu %s\n",
+         SMx_Hdlr.isNull(A) ? "OK" : failed(), B->nnz,
+         B->nnz == 0 ? "OK" : failed());
+  printf("Random is null: %s\n", SMx_Hdlr.isNull(S) ? failed() : "no (OK)");
+  SMx_Hdlr.del(A); SMx_Hdlr.del(B); SMx_Hdlr.del(S);
+  printf("\n");
+
+  // SpMV throughput (CSR)
+  printf("* Benchmark (SpMV) *\n");
+  S = random_coo(BENCH_RANDOM, BENCH_RANDOM, 10, 3);
+  A = SMx_Hdlr.toCSR(S);
+  bench_spmv("Random, 10 per row:", A);
+  SMx_Hdlr.del(S); SMx_Hdlr.del(A);
+  S = banded_coo(BENCH_BANDED, 3);
+  A = SMx_Hdlr.toCSR(S);
+  bench_spmv("Banded, bandwidth 7:", A);
+
+  // Conversion and product throughput on the banded matrix
+  timespec_get(&t0, TIME_UTC);
+  B = SMx_Hdlr.toCSR(S);
+  printf("COO -> CSR (banded):      %8.2f ms\n", elapsed(t0) * 1e3);
+  timespec_get(&t0, TIME_UTC);
+  C = SMx_Hdlr.spmm(A, B);
+  printf("SpMM (banded)^2:          %8.2f ms, nnz = %zu\n",
+         elapsed(t0) * 1e3, C->nnz);
+  SMx_Hdlr.del(S); SMx_Hdlr.del(A); SMx_Hdlr.del(B); SMx_Hdlr.del(C);
+  printf("\n");
+
+  // Sparse against dense storage (0.1% density)
+  printf("* Benchmark (sparse vs dense, N = %zu, 0.1%%) *\n", BENCH_DENSE);
+  n = BENCH_DENSE;
+  S = random_coo(n, n, n / 1000, 4);
+  A = SMx_Hdlr.toCSR(S);
+  D = SMx_Hdlr.toDense(A);
+  E = Mx_Hdlr.init(n, 1);
+  fill(E, 5);
+  x = E->data;
+  y = (Vector)malloc(n * sizeof(Data));
+
+  runs = 0;
+  timespec_get(&t0, TIME_UTC);
+
+  do
+  {
+    SMx_Hdlr.spmv(1.0, A, x, 0.0, y);
+    runs++;
+    ts = elapsed(t0);
+  } while(ts < 0.2);
+
+  ts /= runs;
+
+  runs = 0;
+  timespec_get(&t0, TIME_UTC);
+
+  do
+  {
+    F = Mx_Hdlr.product(D, E);
+    Mx_Hdlr.del(F);
+    runs++;
+    t = elapsed(t0);
+  } while(t < 0.2);
+
+  t /= runs;
+  printf("Matrix-vector: %9.3f ms dense, %9.3f ms sparse (x%.0f)\n",
+         t * 1e3, ts * 1e3, t / ts);
+
+  Mx_Hdlr.del(E);
+
+  // Null test on a null matrix (worst case: every element is read)
+  B = SMx_Hdlr.init(n, n);
+  E = Mx_Hdlr.init(n, n);
+  timespec_get(&t0, TIME_UTC);
+  g = SMx_Hdlr.isNull(B);
+  ts = elapsed(t0);
+  timespec_get(&t0, TIME_UTC);
+  f = Mx_Hdlr.isNull(E);
+  t = elapsed(t0);
+  printf("Null test:     %9.3f ms dense, %9.3f ms sparse %s\n",
+         t * 1e3, ts * 1e3, f && g ? "OK" : failed());
+  SMx_Hdlr.del(B); Mx_Hdlr.del(E);
+  free(y);
+
+  // Sparse * dense (N x 256) against the dense product
+  E = Mx_Hdlr.init(n, 256);
+  fill(E, 6);
+  timespec_get(&t0, TIME_UTC);
+  F = SMx_Hdlr.product(A, E);
+  ts = elapsed(t0);
+  timespec_get(&t0, TIME_UTC);
+  V = Mx_Hdlr.product(D, E);
+  t = elapsed(t0);
+  printf("Times N x 256: %9.3f ms dense, %9.3f ms sparse %s\n",
+         t * 1e3, ts * 1e3, distance(F, V) < 1e-12 ? "OK" : failed());
+  SMx_Hdlr.del(S); SMx_Hdlr.del(A);
+  Mx_Hdlr.del(D); Mx_Hdlr.del(E); Mx_Hdlr.del(F); Mx_Hdlr.del(V);
+
+  printf("\n");
+  printf("***** END OF TEST *****");
+
+  return (fails == 0) ? 0 : 1;
+}
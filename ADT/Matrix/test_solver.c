@@ -0,0 +1,367 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_solver.c
+ * Description   : Test file for iterative solvers.
+ * Version       : 01.00
+ * Revision      : 04
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include"ADT_Solver.h"
+#include"../test_helpers.h"
+
+//----------------------------------------------------------------------------//
+//                                  Macros                                    //
+//----------------------------------------------------------------------------//
+
+// Grid side of the test problems and of the benchmark (n = side^2)
+#define TEST_GRID  (size_t)(64)
+#define BENCH_GRID (size_t)(512)
+
+// Grid side of the dense benchmark against LU
+#define BENCH_DENSE (size_t)(40)
+
+//----------------------------------------------------------------------------//
+//                            General definitions                             //
+//----------------------------------------------------------------------------//
+
+// Number of failed checks (exit status)
+size_t fails = 0;
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Counts a failed check
+@param  none
+@retval failed(), to be printed by the check
+*/
+const char* failed(void)
+{
+  fails++;
+
+  return "FAIL";
+}
+
+/**
+@brief  Five-point finite difference operator on a k x k grid
+@param  k: Grid side (n = k^2 unknowns)
+        c: Convection (0: Poisson, symmetric; c != 0: nonsymmetric)
+@retval Pointer to new COO matrix
+*/
+SMatrix grid(size_t k, double c)
+{
+  SMatrix S = SMx_Hdlr.init(k * k, k * k);
+  size_t i = 0, j = 0, p = 0;
+
+  for(i = 0; i < k; i++)
+  {
+    for(j = 0; j < k; j++)
+    {
+      p = i * k + j;
+      SMx_Hdlr.add(S, 4.0, p, p);
+
+      if(j > 0)     SMx_Hdlr.add(S, -1.0 - c, p, p - 1);
+      if(j + 1 < k) SMx_Hdlr.add(S, -1.0 + c, p, p + 1);
+      if(i > 0)     SMx_Hdlr.add(S, -1.0, p, p - k);
+      if(i + 1 < k) SMx_Hdlr.add(S, -1.0, p, p + k);
+    }
+  }
+
+  return S;
+}
+
+/**
+@brief  Builds a right-hand side b = A x* for a known smooth solution x*
+@param  A:     Pointer to sparse matrix
+        xs, b: Known solution and right-hand side (output)
+@retval none
+*/
+void manufacture(SMatrix A, Vector xs, Vector b)
+{
+  size_t i = 0;
+
+  for(i = 0; i < A->rows; i++)
+  {
+    xs[i] = sin(0.01 * i) + 1.0;
+  }
+
+  SMx_Hdlr.spmv(1.0, A, xs, 0.0, b);
+}
+
+/**
+@brief  Max. relative distance |x - y| / |y| (infinity norm)
+@param  n:    Number of elements
+        x, y: Vectors
+@retval Distance
+*/
+double error(size_t n, Vector x, Vector y)
+{
+  size_t i = 0;
+  double d = 0, m = 0;
+
+  for(i = 0; i < n; i++)
+  {
+    d = (fabs(x[i] - y[i]) > d) ? fabs(x[i] - y[i]) : d;
+    m = (fabs(y[i]) > m) ? fabs(y[i]) : m;
+  }
+
+  return d / m;
+}
+
+/**
+@brief  Runs one method from x = 0 and reports iterations and accuracy
+@param  L:      Pointer to solver
+        method: 0 CG, 1 BiCGSTAB, 2 GMRES
+        b, xs:  Right-hand side and known solution
+        x:      Solution vector
+        label:  Description
+@retval TRUE if the run converged to the known solution
+*/
+uint8_t run(Solver L, int method, Vector b, Vector xs, Vector x,
+            const char* label)
+{
+  const char* name[3] = {"CG", "BiCGSTAB", "GMRES(30)"};
+  struct timespec t0;
+  uint8_t ok = FALSE;
+  double t = 0, e = 0;
+
+  memset(x, 0, L->n * sizeof(Data));
+  timespec_get(&t0, TIME_UTC);
+
+  ok = (method == 0) ? Slv_Hdlr.cg(L, b, x) :
+       (method == 1) ? Slv_Hdlr.bicgstab(L, b, x) : Slv_Hdlr.gmres(L, b, x);
+
+  t = elapsed(t0);
+  e = error(L->n, x, xs);
+  ok = ok && Slv_Hdlr.res(L) < 10 * L->tol && e < 1e-5;
+  printf("%-10s %-22s %5zu it, res %.2e, err %.2e, %8.2f ms %s\n",
+         name[method], label, Slv_Hdlr.iter(L), Slv_Hdlr.res(L), e, t * 1e3,
+         ok ? "OK" : failed());
+
+  return ok;
+}
+
+//----------------------------------------------------------------------------//
+//                                Main Program                                //
+//----------------------------------------------------------------------------//
+
+int main()
+{
+  const char* pname[3] = {"", "Jacobi", "ILU(0)"};
+  t_solverPrecond pc[3] = {SLV_NONE, SLV_JACOBI, SLV_ILU0};
+  SMatrix S = NULL, A = NULL;
+  Matrix D = NULL, B = NULL, X = NULL;
+  Solver L = NULL;
+  Vector b = NULL, x = NULL, xs = NULL, h = NULL;
+  struct timespec t0;
+  size_t n = 0, i = 0, f = 0;
+  int method = 0;
+  uint8_t mono = TRUE;
+  char label[32];
+  double t = 0;
+
+  printf("***** BEGIN OF TEST *****\n");
+  printf("\n");
+
+  n = TEST_GRID * TEST_GRID;
+  b = (Vector)malloc(n * sizeof(Data));
+  x = (Vector)malloc(n * sizeof(Data));
+  xs = (Vector)malloc(n * sizeof(Data));
+
+  // Poisson (symmetric positive definite): every method and preconditioner
+  printf("* Poisson, %zux%zu grid (n = %zu) *\n", TEST_GRID, TEST_GRID, n);
+  S = grid(TEST_GRID, 0);
+  manufacture(S, xs, b);
+  L = Slv_Hdlr.sparse(S);
+
+  for(f = 0; f < 3; f++)
+  {
+    Slv_Hdlr.setPrecond(L, pc[f]);
+
+    for(method = 0; method < 3; method++)
+    {
+      snprintf(label, sizeof(label), "sparse %s", pname[f]);
+      run(L, method, b, xs, x, label);
+    }
+  }
+
+  // Residual history: starts at 1 (x = 0), GMRES never increases it
+  Slv_Hdlr.setPrecond(L, SLV_ILU0);
+  memset(x, 0, n * sizeof(Data));
+  Slv_Hdlr.gmres(L, b, x);
+  h = Slv_Hdlr.history(L);
+
+  for(i = 1; i <= Slv_Hdlr.iter(L); i++)
+  {
+    mono = mono && h[i] <= h[i - 1] * (1 + 1e-12);
+  }
+
+  printf("GMRES history: %.2e %.2e %.2e ... %.2e, monotone %s\n", h[0], h[1],
+         h[2], h[Slv_Hdlr.iter(L)], h[0] == 1 && mono ? "OK" : failed());
+
+  // Iteration limit and zero right-hand side
+  Slv_Hdlr.setTol(L, 1e-10, 5);
+  memset(x, 0, n * sizeof(Data));
+  mono = Slv_Hdlr.cg(L, b, x);
+  printf("Limit of 5 iterations: %s, %zu it %s\n",
+         mono ? "converged" : "not converged", Slv_Hdlr.iter(L),
+         !mono && Slv_Hdlr.iter(L) == 5 ? "OK" : failed());
+  Slv_Hdlr.setTol(L, SLV_TOL, SLV_MAX_ITER);
+  memset(xs, 0, n * sizeof(Data));
+  x[0] = 1;
+  mono = Slv_Hdlr.bicgstab(L, xs, x);
+  printf("Zero right-hand side: %s, x = 0 %s\n",
+         mono ? "converged" : "not converged",
+         mono && x[0] == 0 && Slv_Hdlr.iter(L) == 0 ? "OK" : failed());
+  Slv_Hdlr.del(L);
+  SMx_Hdlr.del(S);
+  printf("\n");
+
+  // Convection-diffusion (nonsymmetric): BiCGSTAB and GMRES
+  printf("* Convection-diffusion, %zux%zu grid *\n", TEST_GRID, TEST_GRID);
+  S = grid(TEST_GRID, 0.5);
+  manufacture(S, xs, b);
+  L = Slv_Hdlr.sparse(S);
+
+  for(f = 0; f < 3; f++)
+  {
+    Slv_Hdlr.setPrecond(L, pc[f]);
+
+    for(method = 1; method < 3; method++)
+    {
+      snprintf(label, sizeof(label), "sparse %s", pname[f]);
+      run(L, method, b, xs, x, label);
+    }
+  }
+
+  Slv_Hdlr.del(L);
+  printf("\n");
+
+  // Same system through the dense operator (and a transposed view of A^T)
+  printf("* Dense operator, 16x16 grid *\n");
+  SMx_Hdlr.del(S);
+  S = grid(16, 0.5);
+  manufacture(S, xs, b);
+  D = SMx_Hdlr.toDense(S);
+  L = Slv_Hdlr.dense(D);
+
+  for(f = 0; f < 3; f++)
+  {
+    Slv_Hdlr.setPrecond(L, pc[f]);
+    snprintf(label, sizeof(label), "dense %s", pname[f]);
+    run(L, 2, b, xs, x, label);
+  }
+
+  Slv_Hdlr.del(L);
+  A = SMx_Hdlr.transp(S);
+  Mx_Hdlr.del(D);
+  D = SMx_Hdlr.toDense(A);
+  B = Mx_Hdlr.transpView(D);
+  L = Slv_Hdlr.dense(B);
+  Slv_Hdlr.setPrecond(L, SLV_ILU0);
+  run(L, 1, b, xs, x, "view ILU(0)");
+  Slv_Hdlr.del(L);
+  Mx_Hdlr.del(B);
+
+  // Banded storage of the same operator (bandwidth: one grid row)
+  B = Mx_Hdlr.pack(D, MX_BANDED, 16, 16);
+  Mx_Hdlr.del(D);
+  D = Mx_Hdlr.transp(B);
+  L = Slv_Hdlr.dense(D);
+  Slv_Hdlr.setPrecond(L, SLV_ILU0);
+  run(L, 1, b, xs, x, "banded ILU(0)");
+  Slv_Hdlr.del(L);
+  Mx_Hdlr.del(B); Mx_Hdlr.del(D);
+  SMx_Hdlr.del(A); SMx_Hdlr.del(S);
+
+  // Invalid input
+  S = SMx_Hdlr.init(3, 4);
+  printf("Non-square system: %s\n",
+         Slv_Hdlr.sparse(S) == NULL ? "NULL (OK)" : failed());
+  SMx_Hdlr.del(S);
+  S = SMx_Hdlr.init(3, 3);
+  SMx_Hdlr.add(S, 1.0, 0, 1);
+  SMx_Hdlr.add(S, 1.0, 1, 0);
+  SMx_Hdlr.add(S, 1.0, 2, 2);
+  L = Slv_Hdlr.sparse(S);
+  printf("Zero diagonal: Jacobi %s, ILU(0) %s\n",
+         Slv_Hdlr.setPrecond(L, SLV_JACOBI) ? failed() : "rejected (OK)",
+         Slv_Hdlr.setPrecond(L, SLV_ILU0) ? failed() : "rejected (OK)");
+  Slv_Hdlr.del(L);
+  SMx_Hdlr.del(S);
+  free(b); free(x); free(xs);
+  printf("\n");
+
+  // Large Poisson system
+  n = BENCH_GRID * BENCH_GRID;
+  printf("* Benchmark (Poisson, %zux%zu grid, n = %zu) *\n", BENCH_GRID,
+         BENCH_GRID, n);
+  b = (Vector)malloc(n * sizeof(Data));
+  x = (Vector)malloc(n * sizeof(Data));
+  xs = (Vector)malloc(n * sizeof(Data));
+  S = grid(BENCH_GRID, 0);
+  manufacture(S, xs, b);
+  L = Slv_Hdlr.sparse(S);
+  Slv_Hdlr.setTol(L, 1e-10, 5000);
+
+  for(f = 0; f < 3; f++)
+  {
+    Slv_Hdlr.setPrecond(L, pc[f]);
+    snprintf(label, sizeof(label), "sparse %s", pname[f]);
+    run(L, 0, b, xs, x, label);
+  }
+
+  run(L, 1, b, xs, x, "sparse ILU(0)");
+  Slv_Hdlr.del(L);
+  SMx_Hdlr.del(S);
+  free(b); free(x); free(xs);
+  printf("\n");
+
+  // Iterative solver against the dense LU solve
+  n = BENCH_DENSE * BENCH_DENSE;
+  printf("* Benchmark (CG vs LU, Poisson, n = %zu) *\n", n);
+  b = (Vector)malloc(n * sizeof(Data));
+  x = (Vector)malloc(n * sizeof(Data));
+  xs = (Vector)malloc(n * sizeof(Data));
+  S = grid(BENCH_DENSE, 0);
+  manufacture(S, xs, b);
+  D = SMx_Hdlr.toDense(S);
+  B = Mx_Hdlr.init(n, 1);
+
+  for(i = 0; i < n; i++)
+  {
+    B->data[i * B->ld] = b[i];
+  }
+
+  timespec_get(&t0, TIME_UTC);
+  X = Mx_Hdlr.solve(D, B);
+  t = elapsed(t0);
+
+  for(i = 0; i < n; i++)
+  {
+    x[i] = X->data[i * X->ld];
+  }
+
+  printf("%-10s %-22s %24s %.2e, %8.2f ms %s\n", "LU", "dense", "err",
+         error(n, x, xs), t * 1e3, error(n, x, xs) < 1e-5 ? "OK" : failed());
+  L = Slv_Hdlr.sparse(S);
+  Slv_Hdlr.setPrecond(L, SLV_ILU0);
+  run(L, 0, b, xs, x, "sparse ILU(0)");
+  Slv_Hdlr.del(L);
+  SMx_Hdlr.del(S);
+  Mx_Hdlr.del(D); Mx_Hdlr.del(B); Mx_Hdlr.del(X);
+  free(b); free(x); free(xs);
+
+  printf("\n");
+  printf("***** END OF TEST *****");
+
+  return (fails == 0) ? 0 : 1;
+}
@@ -0,0 +1,138 @@
+/* -----------------------------------------------------------------------------
+ * Copyright (C) 2021 Jaime M. Villegas I. <jaime7592@gmail.com>
+ * -----------------------------------------------------------------------------
+ * Filename      : test_helpers.h
+ * Description   : Helpers shared by the test programs (timing, random data,
+ *                 matrix distances).
+ * Version       : 01.00
+ * Revision      : 01
+ * Last modified : 10/18/2026
+ * -----------------------------------------------------------------------------
+ */
+
+#ifndef _TEST_HELPERS_H_
+#define _TEST_HELPERS_H_
+
+// Definitions are static inline, so a program may include this header from
+// several translation units. Matrix helpers are only defined if ADT_Matrix.h
+// was included first
+
+//----------------------------------------------------------------------------//
+//                                Header files                                //
+//----------------------------------------------------------------------------//
+
+#include<stdint.h>
+#include<time.h>
+
+//----------------------------------------------------------------------------//
+//                              Test functions                                //
+//----------------------------------------------------------------------------//
+
+/**
+@brief  Reproducible pseudo-random generator
+@param  seed: Pointer to generator state
+@retval Value in [0, 2^24)
+*/
+static inline uint32_t rnd(uint32_t* seed)
+{
+  *seed = *seed * 1664525u + 1013904223u;
+
+  return *seed >> 8;
+}
+
+/**
+@brief  Seconds elapsed since t0 (wall time)
+@param  t0: Start time
+@retval Seconds
+*/
+static inline double elapsed(struct timespec t0)
+{
+  struct timespec t1;
+
+  timespec_get(&t1, TIME_UTC);
+
+  return (t1.tv_sec - t0.tv_sec) + (t1.tv_nsec - t0.tv_nsec) * 1e-9;
+}
+
+#ifdef _MATRIX_H_
+
+/**
+@brief  Fills a matrix with reproducible pseudo-random values in [-1, 1)
+@param  M:    Pointer to dense matrix (or block view, not transposed)
+        seed: Generator state
+@retval none
+*/
+static inline void fill(Matrix M, uint32_t seed)
+{
+  size_t i = 0, j = 0;
+
+  for(i = 0; i < M->rows; i++)
+  {
+    for(j = 0; j < M->columns; j++)
+    {
+      M->data[i * M->ld + j] = rnd(&seed) / 8388608.0 - 1.0;
+    }
+  }
+}
+
+/**
+@brief  Max. element-wise distance |A - B| (NaN on dimension mismatch)
+@param  A, B: Pointers to dense matrices (or block views, not transposed)
+@retval Distance
+*/
+static inline double distance(Matrix A, Matrix B)
+{
+  size_t i = 0, j = 0;
+  double d = 0, e = 0;
+
+  if(A == NULL || B == NULL || A->rows != B->rows || A->columns != B->columns)
+  {
+    return NAN;
+  }
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < A->columns; j++)
+    {
+      e = fabs(A->data[i * A->ld + j] - B->data[i * B->ld + j]);
+      d = (e > d) ? e : d;
+    }
+  }
+
+  return d;
+}
+
+/**
+@brief  Max. element-wise distance |A - B| for any storage (NaN on dimension
+        mismatch)
+@param  A, B: Pointers to matrices (any storage, or views)
+@retval Distance
+*/
+static inline double distance_any(Matrix A, Matrix B)
+{
+  size_t i = 0, j = 0;
+  double d = 0, e = 0;
+  Data a = 0, b = 0;
+
+  if(A == NULL || B == NULL || A->rows != B->rows || A->columns != B->columns)
+  {
+    return NAN;
+  }
+
+  for(i = 0; i < A->rows; i++)
+  {
+    for(j = 0; j < A->columns; j++)
+    {
+      Mx_Hdlr.get(A, i, j, &a);
+      Mx_Hdlr.get(B, i, j, &b);
+      e = fabs(a - b);
+      d = (e > d) ? e : d;
+    }
+  }
+
+  return d;
+}
+
+#endif
+
+#endif